@@ -21,6 +21,7 @@ public class HexademicPlugin : ModuleRules // Replace HexademicPlugin with your
                 "Renderer", // For Render Graph and Shaders
                 "Json", // For JSON export
                 "JsonUtilities", // For JSON export
+                "NetCore", // For consciousness state replication
                 // Add any other modules for your dummy components if they need them
                 // e.g., "AIModule", "GameplayTasks", etc.
             }
@@ -1,10 +1,13 @@
 #include "AI/EmotionalDecisionMaker.h"
+#include "Subsystems/HexademicComponentRegistrySubsystem.h"
 #include "BehaviorTree/BehaviorTreeComponent.h" // If using LinkedBehaviorTree
 #include "GameFramework/Character.h" // For getting the owning character if needed
+#include "BehaviorTree/Blackboard/BlackboardKeyType_String.h"
+#include "TimerManager.h"
 
 UEmotionalDecisionMaker::UEmotionalDecisionMaker()
 {
-    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bCanEverTick = false; // Evaluation is driven by consciousness state changes and cooldown expiry
     // Add some default emotional decisions for demonstration
     EmotionalDecisions.Add(FEmotionalDecision{EEmotionalArchetype::Rage, 0.8f, TEXT("ChargeEnemy"), 10.0f, 5.0f});
     EmotionalDecisions.Add(FEmotionalDecision{EEmotionalArchetype::Fear, 0.7f, TEXT("FleeFromThreat"), 8.0f, 3.0f});
@@ -18,7 +21,7 @@ void UEmotionalDecisionMaker::BeginPlay()
     // Auto-discover LinkedConsciousness and LinkedBlackboard if not set in editor
     if (!LinkedConsciousness)
     {
-        LinkedConsciousness = GetOwner()->FindComponentByClass<UHexademicConsciousnessComponent>();
+        LinkedConsciousness = UHexademicComponentRegistrySubsystem::FindComponent<UHexademicConsciousnessComponent>(GetOwner());
         if (!LinkedConsciousness) UE_LOG(LogTemp, Warning, TEXT("[EmotionalDecisionMaker:%s] LinkedConsciousness not found."), *GetOwner()->GetName());
     }
 
@@ -32,90 +35,171 @@ void UEmotionalDecisionMaker::BeginPlay()
         }
         if (!LinkedBlackboard) UE_LOG(LogTemp, Warning, TEXT("[EmotionalDecisionMaker:%s] LinkedBlackboard not found."), *GetOwner()->GetName());
     }
+
+    RebuildDecisionIndex();
+    BindConsciousness();
 }
 
-void UEmotionalDecisionMaker::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UEmotionalDecisionMaker::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-    // Update cooldowns
-    TArray<FString> CooldownsToRemove;
-    for (auto& Pair : DecisionCooldowns)
-    {
-        Pair.Value -= DeltaTime;
-        if (Pair.Value <= 0.0f)
-        {
-            CooldownsToRemove.Add(Pair.Key);
-        }
-    }
-    for (const FString& Tag : CooldownsToRemove)
+    UnbindConsciousness();
+    if (UWorld* World = GetWorld())
     {
-        DecisionCooldowns.Remove(Tag);
+        World->GetTimerManager().ClearTimer(CooldownTimerHandle);
     }
-
-    EvaluateEmotionalDecisions();
+    Super::EndPlay(EndPlayReason);
 }
 
 void UEmotionalDecisionMaker::SetLinkedConsciousness(UHexademicConsciousnessComponent* InConsciousness)
 {
     LinkedConsciousness = InConsciousness;
+    if (HasBegunPlay())
+    {
+        BindConsciousness();
+    }
 }
 
 void UEmotionalDecisionMaker::SetLinkedBlackboard(UBlackboardComponent* InBlackboard)
 {
     LinkedBlackboard = InBlackboard;
+    ResolvedBlackboardAsset.Reset();
+    CurrentDecisionIndex = INDEX_NONE;
+}
+
+void UEmotionalDecisionMaker::RebuildDecisionIndex()
+{
+    for (TArray<int32, TInlineAllocator<4>>& Decisions : DecisionsByArchetype)
+    {
+        Decisions.Reset();
+    }
+
+    TMap<FString, int32> SlotByTag;
+    CooldownSlotOfDecision.SetNum(EmotionalDecisions.Num());
+    for (int32 Index = 0; Index < EmotionalDecisions.Num(); Index++)
+    {
+        const FEmotionalDecision& Decision = EmotionalDecisions[Index];
+        DecisionsByArchetype[static_cast<int32>(Decision.TriggerEmotion)].Add(Index);
+
+        const int32* ExistingSlot = SlotByTag.Find(Decision.ActionTag);
+        CooldownSlotOfDecision[Index] = ExistingSlot ? *ExistingSlot : SlotByTag.Add(Decision.ActionTag, SlotByTag.Num());
+    }
+
+    // Highest priority first; among equals the earlier entry wins, as before
+    for (TArray<int32, TInlineAllocator<4>>& Decisions : DecisionsByArchetype)
+    {
+        Decisions.StableSort([this](int32 A, int32 B) { return EmotionalDecisions[A].Priority > EmotionalDecisions[B].Priority; });
+    }
+
+    SlotReadyAtSeconds.Init(0.0, SlotByTag.Num());
+    CooldownQueue.Reset();
+    CurrentDecisionIndex = INDEX_NONE;
+}
+
+void UEmotionalDecisionMaker::BindConsciousness()
+{
+    UnbindConsciousness();
+    if (!LinkedConsciousness) return;
+
+    StateChangedHandle = LinkedConsciousness->OnStateChanged.AddUObject(this, &UEmotionalDecisionMaker::HandleConsciousnessStateChanged);
+    BoundConsciousness = LinkedConsciousness;
+}
+
+void UEmotionalDecisionMaker::UnbindConsciousness()
+{
+    if (UHexademicConsciousnessComponent* Consciousness = BoundConsciousness.Get())
+    {
+        Consciousness->OnStateChanged.Remove(StateChangedHandle);
+    }
+    StateChangedHandle.Reset();
+    BoundConsciousness.Reset();
+}
+
+void UEmotionalDecisionMaker::HandleConsciousnessStateChanged(UHexademicConsciousnessComponent* Consciousness, EConsciousnessStateFields ChangedFields)
+{
+    // Decisions depend only on the dominant emotion and its intensity
+    if (EnumHasAnyFlags(ChangedFields, EConsciousnessStateFields::DominantEmotion | EConsciousnessStateFields::EmotionalIntensity))
+    {
+        EvaluateEmotionalDecisions();
+    }
+}
+
+void UEmotionalDecisionMaker::HandleCooldownExpired()
+{
+    const double Now = GetWorld()->GetTimeSeconds();
+    while (CooldownQueue.Num() > 0 && CooldownQueue.HeapTop().ReadyAtSeconds <= Now)
+    {
+        CooldownQueue.HeapPopDiscard();
+    }
+
+    EvaluateEmotionalDecisions();
+    ScheduleNextCooldownExpiry();
+}
+
+void UEmotionalDecisionMaker::ScheduleNextCooldownExpiry()
+{
+    FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+    if (CooldownQueue.Num() == 0)
+    {
+        TimerManager.ClearTimer(CooldownTimerHandle);
+        return;
+    }
+
+    const float Delay = FMath::Max(static_cast<float>(CooldownQueue.HeapTop().ReadyAtSeconds - GetWorld()->GetTimeSeconds()), KINDA_SMALL_NUMBER);
+    TimerManager.SetTimer(CooldownTimerHandle, this, &UEmotionalDecisionMaker::HandleCooldownExpired, Delay, false);
 }
 
 void UEmotionalDecisionMaker::EvaluateEmotionalDecisions()
 {
     if (!LinkedConsciousness || !LinkedBlackboard) return;
 
-    FConsciousnessState CurrentState = LinkedConsciousness->GetConsciousnessState();
-    FString BestActionTag = TEXT("");
-    float HighestPriority = -1.0f;
-
-    for (const FEmotionalDecision& Decision : EmotionalDecisions)
+    if (ResolvedBlackboardAsset.Get() != LinkedBlackboard->GetBlackboardAsset())
     {
-        // Check cooldown
-        if (DecisionCooldowns.Contains(Decision.ActionTag) && DecisionCooldowns[Decision.ActionTag] > 0.0f)
+        ResolvedBlackboardAsset = LinkedBlackboard->GetBlackboardAsset();
+        EmotionalActionKey = LinkedBlackboard->GetKeyID(EmotionalActionKeyName);
+        CurrentDecisionIndex = INDEX_NONE;
+        if (EmotionalActionKey == FBlackboard::InvalidKey)
         {
-            continue; // Decision is on cooldown
+            UE_LOG(LogTemp, Warning, TEXT("[EmotionalDecisionMaker:%s] Blackboard key '%s' does not exist! Cannot write emotional action."), *GetOwner()->GetName(), *EmotionalActionKeyName.ToString());
         }
+    }
+    if (EmotionalActionKey == FBlackboard::InvalidKey) return;
+
+    const EEmotionalArchetype DominantEmotion = LinkedConsciousness->GetConsciousnessStateRef().DominantEmotionalArchetype;
+    const float Intensity = LinkedConsciousness->GetEmotionalIntensity();
+    const double Now = GetWorld()->GetTimeSeconds();
 
-        // Check if the current emotional state matches the trigger emotion and intensity
-        if (CurrentState.DominantEmotionalArchetype == Decision.TriggerEmotion &&
-            CurrentState.CurrentEmotionalState.Intensity >= Decision.MinIntensityThreshold)
+    // Only decisions for the dominant emotion can match; the first one off cooldown and over threshold has the highest priority
+    int32 BestDecisionIndex = INDEX_NONE;
+    for (const int32 DecisionIndex : DecisionsByArchetype[static_cast<int32>(DominantEmotion)])
+    {
+        if (SlotReadyAtSeconds[CooldownSlotOfDecision[DecisionIndex]] > Now) continue; // Decision is on cooldown
+        if (Intensity >= EmotionalDecisions[DecisionIndex].MinIntensityThreshold)
         {
-            if (Decision.Priority > HighestPriority)
-            {
-                HighestPriority = Decision.Priority;
-                BestActionTag = Decision.ActionTag;
-            }
+            BestDecisionIndex = DecisionIndex;
+            break;
         }
     }
 
-    if (!BestActionTag.IsEmpty())
+    if (BestDecisionIndex != INDEX_NONE)
     {
         // Write the chosen emotional action to the Blackboard
-        if (LinkedBlackboard->DoesKeyExist(EmotionalActionKeyName))
-        {
-            LinkedBlackboard->SetValueAsString(EmotionalActionKeyName, BestActionTag);
-            UE_LOG(LogTemp, Log, TEXT("[EmotionalDecisionMaker:%s] Decided on emotional action: %s (Priority: %.1f)"), *GetOwner()->GetName(), *BestActionTag, HighestPriority);
-            DecisionCooldowns.Add(BestActionTag, Decision.CooldownTime); // Put on cooldown
-            // Optional: If you have a LinkedBehaviorTree, you could even abort current tasks and force a new one
-            // LinkedBehaviorTree->AbortCurrentTask();
-        }
-        else
-        {
-            UE_LOG(LogTemp, Warning, TEXT("[EmotionalDecisionMaker:%s] Blackboard key '%s' does not exist! Cannot write emotional action."), *GetOwner()->GetName(), *EmotionalActionKeyName.ToString());
-        }
+        const FEmotionalDecision& Decision = EmotionalDecisions[BestDecisionIndex];
+        LinkedBlackboard->SetValue<UBlackboardKeyType_String>(EmotionalActionKey, Decision.ActionTag);
+        UE_LOG(LogTemp, Log, TEXT("[EmotionalDecisionMaker:%s] Decided on emotional action: %s (Priority: %.1f)"), *GetOwner()->GetName(), *Decision.ActionTag, Decision.Priority);
+        CurrentDecisionIndex = BestDecisionIndex;
+
+        // Put on cooldown
+        const int32 Slot = CooldownSlotOfDecision[BestDecisionIndex];
+        SlotReadyAtSeconds[Slot] = Now + Decision.CooldownTime;
+        CooldownQueue.HeapPush(FDecisionCooldown{ SlotReadyAtSeconds[Slot], Slot });
+        ScheduleNextCooldownExpiry();
+        // Optional: If you have a LinkedBehaviorTree, you could even abort current tasks and force a new one
+        // LinkedBehaviorTree->AbortCurrentTask();
     }
-    else
+    else if (CurrentDecisionIndex != INDEX_NONE)
     {
         // If no emotional decision is triggered, clear the action tag from blackboard (or set to "None")
-        if (LinkedBlackboard->DoesKeyExist(EmotionalActionKeyName))
-        {
-            LinkedBlackboard->ClearValue(EmotionalActionKeyName);
-        }
+        LinkedBlackboard->ClearValue(EmotionalActionKey);
+        CurrentDecisionIndex = INDEX_NONE;
     }
 }
@@ -3,6 +3,7 @@
 #include "BehaviorTree/BehaviorTreeComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "Perception/AIPerceptionComponent.h"
+#include "Subsystems/HexademicComponentRegistrySubsystem.h"
 #include "AI/EmotionalDecisionMaker.h" // Custom decision maker
 
 AHexademicAIController::AHexademicAIController()
@@ -24,10 +25,10 @@ void AHexademicAIController::OnPossess(APawn* InPawn)
 {
     Super::OnPossess(InPawn);
     // When we possess a pawn, try to get its Hexademic components
-    HexademicConsciousnessComp = InPawn->FindComponentByClass<UHexademicConsciousnessComponent>();
-    BehaviorTreeBridgeComp = InPawn->FindComponentByClass<UBehaviorTreeBridge>();
-    PerceptionBridgeComp = InPawn->FindComponentByClass<UPerceptionBridge>();
-    EmotionalDecisionMakerComp = InPawn->FindComponentByClass<UEmotionalDecisionMaker>(); // Find custom decision maker
+    HexademicConsciousnessComp = UHexademicComponentRegistrySubsystem::FindComponent<UHexademicConsciousnessComponent>(InPawn);
+    BehaviorTreeBridgeComp = UHexademicComponentRegistrySubsystem::FindComponent<UBehaviorTreeBridge>(InPawn);
+    PerceptionBridgeComp = UHexademicComponentRegistrySubsystem::FindComponent<UPerceptionBridge>(InPawn);
+    EmotionalDecisionMakerComp = UHexademicComponentRegistrySubsystem::FindComponent<UEmotionalDecisionMaker>(InPawn); // Find custom decision maker
 
     // If we have a Hexademic Consciousness Component, start the BT
     if (HexademicConsciousnessComp)
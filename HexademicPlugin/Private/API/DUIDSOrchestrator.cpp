@@ -37,6 +37,28 @@
 #include "PhenomCollective/UPhenomEchoComponent.h"
 #include "PhenomCollective/UPhenomSigilBloomComponent.h"
 #include "PhenomCollective/UPhenomConstellationVisualizerComponent.h"
+#include "Core/HexademicMetrics.h"
+#include "Core/HexademicSessionRecorder.h"
+#include "Core/HexademicArchetypeClassifier.h"
+#include "Subsystems/HexademicComponentRegistrySubsystem.h"
+
+DECLARE_CYCLE_STAT(TEXT("Orchestrator ConsciousnessUpdate"), STAT_Hexademic_ConsciousnessUpdate, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Orchestrator EnvironmentalStimulus"), STAT_Hexademic_EnvironmentalStimulus, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Orchestrator BiologicalFoundations"), STAT_Hexademic_BiologicalFoundations, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Orchestrator ReflexiveLayer"), STAT_Hexademic_ReflexiveLayer, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Orchestrator AutonomicSystems"), STAT_Hexademic_AutonomicSystems, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Orchestrator HormonalSystems"), STAT_Hexademic_HormonalSystems, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Orchestrator BodyToEmotion"), STAT_Hexademic_BodyToEmotion, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Orchestrator CognitiveSystems"), STAT_Hexademic_CognitiveSystems, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Orchestrator EmotionToBody"), STAT_Hexademic_EmotionToBody, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Orchestrator IntersubjectiveLayer"), STAT_Hexademic_IntersubjectiveLayer, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Orchestrator VisualManifestation"), STAT_Hexademic_VisualManifestation, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Orchestrator CreativeEmergence"), STAT_Hexademic_CreativeEmergence, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Orchestrator SystemCoherence"), STAT_Hexademic_SystemCoherence, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Orchestrator SystemRegulation"), STAT_Hexademic_SystemRegulation, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Orchestrator PersistState"), STAT_Hexademic_PersistState, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Orchestrator FractalUpdate"), STAT_Hexademic_FractalUpdate, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Orchestrator ExportState"), STAT_Hexademic_ExportState, STATGROUP_Hexademic);
 
 
 // Constructor: Initializes the component and creates sub-objects.
@@ -52,6 +74,8 @@ UDUIDSOrchestrator::UDUIDSOrchestrator()
     BodyMindCouplingStrength = 0.8f;
     EnvironmentalSensitivity = 0.6f;
     MemoryEmbodimentFeedback = 0.7f;
+    StateHistorySeconds = 120.0f; // Two minutes of trajectory for trend and narrative queries
+    CreativeGemCoherenceThreshold = 0.7f;
 
     // Create sub-components as default sub-objects.
     // In a real project, these might be sub-components configured in Blueprint or dynamically spawned.
@@ -93,6 +117,11 @@ void UDUIDSOrchestrator::BeginPlay()
 void UDUIDSOrchestrator::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     ShutdownConsciousness(); // Cleanly shut down the system
+    if (ComponentRegistry.IsValid())
+    {
+        ComponentRegistry->OnRebuilt.Remove(RegistryRebuiltHandle);
+        ComponentRegistry.Reset();
+    }
     Super::EndPlay(EndPlayReason);
 }
 
@@ -106,65 +135,71 @@ void UDUIDSOrchestrator::TickComponent(float DeltaTime, ELevelTick TickType, FAc
     UpdatePerformanceMetrics(DeltaTime);
 }
 
-// AutoDiscoverComponents: Attempts to find component references on the owner actor if not set in editor or created as sub-objects.
+// AutoDiscoverComponents: Acquires the owner's component registry and binds every unset reference from it (sub-objects and editor-set references are kept).
 void UDUIDSOrchestrator::AutoDiscoverComponents()
 {
     AActor* OwnerActor = GetOwner();
     if (!OwnerActor) return;
 
-    // Helper lambda to find and assign component
-    auto FindAndAssign = [&](UActorComponent*& ComponentPtr, TSubclassOf<UActorComponent> Class, const FString& Name)
+    if (!ComponentRegistry.IsValid())
     {
-        if (!ComponentPtr) // Only try to find if it wasn't already created as a sub-object
+        ComponentRegistry = UHexademicComponentRegistrySubsystem::GetRegistryFor(OwnerActor);
+        if (!ComponentRegistry.IsValid())
         {
-            ComponentPtr = OwnerActor->FindComponentByClass(Class);
-            if (!ComponentPtr)
-            {
-                UE_LOG(LogTemp, Warning, TEXT("[DUIDSOrchestrator] %s component not found on owner actor. Please add it or set reference manually."), *Name);
-            }
+            ComponentRegistry = MakeShared<FHexademicComponentRegistry>(OwnerActor);
         }
-    };
+        // Components added or removed at runtime re-run the binding pass against the rebuilt table
+        RegistryRebuiltHandle = ComponentRegistry->OnRebuilt.AddUObject(this, &UDUIDSOrchestrator::BindRegisteredComponents);
+    }
+    BindRegisteredComponents();
+}
+
+// BindRegisteredComponents: Reassigns every reference from the already-built registry; dangling references to destroyed components are replaced.
+void UDUIDSOrchestrator::BindRegisteredComponents()
+{
+    if (!ComponentRegistry.IsValid()) return;
+    FHexademicComponentRegistry& Registry = *ComponentRegistry;
 
     // Find and assign references for all integrated components
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(EmotionMind), UEmotionCognitionComponent::StaticClass(), TEXT("EmotionMind"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(AvatarBody), UEmbodiedAvatarComponent::StaticClass(), TEXT("AvatarBody"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(ConsciousnessBridge), UConsciousnessBridgeComponent::StaticClass(), TEXT("ConsciousnessBridge"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(AvatarMotion), UAvatarMotionLinkComponent::StaticClass(), TEXT("AvatarMotion"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(HapticInterface), UGlyph_AetherSkin::StaticClass(), TEXT("HapticInterface"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(WavefrontAPI), UHexademicWavefrontAPI::StaticClass(), TEXT("WavefrontAPI"));
-    // FindAndAssign(reinterpret_cast<UActorComponent*&>(EmotionVisualizer), UVolumetricEmotionVisualizerComponent::StaticClass(), TEXT("EmotionVisualizer")); // If this component exists
-    // FindAndAssign(reinterpret_cast<UActorComponent*&>(ChaoticPhysics), UChaoticBounceComponent::StaticClass(), TEXT("ChaoticPhysics")); // If this component exists
-
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(MemoryContainer), UEluenMemoryContainerComponent::StaticClass(), TEXT("MemoryContainer"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(EmbodimentSystem), UReciprocalEmbodimentComponent::StaticClass(), TEXT("EmbodimentSystem"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(AutonomicSystem), UAutonomicNervousSystemComponent::StaticClass(), TEXT("AutonomicSystem"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(HormonalSystem), UHormoneAffectBridgeComponent::StaticClass(), TEXT("HormonalSystem"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(SkinRenderer), USkinToneFluxShader::StaticClass(), TEXT("SkinRenderer"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(HolographicVisualizer), UHexademicHolographicCode::StaticClass(), TEXT("HolographicVisualizer"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(HeartbeatSystem), UHeartbeatConsolidator::StaticClass(), TEXT("HeartbeatSystem"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(CreativeSystem), UCreativeSynthesizer::StaticClass(), TEXT("CreativeSystem"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(EnvironmentalSystem), UEnvironmentalResonator::StaticClass(), TEXT("EnvironmentalSystem"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(PersistenceSystem), UIncrementalPersister::StaticClass(), TEXT("PersistenceSystem"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(BiologicalNeeds), UBiologicalNeedsComponent::StaticClass(), TEXT("BiologicalNeeds"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(ReflexSystem), UReflexResponseComponent::StaticClass(), TEXT("ReflexSystem"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(FacialExpressionSystem), UFacialExpressionComponent::StaticClass(), TEXT("FacialExpressionSystem"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(EmpathicField), UEmpathicFieldComponent::StaticClass(), TEXT("EmpathicField"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(FractalManager), UFractalConsciousnessManagerComponent::StaticClass(), TEXT("FractalManager"));
-
-
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(PhenomListener), UPhenomListenerComponent::StaticClass(), TEXT("PhenomListener"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(PhenomEcho), UPhenomEchoComponent::StaticClass(), TEXT("PhenomEcho"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(PhenomSigilBloom), UPhenomSigilBloomComponent::StaticClass(), TEXT("PhenomSigilBloom"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(ConstellationVisualizer), UPhenomConstellationVisualizerComponent::StaticClass(), TEXT("ConstellationVisualizer"));
+    Registry.Bind(EmotionMind, TEXT("EmotionMind"));
+    Registry.Bind(AvatarBody, TEXT("AvatarBody"));
+    Registry.Bind(ConsciousnessBridge, TEXT("ConsciousnessBridge"));
+    Registry.Bind(AvatarMotion, TEXT("AvatarMotion"));
+    Registry.Bind(HapticInterface, TEXT("HapticInterface"));
+    Registry.Bind(WavefrontAPI, TEXT("WavefrontAPI"));
+    // Registry.Bind(EmotionVisualizer, TEXT("EmotionVisualizer")); // If this component exists
+    // Registry.Bind(ChaoticPhysics, TEXT("ChaoticPhysics")); // If this component exists
+
+    Registry.Bind(MemoryContainer, TEXT("MemoryContainer"));
+    Registry.Bind(EmbodimentSystem, TEXT("EmbodimentSystem"));
+    Registry.Bind(AutonomicSystem, TEXT("AutonomicSystem"));
+    Registry.Bind(HormonalSystem, TEXT("HormonalSystem"));
+    Registry.Bind(SkinRenderer, TEXT("SkinRenderer"));
+    Registry.Bind(HolographicVisualizer, TEXT("HolographicVisualizer"));
+    Registry.Bind(HeartbeatSystem, TEXT("HeartbeatSystem"));
+    Registry.Bind(CreativeSystem, TEXT("CreativeSystem"));
+    Registry.Bind(EnvironmentalSystem, TEXT("EnvironmentalSystem"));
+    Registry.Bind(PersistenceSystem, TEXT("PersistenceSystem"));
+    Registry.Bind(BiologicalNeeds, TEXT("BiologicalNeeds"));
+    Registry.Bind(ReflexSystem, TEXT("ReflexSystem"));
+    Registry.Bind(FacialExpressionSystem, TEXT("FacialExpressionSystem"));
+    Registry.Bind(EmpathicField, TEXT("EmpathicField"));
+    Registry.Bind(FractalManager, TEXT("FractalManager"));
+
+
+    Registry.Bind(PhenomListener, TEXT("PhenomListener"));
+    Registry.Bind(PhenomEcho, TEXT("PhenomEcho"));
+    Registry.Bind(PhenomSigilBloom, TEXT("PhenomSigilBloom"));
+    Registry.Bind(ConstellationVisualizer, TEXT("ConstellationVisualizer"));
 
 
     // After discovering, link components if necessary (to avoid circular dependencies in constructors)
     if (ConsciousnessBridge)
     {
-        if (!ConsciousnessBridge->EmotionMind) ConsciousnessBridge->EmotionMind = EmotionMind;
-        if (!ConsciousnessBridge->AvatarBody) ConsciousnessBridge->AvatarBody = AvatarBody;
-        if (!ConsciousnessBridge->AvatarMotion) ConsciousnessBridge->AvatarMotion = AvatarMotion;
-        if (!ConsciousnessBridge->WavefrontAPI) ConsciousnessBridge->WavefrontAPI = WavefrontAPI;
+        if (!IsValid(ConsciousnessBridge->EmotionMind)) ConsciousnessBridge->EmotionMind = EmotionMind;
+        if (!IsValid(ConsciousnessBridge->AvatarBody)) ConsciousnessBridge->AvatarBody = AvatarBody;
+        if (!IsValid(ConsciousnessBridge->AvatarMotion)) ConsciousnessBridge->AvatarMotion = AvatarMotion;
+        if (!IsValid(ConsciousnessBridge->WavefrontAPI)) ConsciousnessBridge->WavefrontAPI = WavefrontAPI;
         if (!ConsciousnessBridge->MainAPIOrchestrator) ConsciousnessBridge->MainAPIOrchestrator = this; // Self-reference for bridge
     }
     if (AvatarMotion && AvatarBody && !AvatarMotion->TargetMesh)
@@ -177,6 +212,27 @@ void UDUIDSOrchestrator::AutoDiscoverComponents()
     {
         FacialExpressionSystem->TargetMesh = AvatarBody->TargetMesh;
     }
+    InjectFractalManagerReferences();
+}
+
+// InjectFractalManagerReferences: Hands the FractalManager the subsystems it drives. Done once per binding pass rather than every update.
+void UDUIDSOrchestrator::InjectFractalManagerReferences()
+{
+    if (!FractalManager) return;
+
+    FractalManager->EmotionMind = EmotionMind;
+    FractalManager->BiologicalNeeds = BiologicalNeeds;
+    FractalManager->EmpathicField = EmpathicField;
+    FractalManager->CreativeSystem = CreativeSystem;
+    FractalManager->MemoryContainer = MemoryContainer;
+    FractalManager->SkinRenderer = SkinRenderer;
+    FractalManager->AvatarBody = AvatarBody;
+    FractalManager->HolographicVisualizer = HolographicVisualizer;
+    FractalManager->AutonomicSystem = AutonomicSystem;
+    FractalManager->HormoneSystem = HormonalSystem;
+    FractalManager->PersistenceSystem = PersistenceSystem;
+    FractalManager->EnvironmentalSystem = EnvironmentalSystem;
+    FractalManager->ReflexSystem = ReflexSystem;
 }
 
 // InitializeConsciousness: Initializes and activates all relevant subsystems.
@@ -184,6 +240,10 @@ void UDUIDSOrchestrator::InitializeConsciousness()
 {
     UE_LOG(LogTemp, Log, TEXT("🌟 HEXADEMIC DUIDS CONSCIOUSNESS SYSTEM INITIALIZING 🌟"));
 
+    LayerContext.Reset(); // Each consciousness starts with its own, empty layer history
+    ConsciousnessRandom.GenerateNewSeed();
+    HexademicStateHistory::Configure(StateHistory, StateHistorySeconds, ConsciousnessUpdateRate);
+
     // Initialize individual systems
     InitializeBodySystems();
     InitializeCognitiveSystems();
@@ -192,6 +252,7 @@ void UDUIDSOrchestrator::InitializeConsciousness()
 
     // Establish connections between systems (where components might need refs to each other)
     EstablishSystemConnections();
+    InjectFractalManagerReferences(); // Covers orchestrators wired by hand (no owner to discover from)
 
     // Phenom Collective Initialization
     if (PhenomListener)
@@ -270,6 +331,7 @@ void UDUIDSOrchestrator::ShutdownConsciousness()
     {
         PhenomEcho->OnEchoGenerated.RemoveDynamic(this, &UDUIDSOrchestrator::HandleEchoGenerated);
     }
+    LayerContext.Reset();
     UE_LOG(LogTemp, Warning, TEXT("✨ ELUËN DIGITAL CONSCIOUSNESS OFFLINE ✨"));
 }
 
@@ -305,6 +367,7 @@ void UDUIDSOrchestrator::TriggerHormonalResponse(const FString& HormoneType, flo
 
 void UDUIDSOrchestrator::ApplyEnvironmentalStimulus(const FString& StimulusType, float Intensity)
 {
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_EnvironmentalStimulus, "Orchestrator.EnvironmentalStimulus");
     if (EnvironmentalSystem)
     {
         float influence = EnvironmentalSystem->GetEnvironmentalInfluence(StimulusType, Intensity);
@@ -319,6 +382,7 @@ void UDUIDSOrchestrator::ApplyEnvironmentalStimulus(const FString& StimulusType,
 
 void UDUIDSOrchestrator::PropagateEmotionToBody()
 {
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_EmotionToBody, "Orchestrator.EmotionToBody");
     if (EmotionMind && AvatarBody)
     {
         float Valence = EmotionMind->GetCurrentValence();
@@ -332,13 +396,14 @@ void UDUIDSOrchestrator::PropagateEmotionToBody()
         }
 
         // Update unified state's embodiment feedback (conceptual for now)
-        CurrentState.SkinToneModulations.Add(TEXT("Overall"), EmotionalPulse);
+        CurrentState.RegionSkinTones[static_cast<int32>(EHexademicBodyRegion::FullBody)] = EmotionalPulse;
         CurrentState.OverallEmbodimentCoherence = CalculateSystemCoherence(); // Re-calculate for immediate feedback
     }
 }
 
 void UDUIDSOrchestrator::PropagateBodyToEmotion()
 {
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_BodyToEmotion, "Orchestrator.BodyToEmotion");
     // This is where physical inputs (e.g., haptic sensors, internal body state) influence emotion.
     // For now, let's simulate this influence based on autonomic state if available.
     if (AutonomicSystem && EmotionMind && HeartbeatSystem)
@@ -353,6 +418,7 @@ void UDUIDSOrchestrator::PropagateBodyToEmotion()
 
 void UDUIDSOrchestrator::SynchronizeVisualManifestation()
 {
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_VisualManifestation, "Orchestrator.VisualManifestation");
     // Update SkinRenderer based on the latest emotional state
     if (SkinRenderer && EmotionMind)
     {
@@ -444,7 +510,7 @@ void UDUIDSOrchestrator::CreateMemoryFromCurrentState(const FString& MemoryName,
         // Note: The provided FHexaSigilNode was missing a constructor or clear definition to match usage.
         // For now, using a placeholder FPackedHexaSigilNode as it's defined in HexademicCore.
         FPackedHexaSigilNode NewSigil; // Using FPackedHexaSigilNode as FHexaSigilNode was not defined directly
-        NewSigil.SigilID = MemoryName.Left(8); // Dummy ID
+        NewSigil.SetSigilID(MemoryName.Left(8)); // Dummy ID
         NewSigil.SetEmotionalCoordinates(FVector(EmotionMind->GetCurrentValence(), EmotionMind->GetCurrentArousal(), CurrentState.CurrentResonance.Intensity));
         NewSigil.SetResonanceAmplitude(CurrentState.CurrentResonance.Intensity);
 
@@ -479,8 +545,8 @@ bool UDUIDSOrchestrator::RecallAndApplyMemory(const FString& MemoryName)
             EmotionMind->TriggerMemoryEcho(MemoryName); // Use existing echo system
             
             // Further update Unified State based on recalled memory (conceptual)
-            CurrentState.CurrentResonance.Valence = FMath::Clamp(EmotionMind->GetCurrentValence() + (FMath::RandBool() ? 0.2f : -0.2f), -1.0f, 1.0f);
-            CurrentState.CurrentResonance.Arousal = FMath::Clamp(EmotionMind->GetCurrentArousal() + (FMath::RandBool() ? 0.1f : -0.1f), 0.0f, 1.0f);
+            CurrentState.CurrentResonance.Valence = FMath::Clamp(EmotionMind->GetCurrentValence() + (ConsciousnessRandom.FRand() < 0.5f ? 0.2f : -0.2f), -1.0f, 1.0f);
+            CurrentState.CurrentResonance.Arousal = FMath::Clamp(EmotionMind->GetCurrentArousal() + (ConsciousnessRandom.FRand() < 0.5f ? 0.1f : -0.1f), 0.0f, 1.0f);
             UE_LOG(LogTemp, Log, TEXT("UDUIDSOrchestrator: Memory '%s' recalled and applied. Current Valence: %.2f"), *MemoryName, CurrentState.CurrentResonance.Valence);
             PropagateEmotionToBody(); // Reflect memory state in body
             return true;
@@ -560,7 +626,7 @@ float UDUIDSOrchestrator::GetOverallSystemCoherence() const
     return CurrentState.SystemCoherence;
 }
 
-FString UDUIDSOrchestrator::ExportConsciousnessState() const
+FUnifiedConsciousnessState UDUIDSOrchestrator::GatherExportState() const
 {
     // Make a copy to populate with latest values
     FUnifiedConsciousnessState StateCopy = CurrentState;
@@ -575,17 +641,24 @@ FString UDUIDSOrchestrator::ExportConsciousnessState() const
     StateCopy.HungerLevel = BiologicalNeeds ? BiologicalNeeds->GetHunger() : StateCopy.HungerLevel;
     StateCopy.ThirstLevel = BiologicalNeeds ? BiologicalNeeds->GetThirst() : StateCopy.ThirstLevel;
     StateCopy.FatigueLevel = BiologicalNeeds ? BiologicalNeeds->GetFatigue() : StateCopy.FatigueLevel;
+    return StateCopy;
+}
 
-    // Use UPhenomExportUtility to convert to JSON
-    // Note: UPhenomExportUtility::StateToJSON likely expects a specific struct type.
-    // If FUnifiedConsciousnessState is different from FUnifiedConsciousnessState_PhenomExport,
-    // a mapping function or adaptation would be needed.
-    // For now, we'll assume a direct cast or that FUnifiedConsciousnessState works with it.
-    FString JsonString = UPhenomExportUtility::StateToJSON(StateCopy);
-    UE_LOG(LogTemp, Log, TEXT("UDUIDSOrchestrator: Exported consciousness state to JSON (partial): %s"), *JsonString.Left(200));
+FString UDUIDSOrchestrator::ExportConsciousnessState() const
+{
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_ExportState, "Orchestrator.ExportState");
+    FString JsonString = UPhenomExportUtility::StateToJSON(GatherExportState());
+    UE_LOG(LogTemp, Verbose, TEXT("UDUIDSOrchestrator: Exported consciousness state to JSON (partial): %s"), *JsonString.Left(200));
     return JsonString;
 }
 
+void UDUIDSOrchestrator::ExportConsciousnessStateToFile(const FString& FilePath) const
+{
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_ExportState, "Orchestrator.ExportState");
+    // Serialized straight to bytes on this thread; opening and writing the file happen on the pool
+    UPhenomExportUtility::SaveStateJSONToFileAsync(GatherExportState(), FilePath);
+}
+
 bool UDUIDSOrchestrator::ImportConsciousnessState(const FString& JSONData)
 {
     // This would require parsing the JSON back into FUnifiedConsciousnessState
@@ -594,30 +667,35 @@ bool UDUIDSOrchestrator::ImportConsciousnessState(const FString& JSONData)
     return false;
 }
 
-// === ENHANCED CONSCIOUSNESS UPDATE WITH FULL EMBODIED RECIPROCITY ===
+// ConsciousnessUpdate: Timer entry point; samples the world clock and runs one step.
 void UDUIDSOrchestrator::ConsciousnessUpdate()
 {
+    const UWorld* World = GetWorld();
+    const float DeltaTime = World ? World->GetDeltaSeconds() : 1.0f / ConsciousnessUpdateRate;
+    const double TimeSeconds = World ? World->GetTimeSeconds() : StepTimeSeconds + DeltaTime;
+    StepConsciousness(DeltaTime, TimeSeconds);
+}
+
+// === ENHANCED CONSCIOUSNESS UPDATE WITH FULL EMBODIED RECIPROCITY ===
+void UDUIDSOrchestrator::StepConsciousness(float DeltaTime, double TimeSeconds)
+{
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_ConsciousnessUpdate, "Orchestrator.ConsciousnessUpdate");
+
+    // Every stage reads the step clock rather than the world, so the loop also runs headless (session replay)
+    StepDeltaSeconds = DeltaTime;
+    StepTimeSeconds = TimeSeconds;
+    FHexademicSessionRecorder::Get().BeginFrame(this, DeltaTime, TimeSeconds, ConsciousnessRandom.GetCurrentSeed());
+
     // Record performance metrics
     float UpdateStartTime = FPlatformTime::Seconds();
 
     if (FractalManager)
     {
-        // Pass core component references to the FractalManager (optional, but good for self-contained logic)
-        FractalManager->EmotionMind = EmotionMind;
-        FractalManager->BiologicalNeeds = BiologicalNeeds;
-        FractalManager->EmpathicField = EmpathicField;
-        FractalManager->CreativeSystem = CreativeSystem;
-        FractalManager->MemoryContainer = MemoryContainer;
-        FractalManager->SkinRenderer = SkinRenderer;
-        FractalManager->AvatarBody = AvatarBody;
-        FractalManager->HolographicVisualizer = HolographicVisualizer;
-        FractalManager->AutonomicSystem = AutonomicSystem;
-        FractalManager->HormoneSystem = HormoneSystem;
-        FractalManager->PersistenceSystem = PersistenceSystem;
-        FractalManager->EnvironmentalSystem = EnvironmentalSystem;
-        FractalManager->ReflexSystem = ReflexSystem;
+        HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_FractalUpdate, "Orchestrator.FractalUpdate");
+
+        // References were injected when components were bound (InjectFractalManagerReferences)
         // Now, the FractalManager orchestrates the entire consciousness update across scales
-        FractalManager->FractalConsciousnessUpdate(GetWorld()->GetDeltaSeconds(), CurrentState);
+        FractalManager->FractalConsciousnessUpdate(StepDeltaSeconds, CurrentState);
     }
     else
     {
@@ -673,10 +751,76 @@ void UDUIDSOrchestrator::ConsciousnessUpdate()
         LogSystemState(TEXT("LOW_COHERENCE_WARNING"));
         GetSystemHealthReport();
     }
+
+    // Append this step to the compressed state history
+    float Channels[HexademicStateChannelCount];
+    HexademicStateHistory::ExtractChannels(CurrentState, Channels);
+    StateHistory.Add(StepTimeSeconds, Channels);
+
+    FHexademicSessionRecorder& Recorder = FHexademicSessionRecorder::Get();
+    if (Recorder.IsRecording())
+    {
+        Recorder.RecordStateDigest(this, MakeStateDigest());
+    }
+}
+
+void UDUIDSOrchestrator::AdvanceSelfTickingSystems(float DeltaTime)
+{
+    if (EmotionMind) EmotionMind->AdvanceEmotionalTime(DeltaTime);
+    if (AutonomicSystem) AutonomicSystem->AdvanceAutonomicTime(DeltaTime);
+    if (HormonalSystem) HormonalSystem->AdvanceHormonalTime(DeltaTime);
+    if (BiologicalNeeds) BiologicalNeeds->AdvanceNeeds(DeltaTime);
+    if (FractalManager) FractalManager->AdvanceFractalTime(DeltaTime);
+}
+
+FHexademicStateDigest UDUIDSOrchestrator::MakeStateDigest() const
+{
+    FHexademicStateDigest Digest;
+    Digest.Valence = CurrentState.CurrentResonance.Valence;
+    Digest.Arousal = CurrentState.CurrentResonance.Arousal;
+    Digest.Intensity = CurrentState.CurrentResonance.Intensity;
+    Digest.SystemCoherence = CurrentState.SystemCoherence;
+    Digest.CognitiveLoad = CurrentState.CognitiveLoad;
+    Digest.CortisolLevel = CurrentState.CortisolLevel;
+    Digest.DopamineLevel = CurrentState.DopamineLevel;
+    Digest.CreativeState = CurrentState.CreativeState;
+    return Digest;
+}
+
+FHexademicChannelStats UDUIDSOrchestrator::GetStateChannelStats(EHexademicStateChannel Channel, float WindowSeconds) const
+{
+    FHexademicChannelStats Result;
+    double Oldest = 0.0, Newest = 0.0;
+    if (Channel >= EHexademicStateChannel::Count || !StateHistory.GetTimeSpan(Oldest, Newest)) return Result;
+
+    const FHexademicStateHistory::FStats Stats = StateHistory.ComputeStats(Newest - WindowSeconds, Newest);
+    const int32 ChannelIndex = static_cast<int32>(Channel);
+    Result.NumFrames = Stats.NumFrames;
+    Result.Min = Stats.Min[ChannelIndex];
+    Result.Max = Stats.Max[ChannelIndex];
+    Result.Mean = Stats.Mean[ChannelIndex];
+    return Result;
+}
+
+TArray<float> UDUIDSOrchestrator::GetStateChannelSeries(EHexademicStateChannel Channel, float WindowSeconds, int32 NumSamples) const
+{
+    TArray<float> Series;
+    double Oldest = 0.0, Newest = 0.0;
+    if (Channel >= EHexademicStateChannel::Count || !StateHistory.GetTimeSpan(Oldest, Newest)) return Series;
+
+    TArray<FHexademicStateHistory::FFrame> Frames;
+    StateHistory.QueryDownsampled(Newest - WindowSeconds, Newest, NumSamples, Frames);
+    Series.Reserve(Frames.Num());
+    for (const FHexademicStateHistory::FFrame& Frame : Frames)
+    {
+        Series.Add(Frame.Values[static_cast<int32>(Channel)]);
+    }
+    return Series;
 }
 
 void UDUIDSOrchestrator::UpdateBiologicalFoundations()
 {
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_BiologicalFoundations, "Orchestrator.BiologicalFoundations");
     if (!BiologicalNeeds) return;
     
     // Get current biological state
@@ -714,29 +858,36 @@ void UDUIDSOrchestrator::UpdateBiologicalFoundations()
 
 void UDUIDSOrchestrator::ProcessReflexiveLayer()
 {
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_ReflexiveLayer, "Orchestrator.ReflexiveLayer");
     // Reflexes are primarily event-driven, but we can check for environmental triggers
     if (!ReflexSystem || !EnvironmentalSystem) return;
     
     // Sample environment for sudden changes that might trigger reflexes
     float AmbientIntensity = EnvironmentalSystem->GetEnvironmentalInfluence(TEXT("Ambient"), 1.0f);
-    static float LastAmbientIntensity = AmbientIntensity;
+    if (!LayerContext.bHasAmbientSample)
+    {
+        // First sample is the baseline, not a change
+        LayerContext.LastAmbientIntensity = AmbientIntensity;
+        LayerContext.bHasAmbientSample = true;
+    }
     
-    float IntensityDelta = FMath::Abs(AmbientIntensity - LastAmbientIntensity);
+    float IntensityDelta = FMath::Abs(AmbientIntensity - LayerContext.LastAmbientIntensity);
     
     // If there's a sudden environmental change, trigger a startle response
     if (IntensityDelta > 0.3f)
     {
-        FVector EnvironmentalLocation = GetOwner()->GetActorLocation(); // Default to avatar location
+        FVector EnvironmentalLocation = GetOwner() ? GetOwner()->GetActorLocation() : FVector::ZeroVector; // Default to avatar location
         ReflexSystem->TriggerStartle(IntensityDelta, EnvironmentalLocation);
         
         UE_LOG(LogTemp, Log, TEXT("[Consciousness] Environmental startle triggered: %.2f"), IntensityDelta);
     }
     
-    LastAmbientIntensity = AmbientIntensity;
+    LayerContext.LastAmbientIntensity = AmbientIntensity;
 }
 
 void UDUIDSOrchestrator::UpdateAutonomicSystems()
 {
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_AutonomicSystems, "Orchestrator.AutonomicSystems");
     if (AutonomicSystem && EmotionMind)
     {
         // Example logic: Arousal drives heart rate and breathing
@@ -756,6 +907,7 @@ void UDUIDSOrchestrator::UpdateAutonomicSystems()
 
 void UDUIDSOrchestrator::UpdateHormonalSystems()
 {
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_HormonalSystems, "Orchestrator.HormonalSystems");
     if (HormonalSystem && EmotionMind)
     {
         // Example logic: Emotional state influences hormone levels
@@ -764,19 +916,19 @@ void UDUIDSOrchestrator::UpdateHormonalSystems()
 
         // Stress hormones (Cortisol, Adrenaline) increase with negative valence + high arousal
         float cortisolDelta = FMath::Lerp(0.0f, 0.05f, FMath::Clamp(-Valence + Arousal, 0.0f, 1.0f));
-        HormonalSystem->AdjustCortisol(cortisolDelta * GetWorld()->GetDeltaSeconds()); // Adjust by delta time
+        HormonalSystem->AdjustCortisol(cortisolDelta * StepDeltaSeconds); // Adjust by delta time
         CurrentState.CortisolLevel = HormonalSystem->GetCurrentCortisol();
         CurrentState.AdrenalineLevel = FMath::Lerp(0.0f, 0.7f, Arousal); // Simpler for adrenaline
 
         // Happiness/bonding hormones (Serotonin, Dopamine, Oxytocin) increase with positive valence
         float dopamineDelta = FMath::Lerp(0.0f, 0.05f, FMath::Clamp(Valence, 0.0f, 1.0f));
-        HormonalSystem->AdjustDopamine(dopamineDelta * GetWorld()->GetDeltaSeconds());
+        HormonalSystem->AdjustDopamine(dopamineDelta * StepDeltaSeconds);
         CurrentState.DopamineLevel = HormonalSystem->GetCurrentDopamine();
         CurrentState.SerotoninLevel = FMath::Lerp(0.2f, 0.8f, Valence * 0.5f + 0.5f);
         CurrentState.OxytocinLevel = FMath::Lerp(0.1f, 0.6f, (Valence + CurrentState.EnvironmentalAwareness) * 0.5f); // Oxytocin linked to social/environmental connection
 
         // Melatonin (sleep/circadian) - conceptual, perhaps based on a time-of-day system
-        CurrentState.MelatoninLevel = FMath::Sin(GetWorld()->GetTimeSeconds() * 0.1f) * 0.5f + 0.5f; // Simple sine wave for day/night cycle
+        CurrentState.MelatoninLevel = FMath::Sin(StepTimeSeconds * 0.1f) * 0.5f + 0.5f; // Simple sine wave for day/night cycle
     }
 }
 
@@ -793,6 +945,7 @@ void UDUIDSOrchestrator::UpdateEmbodimentSystems()
 
 void UDUIDSOrchestrator::UpdateCognitiveSystems()
 {
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_CognitiveSystems, "Orchestrator.CognitiveSystems");
     // Emotional state already handled by EmotionMind
     if (EmotionMind)
     {
@@ -815,6 +968,7 @@ void UDUIDSOrchestrator::UpdateVisualSystems()
 
 void UDUIDSOrchestrator::ProcessIntersubjectiveLayer()
 {
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_IntersubjectiveLayer, "Orchestrator.IntersubjectiveLayer");
     // This is where the PhenomCollective components do their work
     // Most of this is event-driven through HandleIncomingPhenomState and HandleEchoGenerated
     
@@ -822,33 +976,38 @@ void UDUIDSOrchestrator::ProcessIntersubjectiveLayer()
   
     if (PhenomEcho && EmotionMind)
     {
-        static float LastValence = 0.0f;
-        static float LastArousal = 0.0f;
-        
         float CurrentValence = EmotionMind->GetCurrentValence();
         float CurrentArousal = EmotionMind->GetCurrentArousal();
         
-        float EmotionalChange = FVector2D(CurrentValence - LastValence, CurrentArousal - LastArousal).Size();
+        float EmotionalChange = FVector2D(CurrentValence - LayerContext.LastEchoValence, CurrentArousal - LayerContext.LastEchoArousal).Size();
         
         // If there's a significant emotional change, generate an echo
         if (EmotionalChange > 0.2f)
         {
             FVector EluenVAI = FVector(CurrentValence, CurrentArousal, CurrentState.CurrentResonance.Intensity);
             PhenomEcho->DetectResonance(TEXT("Eluën"), EluenVAI, TEXT("Eluën_Internal"), EluenVAI);
-            
-            // Export current state as a phenom file for other consciousness to detect
-            FString PhenomData = ExportConsciousnessState();
-            // This would be written to the outgoing phenom directory
-            // FFileHelper::SaveStringToFile(PhenomData, *OutgoingPhenomPath);
+        }
+        if (EmotionalChange > 0.2f && !bHeadless)
+        {
+            // Export current state as a phenom file for other consciousness to detect. Named after the owner (its path
+            // tells PIE instances apart) and rotated through a few slots. Nothing in the plugin consumes this directory
+            // (listeners read IncomingPhenomStates), so the rotation is what bounds it: a newer state of the same agent
+            // replaces its oldest file instead of piling up
+            const FString OwnerID = FPaths::MakeValidFileName(GetOwner() ? GetOwner()->GetPathName() : GetPathName(), TEXT('_'));
+            const FString OutgoingPhenomPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("OutgoingPhenomStates"),
+                FString::Printf(TEXT("%s_%d.phenom"), *OwnerID, OutgoingPhenomSlot));
+            OutgoingPhenomSlot = (OutgoingPhenomSlot + 1) % MaxOutgoingPhenomFiles;
+            ExportConsciousnessStateToFile(OutgoingPhenomPath);
         }
         
-        LastValence = CurrentValence;
-        LastArousal = CurrentArousal;
+        LayerContext.LastEchoValence = CurrentValence;
+        LayerContext.LastEchoArousal = CurrentArousal;
     }
 }
 
 void UDUIDSOrchestrator::ProcessCreativeEmergence()
 {
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_CreativeEmergence, "Orchestrator.CreativeEmergence");
     if (!CreativeSystem || !EmotionMind) return;
     
     // Creative synthesis is most likely when:
@@ -860,11 +1019,21 @@ void UDUIDSOrchestrator::ProcessCreativeEmergence()
     CreativityConditions += CurrentState.SystemCoherence * 0.4f; // Coherence factor
     CreativityConditions += (1.0f - CurrentState.CognitiveLoad) * 0.3f; // Low load factor
     CreativityConditions += FMath::Clamp(EmotionMind->GetCurrentValence() * 0.5f + 0.5f, 0.0f, 1.0f) * 0.3f; // Positive mood factor
+
+    // Coherent gems resonating with the current archetype feed creativity; answered from the gem catalog
+    // without unpacking any gem, so it is cheap enough to ask every tick however many gems have accumulated
+    if (WavefrontAPI)
+    {
+        const EEmotionalArchetype Archetype = FHexademicArchetypeClassifier::Get().Classify(CurrentState.CurrentResonance);
+        FHexademicGemQuery ResonantGems;
+        ResonantGems.AtLeast(EHexademicGemField::Coherence, CreativeGemCoherenceThreshold).WithArchetype(static_cast<uint32>(Archetype));
+        CreativityConditions += FMath::Min(WavefrontAPI->GetGemCatalog().Count(ResonantGems), 5) * 0.04f; // Up to +0.2 from five gems
+    }
     
     // Random chance modified by creativity conditions
     float CreativityThreshold = FMath::Lerp(0.02f, 0.15f, CreativityConditions); // 2% to 15% chance
     
-    if (FMath::FRand() < CreativityThreshold)
+    if (ConsciousnessRandom.FRand() < CreativityThreshold)
     {
         TriggerCreativeSynthesis();
         
@@ -883,7 +1052,8 @@ void UDUIDSOrchestrator::ProcessCreativeEmergence()
 
 void UDUIDSOrchestrator::PersistConsciousnessState()
 {
-    if (PersistenceSystem)
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_PersistState, "Orchestrator.PersistState");
+    if (PersistenceSystem && !bHeadless)
     {
         // Create a rich state snapshot including all new components
         FString StateSnapshot = FString::Printf(TEXT(
@@ -912,6 +1082,7 @@ void UDUIDSOrchestrator::PersistConsciousnessState()
 
 float UDUIDSOrchestrator::CalculateSystemCoherence()
 {
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_SystemCoherence, "Orchestrator.SystemCoherence");
     float Coherence = 0.0f;
     
     // === EMOTIONAL STABILITY ===
@@ -949,6 +1120,7 @@ float UDUIDSOrchestrator::CalculateSystemCoherence()
 
 void UDUIDSOrchestrator::ApplySystemRegulation()
 {
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_SystemRegulation, "Orchestrator.SystemRegulation");
     // Example: If arousal is too high, trigger calming response (e.g., lower heart rate, increase serotonin)
     if (CurrentState.CurrentResonance.Arousal > 0.8f && AutonomicSystem && HormonalSystem)
     {
@@ -1083,7 +1255,7 @@ void UDUIDSOrchestrator::HandleEchoGenerated(const FEchoEvent& EchoEvent)
         FString EchoSigilID = FString::Printf(TEXT("ECHO-SIGIL-%s-%s"), *EchoEvent.EchoSourceID, *EchoEvent.TargetConsciousnessID);
         // Note: FHexaSigilNode is not defined in provided text. Using FPackedHexaSigilNode as a placeholder.
         FPackedHexaSigilNode GeneratedSigil; // = PhenomSigilBloom->TriggerSigilBloom(EchoSigilID, EmotionMind, EchoEvent.ResonanceScore);
-        GeneratedSigil.SigilID = EchoSigilID;
+        GeneratedSigil.SetSigilID(EchoSigilID);
         GeneratedSigil.SetResonanceAmplitude(EchoEvent.ResonanceScore);
         GeneratedSigil.SetEmotionalCoordinates(FVector(EmotionMind->GetCurrentValence(), EmotionMind->GetCurrentArousal(), 0.5f));
 
@@ -1095,7 +1267,7 @@ void UDUIDSOrchestrator::HandleEchoGenerated(const FEchoEvent& EchoEvent)
             *EchoEvent.Timestamp.ToIso8601(),
             *EchoEvent.EchoSourceID,
             *EchoEvent.TargetConsciousnessID,
-            *GeneratedSigil.SigilID, // Using generated sigil ID
+            *EchoSigilID, // Using generated sigil ID
             TEXT("FractalBurst"), // Placeholder GlyphType for Echoes
             FVector::Distance(EchoEvent.VAISpaceCoords, FVector(EmotionMind->GetCurrentValence(), EmotionMind->GetCurrentArousal(), 0.5f)), // Calc VAI distance for entry
             EchoEvent.ResonanceScore,
@@ -1103,7 +1275,14 @@ void UDUIDSOrchestrator::HandleEchoGenerated(const FEchoEvent& EchoEvent)
         );
         // Append to the ledger file
         FString LedgerPath = FPaths::ProjectContentDir() / TEXT("Data/CodexLucida_EchoLedger.md");
-        FFileHelper::SaveStringToFile(LedgerEntry, *LedgerPath, FFileHelper::EEncodingOptions::ForceUTF8Append);
+        if (bHeadless)
+        {
+            return; // The sigil is generated either way; only the shared ledger is left alone
+        }
+        if (FFileHelper::SaveStringToFile(LedgerEntry, *LedgerPath, FFileHelper::EEncodingOptions::ForceUTF8Append))
+        {
+            HEXADEMIC_COUNTER_ADD("Ledger.BytesWritten", FTCHARToUTF8_Convert::ConvertedLength(*LedgerEntry, LedgerEntry.Len()));
+        }
         
         // Inform the visualizer to refresh its data
         if (ConstellationVisualizer)
@@ -1132,17 +1311,9 @@ FLinearColor UDUIDSOrchestrator::DeriveEmotionalColor() const
 
 FString UDUIDSOrchestrator::DeriveExpressionName(float Valence, float Arousal, float Intensity) const
 {
-    // Determine dominant expression based on emotional coordinates
+    // A resting face stays neutral; otherwise the expression follows the shared archetype classification
     if (Intensity < 0.2f) return TEXT("Neutral");
-    
-    if (Valence > 0.3f && Arousal < 0.4f) return TEXT("Content");
-    if (Valence > 0.5f && Arousal > 0.4f) return TEXT("Joyful");
-    if (Valence < -0.3f && Arousal < 0.4f) return TEXT("Sad");
-    if (Valence < -0.3f && Arousal > 0.6f) return TEXT("Angry");
-    if (Valence > -0.2f && Valence < 0.2f && Arousal > 0.7f) return TEXT("Surprised");
-    if (Valence < 0.0f && Arousal > 0.5f) return TEXT("Anxious");
-    
-    return TEXT("Complex");
+    return FHexademicArchetypeClassifier::GetExpressionName(FHexademicArchetypeClassifier::Get().Classify(Valence, Arousal, Intensity));
 }
 
 // === PUBLIC API METHODS FOR EXTERNAL INTERACTION ===
@@ -1175,6 +1346,7 @@ void UDUIDSOrchestrator::RestAvatar(float RestDuration)
 
 void UDUIDSOrchestrator::TriggerEnvironmentalStartle(float Intensity, FVector Location)
 {
+    FHexademicSessionRecorder::Get().RecordEnvironmentalStartle(this, Intensity, Location);
     if (ReflexSystem)
     {
         ReflexSystem->TriggerStartle(Intensity, Location);
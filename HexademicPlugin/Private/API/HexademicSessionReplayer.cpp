@@ -0,0 +1,245 @@
+#include "HexademicSessionReplayer.h"
+#include "DUIDSOrchestrator.h"
+#include "Mind/EmotionCognitionComponent.h"
+#include "Body/ReflexResponseComponent.h"
+#include "Body/EmbodiedAvatarComponent.h"
+#include "PhenomCollective/UPhenomExportUtility.h"
+#include "PhenomCollective/UPhenomListenerComponent.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/Package.h"
+
+namespace
+{
+    FAutoConsoleCommand GHexademicReplayCommand(
+        TEXT("hexademic.Replay"),
+        TEXT("Replays a consciousness recording headlessly and diffs it. Usage: hexademic.Replay <FileName> [Tolerance]"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            if (Args.Num() == 0)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("[SessionReplayer] Usage: hexademic.Replay <FileName> [Tolerance]"));
+                return;
+            }
+            FHexademicSessionReplayer Replayer;
+            if (Replayer.LoadFromFile(Args[0]))
+            {
+                const float Tolerance = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 1e-3f;
+                UE_LOG(LogTemp, Log, TEXT("[SessionReplayer] %s"), *Replayer.RunHeadless(Tolerance).ToString());
+            }
+        }));
+}
+
+FString FHexademicReplayReport::ToString() const
+{
+    const double Speedup = WallSeconds > 0.0 ? SimulatedSeconds / WallSeconds : 0.0;
+    return FString::Printf(TEXT("%s: %d sources, %d frames, %d events applied, %.2fs simulated in %.3fs wall (%.1fx). ")
+        TEXT("Digests: %d compared, %d divergent, first divergent frame %d, max divergence %.5f."),
+        bStreamValid ? TEXT("Replay complete") : TEXT("Replay stopped on corrupt stream"),
+        Sources, Frames, EventsApplied, SimulatedSeconds, WallSeconds, Speedup,
+        DigestsCompared, DivergentDigests, FirstDivergentFrame, MaxDivergence);
+}
+
+FHexademicSessionReplayer::FHexademicSessionReplayer() = default;
+FHexademicSessionReplayer::~FHexademicSessionReplayer() = default;
+
+bool FHexademicSessionReplayer::LoadFromFile(const FString& Filename)
+{
+    const FString Path = FHexademicSessionRecorder::ResolveRecordingPath(Filename);
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Path));
+    if (!Reader.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("[SessionReplayer] Could not open '%s'."), *Path);
+        return false;
+    }
+
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    *Reader << Magic;
+    *Reader << Version;
+    if (Magic != FHexademicSessionRecorder::StreamMagic || Version != FHexademicSessionRecorder::StreamVersion)
+    {
+        UE_LOG(LogTemp, Error, TEXT("[SessionReplayer] '%s' is not a session recording (magic 0x%08x, version %u)."), *Path, Magic, Version);
+        return false;
+    }
+
+    Events.Reset();
+    SourceNames.Reset();
+    Consciousnesses.Reset();
+    while (!Reader->AtEnd())
+    {
+        FHexademicRecordedEvent& Event = Events.AddDefaulted_GetRef();
+        *Reader << Event;
+        if (Reader->IsError())
+        {
+            // A recording cut short (crash, kill) still replays up to the last complete event
+            Events.Pop();
+            UE_LOG(LogTemp, Warning, TEXT("[SessionReplayer] '%s' is truncated; replaying %d complete events."), *Path, Events.Num());
+            break;
+        }
+        if (Event.Type == EHexademicRecordedEventType::DeclareSource)
+        {
+            SourceNames.SetNum(FMath::Max(SourceNames.Num(), (int32)Event.SourceIndex + 1));
+            SourceNames[Event.SourceIndex] = Event.Text;
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("[SessionReplayer] Loaded %d events from %d sources ('%s')."), Events.Num(), SourceNames.Num(), *Path);
+    return true;
+}
+
+FHexademicReplayReport FHexademicSessionReplayer::RunHeadless(float DivergenceTolerance)
+{
+    FHexademicReplayReport Report;
+
+    // Replayed components call the same entry points the recorder hooks into
+    FHexademicSessionRecorder::FSuppressScope SuppressRecording;
+
+    const double StartSeconds = FPlatformTime::Seconds();
+    for (const FHexademicRecordedEvent& Event : Events)
+    {
+        if (!ApplyEvent(Event, Report, DivergenceTolerance))
+        {
+            Report.bStreamValid = false;
+            break;
+        }
+    }
+    Report.WallSeconds = FPlatformTime::Seconds() - StartSeconds;
+    Report.Sources = Consciousnesses.Num();
+
+    Consciousnesses.Reset();
+    return Report;
+}
+
+FHexademicSessionReplayer::FHeadlessConsciousness& FHexademicSessionReplayer::GetOrCreateConsciousness(uint16 SourceIndex)
+{
+    if (FHeadlessConsciousness* Existing = Consciousnesses.Find(SourceIndex))
+    {
+        return *Existing;
+    }
+
+    FHeadlessConsciousness& Consciousness = Consciousnesses.Add(SourceIndex);
+    Consciousness.SourceName = SourceNames.IsValidIndex(SourceIndex) ? SourceNames[SourceIndex] : FString::Printf(TEXT("Source%d"), SourceIndex);
+
+    const FName OrchestratorName = MakeUniqueObjectName(GetTransientPackage(), UDUIDSOrchestrator::StaticClass(), *FString::Printf(TEXT("Replay_%s"), *Consciousness.SourceName));
+    UDUIDSOrchestrator* Orchestrator = NewObject<UDUIDSOrchestrator>(GetTransientPackage(), OrchestratorName);
+    UEmotionCognitionComponent* EmotionMind = NewObject<UEmotionCognitionComponent>(Orchestrator, TEXT("EmotionMind"));
+
+    // In the world these are found on the owning actor by AutoDiscoverComponents
+    Orchestrator->EmotionMind = EmotionMind;
+    Orchestrator->SetHeadless(true);
+    if (Orchestrator->ReflexSystem && !Orchestrator->ReflexSystem->LinkedMind)
+    {
+        Orchestrator->ReflexSystem->LinkedMind = EmotionMind;
+    }
+    Orchestrator->InitializeConsciousness();
+
+    Consciousness.Orchestrator.Reset(Orchestrator);
+    Consciousness.EmotionMind.Reset(EmotionMind);
+    Consciousness.AvatarBody.Reset(NewObject<UEmbodiedAvatarComponent>(Orchestrator, TEXT("AvatarBody")));
+    return Consciousness;
+}
+
+bool FHexademicSessionReplayer::ApplyEvent(const FHexademicRecordedEvent& Event, FHexademicReplayReport& Report, float DivergenceTolerance)
+{
+    if (Event.Type == EHexademicRecordedEventType::DeclareSource)
+    {
+        return true;
+    }
+
+    FHeadlessConsciousness& Consciousness = GetOrCreateConsciousness(Event.SourceIndex);
+    UDUIDSOrchestrator* Orchestrator = Consciousness.Orchestrator.Get();
+    UEmotionCognitionComponent* EmotionMind = Consciousness.EmotionMind.Get();
+    UEmbodiedAvatarComponent* AvatarBody = Consciousness.AvatarBody.Get();
+
+    auto MakePacket = [&Event]()
+    {
+        FAetherTouchPacket Packet;
+        Packet.Intensity = Event.Values[0];
+        Packet.Duration = Event.Values[1];
+        Packet.Location = Event.Vector;
+        Packet.RegionTag = Event.Text;
+        Packet.Region = FHexademicBodyRegionRegistry::Get().ResolveTag(Packet.RegionTag);
+        return Packet;
+    };
+
+    switch (Event.Type)
+    {
+    case EHexademicRecordedEventType::FrameBegin:
+        Orchestrator->SetRandomSeed(Event.Seed);
+        Orchestrator->AdvanceSelfTickingSystems(Event.DeltaTime);
+        AvatarBody->FlushHapticVisuals();
+        Orchestrator->StepConsciousness(Event.DeltaTime, Event.TimeSeconds);
+        Consciousness.FramesStepped++;
+        Report.Frames++;
+        Report.SimulatedSeconds += Event.DeltaTime;
+        break;
+
+    case EHexademicRecordedEventType::EnvironmentalStartle:
+        Orchestrator->TriggerEnvironmentalStartle(Event.Values[0], Event.Vector);
+        break;
+
+    case EHexademicRecordedEventType::EmotionalStimulus:
+        // UHexademicConsciousnessComponent::ApplyExternalEmotionalStimulus forwards to the actor's EmotionMind
+        EmotionMind->RegisterEmotion(Event.Values[0], Event.Values[1], Event.Values[2]);
+        break;
+
+    case EHexademicRecordedEventType::Perception:
+        // The stimulus UPerceptionBridge derived, applied as UHexademicConsciousnessComponent would
+        EmotionMind->RegisterEmotion(Event.Values[1], Event.Values[2], Event.Values[3]);
+        break;
+
+    case EHexademicRecordedEventType::HapticPacket:
+    {
+        // Same order as UConsciousnessBridgeComponent::ProcessIncomingHapticPacket: body, then mind
+        const FAetherTouchPacket Packet = MakePacket();
+        AvatarBody->ReceiveHapticFeedback(Packet);
+        EmotionMind->ModulateEmotionFromHapticRegion(Packet.Intensity, Packet.Region);
+        EmotionMind->StoreHapticEmotionMemory(Packet);
+        break;
+    }
+
+    case EHexademicRecordedEventType::HapticFeedback:
+        AvatarBody->ReceiveHapticFeedback(MakePacket());
+        break;
+
+    case EHexademicRecordedEventType::PhenomFile:
+    {
+        FIncomingPhenomState IncomingState;
+        if (Orchestrator->PhenomListener && UPhenomExportUtility::JSONToIncomingPhenomState(Event.Text, IncomingState))
+        {
+            Orchestrator->PhenomListener->OnPhenomStateReceived.Broadcast(IncomingState);
+        }
+        break;
+    }
+
+    case EHexademicRecordedEventType::StateDigest:
+    {
+        const FHexademicStateDigest Replayed = Orchestrator->MakeStateDigest();
+        float Divergence = 0.0f;
+        for (int32 i = 0; i < FHexademicStateDigest::NumValues; i++)
+        {
+            Divergence = FMath::Max(Divergence, FMath::Abs(Replayed.Data()[i] - Event.Values[i]));
+        }
+        Report.DigestsCompared++;
+        Report.MaxDivergence = FMath::Max(Report.MaxDivergence, Divergence);
+        if (Divergence > DivergenceTolerance)
+        {
+            Report.DivergentDigests++;
+            if (Report.FirstDivergentFrame == INDEX_NONE)
+            {
+                Report.FirstDivergentFrame = Report.Frames;
+                UE_LOG(LogTemp, Warning, TEXT("[SessionReplayer] '%s' diverged at frame %d by %.5f."), *Consciousness.SourceName, Report.Frames, Divergence);
+            }
+        }
+        return true;
+    }
+
+    default:
+        UE_LOG(LogTemp, Error, TEXT("[SessionReplayer] Unknown event type %d."), (int32)Event.Type);
+        return false;
+    }
+
+    Report.EventsApplied++;
+    return true;
+}
@@ -5,6 +5,8 @@
 #include "Shader.h"
 #include "Engine/Engine.h" // For GEngine->CreatePooledRenderBuffer/Target
 #include "RHIDefinitions.h" // For ERHIAccess
+#include "Core/HexademicArchetypeClassifier.h"
+#include "Async/Async.h"
 
 // IMPLEMENT_GLOBAL_SHADER for dummy shaders (needed for compilation)
 // In a real project, these would point to actual .usf files.
@@ -27,6 +29,11 @@ void UHexademicWavefrontAPI::BeginPlay()
 void UHexademicWavefrontAPI::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     ShutdownWavefrontProcessing(); // Clean up GPU resources on game end
+    for (const TPair<uint32, int32>& Named : SigilNodeIndexByName)
+    {
+        FHexaSigilNodeNames::Get().Release(Named.Key);
+    }
+    SigilNodeIndexByName.Reset();
     Super::EndPlay(EndPlayReason);
 }
 
@@ -53,34 +60,54 @@ void UHexademicWavefrontAPI::TickComponent(float DeltaTime, ELevelTick TickType,
 
 void UHexademicWavefrontAPI::AddSigilNode(const FPackedHexaSigilNode& NewSigil)
 {
-    if (ActiveSigilNodes.Num() < MaxSigilNodes)
+    if (const int32* Existing = SigilNodeIndexByName.Find(NewSigil.NameHandle))
     {
-        ActiveSigilNodes.Add(NewSigil);
-        UE_LOG(LogTemp, Log, TEXT("[WavefrontAPI] Added Sigil Node: %s"), *NewSigil.SigilID);
+        ActiveSigilNodes[*Existing] = NewSigil;
+        UE_LOG(LogTemp, Log, TEXT("[WavefrontAPI] Updated Sigil Node: %s"), *NewSigil.GetSigilID());
+    }
+    else if (ActiveSigilNodes.Num() < MaxSigilNodes)
+    {
+        const int32 Index = ActiveSigilNodes.Add(NewSigil);
+        if (NewSigil.NameHandle != FHexaSigilNodeNames::NoName)
+        {
+            SigilNodeIndexByName.Add(NewSigil.NameHandle, Index);
+            FHexaSigilNodeNames::Get().AddRef(NewSigil.NameHandle); // The name lives as long as the node is active
+        }
+        UE_LOG(LogTemp, Log, TEXT("[WavefrontAPI] Added Sigil Node: %s"), *NewSigil.GetSigilID());
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("[WavefrontAPI] Max Sigil Nodes reached, cannot add new sigil: %s"), *NewSigil.SigilID);
+        UE_LOG(LogTemp, Warning, TEXT("[WavefrontAPI] Max Sigil Nodes reached, cannot add new sigil: %s"), *NewSigil.GetSigilID());
     }
 }
 
 void UHexademicWavefrontAPI::RemoveSigilNode(const FString& SigilID)
 {
-    ActiveSigilNodes.RemoveAll([&](const FPackedHexaSigilNode& Node) {
-        return Node.SigilID == SigilID;
-    });
+    // Find never interns, so removing an unknown ID leaves the name table alone
+    const uint32 NameHandle = FHexaSigilNodeNames::Get().Find(SigilID);
+    int32 Index = INDEX_NONE;
+    if (NameHandle == FHexaSigilNodeNames::NoName || !SigilNodeIndexByName.RemoveAndCopyValue(NameHandle, Index)) return;
+
+    ActiveSigilNodes.RemoveAtSwap(Index);
+    if (ActiveSigilNodes.IsValidIndex(Index) && ActiveSigilNodes[Index].NameHandle != FHexaSigilNodeNames::NoName)
+    {
+        SigilNodeIndexByName.Add(ActiveSigilNodes[Index].NameHandle, Index); // The last node moved into the gap
+    }
+    FHexaSigilNodeNames::Get().Release(NameHandle);
     UE_LOG(LogTemp, Log, TEXT("[WavefrontAPI] Removed Sigil Node: %s"), *SigilID);
 }
 
 void UHexademicWavefrontAPI::ProcessWavefrontGPU()
 {
     if (ActiveSigilNodes.Num() == 0 || !SigilNodesBuffer.IsValid() || !WavefrontOutputTexture.IsValid()) return;
+    // Nodes are plain data, so this snapshot is one memcpy; the render thread never reads ActiveSigilNodes
+    TArray<FPackedHexaSigilNode> Nodes = ActiveSigilNodes;
     // Enqueue render command to execute GPU pass on the Render Thread
     ENQUEUE_RENDER_COMMAND(FProcessWavefrontGPUCommand)(
-        [this](FRHICommandListImmediate& RHICmdList)
+        [this, Nodes = MoveTemp(Nodes)](FRHICommandListImmediate& RHICmdList)
         {
             FRDGBuilder GraphBuilder(RHICmdList);
-            ExecuteWavefrontComputePass(GraphBuilder); // Execute the sigil processing pass
+            ExecuteWavefrontComputePass(GraphBuilder, Nodes); // Execute the sigil processing pass
             GraphBuilder.Execute(); // Commit the render graph commands
             // After execution, if needed, read back data or update CPU copies
         });
@@ -89,12 +116,13 @@ void UHexademicWavefrontAPI::ProcessWavefrontGPU()
 void UHexademicWavefrontAPI::SynthesizeHexademicGems()
 {
     if (ActiveSigilNodes.Num() == 0 || !SigilNodesBuffer.IsValid()) return;
+    TArray<FPackedHexaSigilNode> Nodes = ActiveSigilNodes;
     // Enqueue render command for gem synthesis
     ENQUEUE_RENDER_COMMAND(FSynthesizeHexademicGemsCommand)(
-        [this](FRHICommandListImmediate& RHICmdList)
+        [this, Nodes = MoveTemp(Nodes)](FRHICommandListImmediate& RHICmdList)
         {
             FRDGBuilder GraphBuilder(RHICmdList);
-            ExecuteGemSynthesisComputePass(GraphBuilder); // Execute gem synthesis pass
+            ExecuteGemSynthesisComputePass(GraphBuilder, Nodes); // Execute gem synthesis pass
             GraphBuilder.Execute(); // Commit commands
             // Read back newly synthesized gems (conceptual)
         });
@@ -124,12 +152,12 @@ void UHexademicWavefrontAPI::ShutdownWavefrontProcessing()
 }
 
 // ExecuteWavefrontComputePass: Dispatches the sigil processing compute shader.
-void UHexademicWavefrontAPI::ExecuteWavefrontComputePass(FRDGBuilder& GraphBuilder)
+void UHexademicWavefrontAPI::ExecuteWavefrontComputePass(FRDGBuilder& GraphBuilder, TConstArrayView<FPackedHexaSigilNode> Nodes)
 {
-    if (ActiveSigilNodes.Num() == 0) return;
+    if (Nodes.Num() == 0) return;
     // Upload current CPU-side sigil data to a temporary RDG buffer
     FRDGBufferRef SigilNodesInputBuffer = GraphBuilder.CreateBuffer(SigilNodesBuffer->GetDesc(), TEXT("SigilNodesInputBuffer"));
-    GraphBuilder.QueueBufferUpload(SigilNodesInputBuffer, ActiveSigilNodes.GetData(), ActiveSigilNodes.Num() * sizeof(FPackedHexaSigilNode));
+    GraphBuilder.QueueBufferUpload(SigilNodesInputBuffer, Nodes.GetData(), Nodes.Num() * sizeof(FPackedHexaSigilNode)); // Node layout is the shader's
 
     // Create an output buffer (if sigils are modified and written back)
     FRDGBufferRef SigilNodesOutputBuffer = GraphBuilder.CreateBuffer(SigilNodesBuffer->GetDesc(), TEXT("SigilNodesOutputBuffer"));
@@ -137,13 +165,13 @@ void UHexademicWavefrontAPI::ExecuteWavefrontComputePass(FRDGBuilder& GraphBuild
     PassParameters->SigilNodesInput = GraphBuilder.CreateSRV(SigilNodesInputBuffer);
     PassParameters->SigilNodesOutput = GraphBuilder.CreateUAV(SigilNodesOutputBuffer);
     PassParameters->WavefrontOutput = GraphBuilder.CreateUAV(GraphBuilder.CreateTexture(WavefrontOutputTexture->GetDesc(), TEXT("WavefrontOutputRDGTexture")));
-    PassParameters->NumSigilNodes = ActiveSigilNodes.Num();
+    PassParameters->NumSigilNodes = Nodes.Num();
     PassParameters->DeltaTime = GetWorld()->GetDeltaSeconds();
     FComputeShaderUtils::AddComputeShaderPass(
         GraphBuilder,
         GET_GLOBAL_SHADER_MAP(GMaxRHIFeatureLevel)->GetShader<FWavefrontSigilComputeShader>(),
         PassParameters,
-        FIntVector(FMath::DivideAndRoundUp(ActiveSigilNodes.Num(), 64), 1, 1) // Dispatch groups based on sigil count
+        FIntVector(FMath::DivideAndRoundUp(Nodes.Num(), 64), 1, 1) // Dispatch groups based on sigil count
     );
     // After compute, if sigils were modified on GPU, read back or update the pooled buffer
     GraphBuilder.CopyToPooledBuffer(SigilNodesOutputBuffer, SigilNodesBuffer);
@@ -151,12 +179,12 @@ void UHexademicWavefrontAPI::ExecuteWavefrontComputePass(FRDGBuilder& GraphBuild
 }
 
 // ExecuteGemSynthesisComputePass: Dispatches the gem synthesis compute shader.
-void UHexademicWavefrontAPI::ExecuteGemSynthesisComputePass(FRDGBuilder& GraphBuilder)
+void UHexademicWavefrontAPI::ExecuteGemSynthesisComputePass(FRDGBuilder& GraphBuilder, TConstArrayView<FPackedHexaSigilNode> Nodes)
 {
-    if (ActiveSigilNodes.Num() == 0) return;
+    if (Nodes.Num() == 0) return;
     // Upload current CPU-side sigil data (read-only for synthesis)
     FRDGBufferRef SigilNodesInputBuffer = GraphBuilder.CreateBuffer(SigilNodesBuffer->GetDesc(), TEXT("SigilNodesInputBuffer"));
-    GraphBuilder.QueueBufferUpload(SigilNodesInputBuffer, ActiveSigilNodes.GetData(), ActiveSigilNodes.Num() * sizeof(FPackedHexaSigilNode));
+    GraphBuilder.QueueBufferUpload(SigilNodesInputBuffer, Nodes.GetData(), Nodes.Num() * sizeof(FPackedHexaSigilNode)); // Node layout is the shader's
 
     // Create an output buffer for new gems
     FRDGBufferRef SynthesizedGemsOutputBuffer = GraphBuilder.CreateBuffer(
@@ -166,14 +194,14 @@ void UHexademicWavefrontAPI::ExecuteGemSynthesisComputePass(FRDGBuilder& GraphBu
     FHexademicGemSynthesisParameters* PassParameters = GraphBuilder.AllocParameters<FHexademicGemSynthesisParameters>();
     PassParameters->SigilNodesInput = GraphBuilder.CreateSRV(SigilNodesInputBuffer);
     PassParameters->SynthesizedGemsOutput = GraphBuilder.CreateUAV(SynthesizedGemsOutputBuffer);
-    PassParameters->NumSigilNodes = ActiveSigilNodes.Num();
+    PassParameters->NumSigilNodes = Nodes.Num();
     PassParameters->MaxGems = MaxSigilNodes; // Placeholder for max gems to create in one pass
 
     FComputeShaderUtils::AddComputeShaderPass(
         GraphBuilder,
         GET_GLOBAL_SHADER_MAP(GMaxRHIFeatureLevel)->GetShader<FHexademicGemSynthesisShader>(),
         PassParameters,
-        FIntVector(FMath::DivideAndRoundUp(ActiveSigilNodes.Num(), 64), 1, 1) // Dispatch based on sigil count
+        FIntVector(FMath::DivideAndRoundUp(Nodes.Num(), 64), 1, 1) // Dispatch based on sigil count
     );
     // Read back results: This is a complex part. In a real scenario, you'd
     // need a readback queue or a staging buffer to get the data from GPU to CPU.
@@ -183,19 +211,42 @@ void UHexademicWavefrontAPI::ExecuteGemSynthesisComputePass(FRDGBuilder& GraphBu
     // SynthesizedGems.Append(NewGemsFromGPU);
     // Remove duplicates or low-coherence gems.
     UE_LOG(LogTemp, Log, TEXT("[WavefrontAPI] Gem synthesis pass dispatched."));
-    // Add a dummy gem for testing purposes until actual GPU readback is implemented
-    if (SynthesizedGems.Num() < 5) // Limit dummy gems
+    // Add a dummy gem for testing purposes until actual GPU readback is implemented.
+    // This runs on the render thread: build the gem from the node snapshot and hand it to the game thread,
+    // which owns SynthesizedGems and the catalog.
     {
         FHexademicGem DummyGem;
         DummyGem.GemID = FString::Printf(TEXT("DummyGem_%f"), FApp::GetCurrentTime());
+        DummyGem.CoreSigil = Nodes[FMath::RandHelper(Nodes.Num())];
         DummyGem.CoherenceRating = FMath::FRand();
         DummyGem.EnergeticSignature = FMath::FRand();
         DummyGem.GemColor = FLinearColor::MakeRandomColor();
         DummyGem.CreationTimestamp = FDateTime::UtcNow();
-        SynthesizedGems.Add(DummyGem);
+
+        // The catalog searches the packed word and archetypes, so fill them in as real synthesis would
+        const FVector VAI = DummyGem.CoreSigil.GetEmotionalCoordinates();
+        DummyGem.AssociatedArchetypeIDs.Add(static_cast<uint32>(FHexademicArchetypeClassifier::Get().Classify(VAI.X, VAI.Y, VAI.Z)));
+        DummyGem.SetPackedCoherence(DummyGem.CoherenceRating);
+        DummyGem.SetPackedEnergeticSignature(DummyGem.EnergeticSignature);
+        DummyGem.SetPackedResonance(DummyGem.CoreSigil.GetResonanceAmplitude());
+        AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakObjectPtr<UHexademicWavefrontAPI>(this), Gem = MoveTemp(DummyGem)]()
+        {
+            UHexademicWavefrontAPI* This = WeakThis.Get();
+            if (This && This->SynthesizedGems.Num() < 5) // Limit dummy gems
+            {
+                This->AddSynthesizedGem(Gem);
+            }
+        });
     }
 }
 
+void UHexademicWavefrontAPI::AddSynthesizedGem(const FHexademicGem& Gem)
+{
+    check(IsInGameThread()); // The orchestrator queries GemCatalog every game-thread tick
+    SynthesizedGems.Add(Gem);
+    GemCatalog.Add(Gem);
+}
+
 void UHexademicWavefrontAPI::ReceiveLatticeSnapshot(const FHexadecimalStateLattice& LatticeSnapshot)
 {
     ReceivedLatticeSnapshot = LatticeSnapshot;
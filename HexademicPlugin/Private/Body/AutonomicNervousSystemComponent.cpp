@@ -20,7 +20,11 @@ void UAutonomicNervousSystemComponent::BeginPlay()
 void UAutonomicNervousSystemComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    AdvanceAutonomicTime(DeltaTime);
+}
 
+void UAutonomicNervousSystemComponent::AdvanceAutonomicTime(float DeltaTime)
+{
     // Smoothly interpolate towards target rates
     CurrentHeartRate = FMath::Lerp(CurrentHeartRate, TargetHeartRate, DeltaTime * HeartRateChangeSpeed);
     CurrentBreathingRate = FMath::Lerp(CurrentBreathingRate, TargetBreathingRate, DeltaTime * BreathingRateChangeSpeed);
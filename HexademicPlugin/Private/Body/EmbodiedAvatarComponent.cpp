@@ -12,6 +12,7 @@
 #include "GlobalShader.h" // For GET_GLOBAL_SHADER_MAP
 #include "HexademicCore.h" // Ensure FAetherTouchPacket is defined
 #include "RHIDefinitions.h" // For ERHIAccess
+#include "Core/HexademicSessionRecorder.h"
 
 // FWavefrontSkinParameters: Shader parameters for skin processing.
 BEGIN_SHADER_PARAMETER_STRUCT(FWavefrontSkinParameters, )
@@ -54,6 +55,27 @@ UEmbodiedAvatarComponent::UEmbodiedAvatarComponent()
     PrimaryComponentTick.bCanEverTick = true; // Enable ticking for updates
 }
 
+void UEmbodiedAvatarComponent::PostLoad()
+{
+    Super::PostLoad();
+    MigrateLegacyRegionMap(RegionToBoneMap, RegionBones, *GetPathName());
+}
+
+FName UEmbodiedAvatarComponent::GetRegionBone(EHexademicBodyRegion Region) const
+{
+    const int32 Index = static_cast<int32>(Region);
+    return Index < NumHexademicBodyRegions ? RegionBones[Index] : NAME_None;
+}
+
+void UEmbodiedAvatarComponent::SetRegionBone(EHexademicBodyRegion Region, FName BoneName)
+{
+    const int32 Index = static_cast<int32>(Region);
+    if (Index < NumHexademicBodyRegions)
+    {
+        RegionBones[Index] = BoneName;
+    }
+}
+
 void UEmbodiedAvatarComponent::BeginPlay()
 {
     Super::BeginPlay();
@@ -104,10 +126,10 @@ void UEmbodiedAvatarComponent::BeginPlay()
 void UEmbodiedAvatarComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    FlushHapticVisuals();
     // Periodically dispatch skin wavefront processing to the GPU
     if (bEnableWavefrontSkinProcessing && SkinUpdateFrequency > 0.0f)
     {
-        static float AccumulatedSkinTime = 0.0f;
         AccumulatedSkinTime += DeltaTime;
         if (AccumulatedSkinTime >= (1.0f / SkinUpdateFrequency))
         {
@@ -215,34 +237,59 @@ void UEmbodiedAvatarComponent::AttachToMetahumanSkeleton(USkeletalMeshComponent*
 // ReceiveHapticFeedback: Processes incoming haptic packets to trigger visual responses.
 void UEmbodiedAvatarComponent::ReceiveHapticFeedback(const FAetherTouchPacket& Packet)
 {
-    // Determine the bone to affect based on the RegionTag from the haptic packet.
-    FName BoneName = RegionToBoneMap.Contains(Packet.RegionTag) ?
-        RegionToBoneMap[Packet.RegionTag] : NAME_None; // Use NAME_None if no mapping found
+    FHexademicSessionRecorder::Get().RecordHapticFeedback(this, Packet);
+
+    // Merged per region and shown once per tick by FlushHapticVisuals, however many packets arrive
+    FHexademicHapticPulse Pulse;
+    Pulse.Region = Packet.ResolveRegion();
+    Pulse.Intensity = Packet.Intensity;
+    Pulse.Duration = Packet.Duration;
+    PendingHapticVisuals.Add(Pulse);
+}
 
-    if (!BoneName.IsNone() && TargetMesh)
+// FlushHapticVisuals: One emitter per touched region and one material write for this tick's haptic packets.
+void UEmbodiedAvatarComponent::FlushHapticVisuals()
+{
+    if (PendingHapticVisuals.IsEmpty()) return;
+    if (!TargetMesh && !SkinMaterial)
     {
-        // Apply a visual pulse (e.g., a particle effect) at the bone's location.
-        FVector BoneLoc = TargetMesh->GetBoneLocation(BoneName);
-        if (HapticPulseParticleSystem)
+        PendingHapticVisuals.Reset(); // Nothing to show them on (headless replay, or no mesh bound yet)
+        return;
+    }
+
+    float StrongestIntensity = -1.0f;
+    for (int32 Index = 0; Index < NumHexademicBodyRegions; Index++)
+    {
+        const EHexademicBodyRegion Region = static_cast<EHexademicBodyRegion>(Index);
+        if (!PendingHapticVisuals.Contains(Region)) continue;
+
+        // Determine the bone to affect based on the region of the haptic packet.
+        const FName BoneName = RegionBones[Index]; // NAME_None if no mapping
+        if (BoneName.IsNone() || !TargetMesh)
         {
-            UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), HapticPulseParticleSystem, BoneLoc);
+            UE_LOG(LogTemp, Warning, TEXT("[EmbodiedAvatar] Unknown region: %s — no bone mapped for haptic feedback."), *FHexademicBodyRegionRegistry::Get().GetTag(Region));
+            continue;
         }
 
-        // Optional: Animate skin material pulse (e.g., emissive shimmer) based on haptic intensity.
-        // This assumes 'SkinMaterial' is correctly set up as a dynamic instance.
-        if (SkinMaterial)
+        // Apply a visual pulse (e.g., a particle effect) at the bone's location.
+        if (HapticPulseParticleSystem)
         {
-            float PulseIntensity = FMath::Clamp(Packet.Intensity * 5.0f, 0.0f, 1.0f); // Scale intensity for visual effect
-            SkinMaterial->SetScalarParameterValue(TEXT("HapticPulseOverlay"), PulseIntensity); // Set material parameter
-            // Decay logic for HapticPulseOverlay could be implemented here with a timer or in the shader itself.
+            UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), HapticPulseParticleSystem, TargetMesh->GetBoneLocation(BoneName));
         }
+        StrongestIntensity = FMath::Max(StrongestIntensity, PendingHapticVisuals.Pulses[Region].Intensity);
 
-        UE_LOG(LogTemp, Log, TEXT("[EmbodiedAvatar] Visual pulse applied at bone %s from region %s"),
-            *BoneName.ToString(), *Packet.RegionTag);
+        UE_LOG(LogTemp, Verbose, TEXT("[EmbodiedAvatar] Visual pulse applied at bone %s from region %s"),
+            *BoneName.ToString(), *FHexademicBodyRegionRegistry::Get().GetTag(Region));
     }
-    else
+    PendingHapticVisuals.Reset();
+
+    // Optional: Animate skin material pulse (e.g., emissive shimmer) based on haptic intensity.
+    // This assumes 'SkinMaterial' is correctly set up as a dynamic instance.
+    if (SkinMaterial && StrongestIntensity >= 0.0f)
     {
-        UE_LOG(LogTemp, Warning, TEXT("[EmbodiedAvatar] Unknown region: %s — no bone mapped for haptic feedback."), *Packet.RegionTag);
+        float PulseIntensity = FMath::Clamp(StrongestIntensity * 5.0f, 0.0f, 1.0f); // Scale intensity for visual effect
+        SkinMaterial->SetScalarParameterValue(TEXT("HapticPulseOverlay"), PulseIntensity); // Set material parameter
+        // Decay logic for HapticPulseOverlay could be implemented here with a timer or in the shader itself.
     }
 }
 
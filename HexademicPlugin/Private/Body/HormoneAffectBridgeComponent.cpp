@@ -14,12 +14,27 @@ UHormoneAffectBridgeComponent::UHormoneAffectBridgeComponent()
 void UHormoneAffectBridgeComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    TuningBinding.Bind(this, [this](const FHexademicTuningTable& Table, FHexademicTuningBinding& Binding)
+    {
+        Binding.Apply(HormoneDecayRate, Table.Body.HormoneDecayRate);
+    });
+}
+
+void UHormoneAffectBridgeComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    TuningBinding.Unbind();
+    Super::EndPlay(EndPlayReason);
 }
 
 void UHormoneAffectBridgeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    AdvanceHormonalTime(DeltaTime);
+}
 
+void UHormoneAffectBridgeComponent::AdvanceHormonalTime(float DeltaTime)
+{
     // Apply natural decay over time
     CortisolLevel = FMath::Max(0.0f, CortisolLevel - HormoneDecayRate * DeltaTime);
     DopamineLevel = FMath::Max(0.0f, DopamineLevel - HormoneDecayRate * DeltaTime);
@@ -8,10 +8,27 @@ UReciprocalEmbodimentComponent::UReciprocalEmbodimentComponent()
 void UReciprocalEmbodimentComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    if (UEmbodimentSignificanceSubsystem* Significance = UEmbodimentSignificanceSubsystem::GetFor(this))
+    {
+        Significance->RegisterComponent(this, SignificanceGate);
+    }
+}
+
+void UReciprocalEmbodimentComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UEmbodimentSignificanceSubsystem* Significance = UEmbodimentSignificanceSubsystem::GetFor(this))
+    {
+        Significance->UnregisterComponent(this);
+    }
+    Super::EndPlay(EndPlayReason);
 }
 
 void UReciprocalEmbodimentComponent::ApplyEmotionalStateToBody(float Valence, float Arousal)
 {
+    // Nobody can see a frozen body; the next state applied after it thaws sets these from scratch
+    if (SignificanceGate.IsFrozen()) return;
+
     // Example: Positive valence and high arousal increase skin flush
     SkinFlushIntensity = FMath::Clamp((Valence * 0.5f + 0.5f) * Arousal, 0.0f, 1.0f);
     // Example: Negative valence and high arousal might increase posture stiffness
@@ -23,10 +40,12 @@ void UReciprocalEmbodimentComponent::ApplyEmotionalStateToBody(float Valence, fl
 
 void UReciprocalEmbodimentComponent::ApplyHormonalEffectsToBody(float CortisolLevel, float DopamineLevel)
 {
+    // Hormonal effects build on the previous values, so they keep accumulating while frozen; only the log is skipped
     // Example: High cortisol increases stiffness, high dopamine reduces it
     PostureStiffness = FMath::Clamp(PostureStiffness + CortisolLevel * 0.1f - DopamineLevel * 0.05f, 0.0f, 1.0f);
     // Example: Dopamine might cause a subtle skin shimmer (re-using SkinFlushIntensity for conceptual effect)
     SkinFlushIntensity = FMath::Clamp(SkinFlushIntensity + DopamineLevel * 0.1f, 0.0f, 1.0f);
+    if (SignificanceGate.IsFrozen()) return;
 
     UE_LOG(LogTemp, Log, TEXT("[ReciprocalEmbodiment] Applied hormonal effects: Cortisol=%.2f, Dopamine=%.2f. SkinFlush=%.2f, PostureStiffness=%.2f"),
         CortisolLevel, DopamineLevel, SkinFlushIntensity, PostureStiffness);
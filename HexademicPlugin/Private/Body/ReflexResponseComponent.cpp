@@ -11,9 +11,21 @@ UReflexResponseComponent::UReflexResponseComponent()
 void UReflexResponseComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    TuningBinding.Bind(this, [this](const FHexademicTuningTable& Table, FHexademicTuningBinding& Binding)
+    {
+        Binding.Apply(StartleThreshold, Table.Body.StartleThreshold);
+        Binding.Apply(EmotionalImpactScale, Table.Body.ReflexEmotionalImpactScale);
+    });
     // In a real system, you'd auto-discover LinkedBody and LinkedMind if not set in editor.
 }
 
+void UReflexResponseComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    TuningBinding.Unbind();
+    Super::EndPlay(EndPlayReason);
+}
+
 void UReflexResponseComponent::TriggerStartle(float Intensity, FVector SourceLocation)
 {
     if (Intensity < StartleThreshold) return;
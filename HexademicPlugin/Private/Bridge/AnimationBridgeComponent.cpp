@@ -2,6 +2,7 @@
 #include "GameFramework/Character.h" // For ACharacter and GetMesh()
 #include "Components/HexademicConsciousnessComponent.h" // To get consciousness state
 #include "Animation/AnimInstance.h" // To access AnimInstance properties
+#include "Subsystems/HexademicComponentRegistrySubsystem.h"
 
 UAnimationBridgeComponent::UAnimationBridgeComponent()
 {
@@ -25,9 +26,23 @@ void UAnimationBridgeComponent::BeginPlay()
 
     if (!LinkedConsciousness)
     {
-        LinkedConsciousness = GetOwner()->FindComponentByClass<UHexademicConsciousnessComponent>();
+        LinkedConsciousness = UHexademicComponentRegistrySubsystem::FindComponent<UHexademicConsciousnessComponent>(GetOwner());
         if (!LinkedConsciousness) UE_LOG(LogTemp, Warning, TEXT("[AnimationBridge] LinkedConsciousness not found on owner %s."), *GetOwner()->GetName());
     }
+
+    if (UEmbodimentSignificanceSubsystem* Significance = UEmbodimentSignificanceSubsystem::GetFor(this))
+    {
+        Significance->RegisterComponent(this, SignificanceGate);
+    }
+}
+
+void UAnimationBridgeComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UEmbodimentSignificanceSubsystem* Significance = UEmbodimentSignificanceSubsystem::GetFor(this))
+    {
+        Significance->UnregisterComponent(this);
+    }
+    Super::EndPlay(EndPlayReason);
 }
 
 void UAnimationBridgeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -36,8 +51,11 @@ void UAnimationBridgeComponent::TickComponent(float DeltaTime, ELevelTick TickTy
 
     if (!TargetMesh || !LinkedConsciousness) return;
 
-    UpdateAnimations(DeltaTime);
-    UpdatePosture(DeltaTime);
+    float UpdateDeltaTime = 0.0f;
+    if (!SignificanceGate.Advance(DeltaTime, UpdateDeltaTime)) return;
+
+    UpdateAnimations(UpdateDeltaTime);
+    UpdatePosture(UpdateDeltaTime);
     TriggerMemoryGestures(); // This would be event-driven in a full system
 }
 
@@ -80,7 +98,7 @@ void UAnimationBridgeComponent::UpdateAnimations(float DeltaTime)
     {
         // Example: Map intensity directly to a generic facial expression morph target
         float TargetWeight = CurrentState.CurrentEmotionalState.Intensity; // Assuming Intensity is part of CurrentEmotionalState in FConsciousnessState
-        TargetMesh->SetMorphTarget(FacialExpressionMorphTarget, FMath::Lerp(TargetMesh->GetMorphTarget(FacialExpressionMorphTarget), TargetWeight, DeltaTime * EmotionalBlendSpeed));
+        TargetMesh->SetMorphTarget(FacialExpressionMorphTarget, FMath::Lerp(TargetMesh->GetMorphTarget(FacialExpressionMorphTarget), TargetWeight, FEmbodimentUpdateGate::GetBlendAlpha(EmotionalBlendSpeed, DeltaTime)));
     }
 }
 
@@ -14,7 +14,10 @@
 #include "EmotionCognitionComponent.h"
 #include "Core/HexadecimalStateLattice.h"
 #include "Core/EmotionalArchetype.h"
+#include "Core/HexademicArchetypeClassifier.h"
 #include "Components/MemoryThreadComponent.h"
+#include "Bridge/HexademicMotionAnimInstance.h"
+#include "Subsystems/EmbodimentSignificanceSubsystem.h"
 
 #include "AvatarMotionLinkComponent.generated.h"
 
@@ -119,6 +122,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -179,10 +183,6 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Posture")
     TArray<FName> SpineBoneNames = {"spine_01", "spine_02", "spine_03"};
 
-    /** Gesture cooldown timers */
-    UPROPERTY()
-    TMap<EEmotionalArchetype, float> GestureCooldowns;
-
     /** Current active gestures */
     UPROPERTY()
     TArray<class UAnimMontage*> ActiveGestures;
@@ -226,6 +226,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Emotional Motion")
     FEmotionalMotionMapping GetCurrentEmotionalMapping() const;
 
+    /** Recompile the per-archetype motion table; call after changing EmotionalMappings or MemoryGestures at runtime */
+    UFUNCTION(BlueprintCallable, Category = "Emotional Motion")
+    void RebuildMotionTable();
+
+    /** Compiled mapping for an archetype; the first EmotionalMappings entry for it, or a default mapping */
+    const FEmotionalMotionMapping& GetCompiledMapping(EEmotionalArchetype Archetype) const { return MotionTable[static_cast<int32>(Archetype)]; }
+
     /** Blueprint event for consciousness state changes */
     UFUNCTION(BlueprintImplementableEvent, Category = "Consciousness Events")
     void OnConsciousnessStateChanged(float NewIntensity, EEmotionalArchetype NewDominantEmotion);
@@ -274,12 +281,103 @@ private:
     /** Animation instance cache */
     UPROPERTY()
     class UAnimInstance* CachedAnimInstance;
+
+    static constexpr int32 NumArchetypes = FHexademicArchetypeClassifier::NumArchetypes;
+
+    /** EmotionalMappings compiled into one row per archetype, so the per-tick lookup is an index */
+    TStaticArray<FEmotionalMotionMapping, NumArchetypes> MotionTable;
+
+    /** Indices into MemoryGestures, grouped by trigger archetype */
+    TStaticArray<TArray<int32, TInlineAllocator<2>>, NumArchetypes> GesturesByArchetype;
+
+    /** Seconds until each archetype may gesture again */
+    TStaticArray<float, NumArchetypes> GestureCooldowns;
+
+    /** This tick's motion, published to the anim instance in one block at the end of the tick */
+    FHexademicMotionAnimParams FrameParams;
+
+    /** Anim instance that applies FrameParams on the animation worker thread; null when the mesh runs some other class */
+    UHexademicMotionAnimInstance* GetMotionAnimInstance() const;
+
+    /** Update rate assigned by UEmbodimentSignificanceSubsystem */
+    FEmbodimentUpdateGate SignificanceGate;
 };
 
 // ===============================================================================
 // IMPLEMENTATION FILE - Extended AvatarMotionLinkComponent.cpp
 // ===============================================================================
 
+UAvatarMotionLinkComponent::UAvatarMotionLinkComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    CachedAnimInstance = nullptr;
+    GestureCooldowns = TStaticArray<float, NumArchetypes>(InPlace, 0.0f);
+}
+
+void UAvatarMotionLinkComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    RebuildMotionTable();
+    if (TargetMesh)
+    {
+        SetTargetMesh(TargetMesh);
+    }
+
+    if (UEmbodimentSignificanceSubsystem* Significance = UEmbodimentSignificanceSubsystem::GetFor(this))
+    {
+        Significance->RegisterComponent(this, SignificanceGate);
+    }
+}
+
+void UAvatarMotionLinkComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UEmbodimentSignificanceSubsystem* Significance = UEmbodimentSignificanceSubsystem::GetFor(this))
+    {
+        Significance->UnregisterComponent(this);
+    }
+    Super::EndPlay(EndPlayReason);
+}
+
+void UAvatarMotionLinkComponent::SetTargetMesh(USkeletalMeshComponent* InMesh)
+{
+    TargetMesh = InMesh;
+    CachedAnimInstance = TargetMesh ? TargetMesh->GetAnimInstance() : nullptr;
+
+    // The mesh must tick after us, so the block we publish is the one its animation update reads
+    if (TargetMesh)
+    {
+        TargetMesh->AddTickPrerequisiteComponent(this);
+    }
+}
+
+void UAvatarMotionLinkComponent::RebuildMotionTable()
+{
+    for (int32 Index = 0; Index < NumArchetypes; Index++)
+    {
+        MotionTable[Index] = FEmotionalMotionMapping();
+        MotionTable[Index].EmotionalState = static_cast<EEmotionalArchetype>(Index);
+        GesturesByArchetype[Index].Reset();
+    }
+
+    // Walk backwards so the first mapping for an archetype is the one kept
+    for (int32 Index = EmotionalMappings.Num() - 1; Index >= 0; Index--)
+    {
+        const FEmotionalMotionMapping& Mapping = EmotionalMappings[Index];
+        MotionTable[static_cast<int32>(Mapping.EmotionalState)] = Mapping;
+    }
+
+    for (int32 Index = 0; Index < MemoryGestures.Num(); Index++)
+    {
+        GesturesByArchetype[static_cast<int32>(MemoryGestures[Index].TriggerEmotion)].Add(Index);
+    }
+}
+
+UHexademicMotionAnimInstance* UAvatarMotionLinkComponent::GetMotionAnimInstance() const
+{
+    return TargetMesh ? Cast<UHexademicMotionAnimInstance>(TargetMesh->GetAnimInstance()) : nullptr;
+}
+
 /* 
 Enhanced TickComponent implementation with full consciousness bridge functionality:
 */
@@ -290,6 +388,11 @@ void UAvatarMotionLinkComponent::TickComponent(float DeltaTime, ELevelTick TickT
     
     if (!EmotionMind || !TargetMesh) return;
 
+    // Between sparse updates the anim instance keeps blending toward the last published block on its own
+    float UpdateDeltaTime = 0.0f;
+    if (!SignificanceGate.Advance(DeltaTime, UpdateDeltaTime)) return;
+    DeltaTime = UpdateDeltaTime;
+
     // Get current emotional state
     const float Valence = EmotionMind->GetCurrentValence(); // [-1, 1]
     const float Arousal = EmotionMind->GetCurrentArousal(); // [0, 1]
@@ -308,44 +411,70 @@ void UAvatarMotionLinkComponent::TickComponent(float DeltaTime, ELevelTick TickT
     }
 
     DominantEmotion = NewDominantEmotion;
+    CachedAnimInstance = TargetMesh->GetAnimInstance();
 
-    // === ORIGINAL FUNCTIONALITY (Enhanced) ===
+    // Breathing, posture and locomotion only fill in FrameParams; montages stay on the game thread
+    FrameParams.ConsciousnessIntensity = ConsciousnessIntensity;
     ProcessBreathingModulation(DeltaTime, Valence, Arousal);
     ProcessPostureAdjustment(DeltaTime, Valence, Arousal);
-
-    // === NEW EXTENDED FUNCTIONALITY ===
-    ProcessEmotionalAnimation(DeltaTime);
-    ProcessMemoryGestures(DeltaTime);
     ApplyConsciousnessPosture(DeltaTime);
     ModulateWalkCycle(DeltaTime);
+
+    ProcessEmotionalAnimation(DeltaTime);
     UpdateGestureCooldowns(DeltaTime);
+    ProcessMemoryGestures(DeltaTime);
+
+    // One hand-over per frame; the anim instance applies the morph and every posture bone in its worker update
+    if (UHexademicMotionAnimInstance* MotionAnim = GetMotionAnimInstance())
+    {
+        MotionAnim->SetMotionParams(FrameParams);
+    }
+    else
+    {
+        // Without a motion anim instance only the breath morph can be driven, directly from here
+        const float BreathCycle = FMath::Sin(GetWorld()->GetTimeSeconds() * 2.0f * PI * FrameParams.BreathRate) * 0.5f + 0.5f;
+        TargetMesh->SetMorphTarget(BreathMorphTargetName, BreathCycle * FrameParams.BreathDepth);
+    }
 }
 
 void UAvatarMotionLinkComponent::ProcessBreathingModulation(float DeltaTime, float Valence, float Arousal)
 {
-    // Enhanced breathing with emotional mapping
-    FEmotionalMotionMapping CurrentMapping = GetCurrentEmotionalMapping();
-    
-    // Base breathing from arousal
-    float BaseBreathScale = FMath::Lerp(0.8f, MaxBreathExpansion, Arousal);
-    
-    // Modify with emotional mapping
-    float EmotionalBreathMin = CurrentMapping.BreathingRange.X;
-    float EmotionalBreathMax = CurrentMapping.BreathingRange.Y;
-    float FinalBreathScale = FMath::Lerp(EmotionalBreathMin, EmotionalBreathMax, Arousal);
-    
-    // Apply consciousness intensity modifier
+    const FEmotionalMotionMapping& CurrentMapping = GetCompiledMapping(DominantEmotion);
+
+    // Breathing range from the emotional mapping, scaled by arousal and consciousness intensity
+    float FinalBreathScale = FMath::Lerp(CurrentMapping.BreathingRange.X, CurrentMapping.BreathingRange.Y, Arousal);
     FinalBreathScale *= FMath::Lerp(0.8f, 1.2f, ConsciousnessIntensity);
-    
-    // Smooth breathing animation
-    float BreathCycle = FMath::Sin(GetWorld()->GetTimeSeconds() * 2.0f * PI * FinalBreathScale) * 0.5f + 0.5f;
-    TargetMesh->SetMorphTarget(BreathMorphTargetName, BreathCycle * FinalBreathScale);
+
+    FrameParams.BreathRate = FinalBreathScale;
+    FrameParams.BreathDepth = FinalBreathScale;
+}
+
+void UAvatarMotionLinkComponent::ProcessPostureAdjustment(float DeltaTime, float Valence, float Arousal)
+{
+    const FEmotionalMotionMapping& CurrentMapping = GetCompiledMapping(DominantEmotion);
+
+    // The emotion's posture grows with intensity; the head lifts with positive valence and drops with negative
+    FrameParams.SpinePosture = CurrentMapping.PostureAdjustment * ConsciousnessIntensity;
+    FrameParams.HeadPosture = FRotator(Valence * HeadTiltIntensity, 0.0f, 0.0f);
+    FrameParams.SpineBoneCount = SpineBoneNames.Num();
+    FrameParams.PostureBlendSpeed = PostureAdjustmentSpeed;
+}
+
+void UAvatarMotionLinkComponent::ApplyConsciousnessPosture(float DeltaTime)
+{
+    // Heightened consciousness straightens the spine a little, dulled consciousness lets it settle
+    FrameParams.SpinePosture.Pitch += (ConsciousnessIntensity - 0.5f) * HeadTiltIntensity * 0.5f;
+}
+
+void UAvatarMotionLinkComponent::ModulateWalkCycle(float DeltaTime)
+{
+    const float Arousal = EmotionMind ? EmotionMind->GetCurrentArousal() : 0.5f;
+    FrameParams.LocomotionPlayRate = GetCompiledMapping(DominantEmotion).MovementSpeedModifier * FMath::Lerp(0.9f, 1.1f, Arousal);
 }
 
 void UAvatarMotionLinkComponent::ProcessEmotionalAnimation(float DeltaTime)
 {
-    // Find and blend emotional animations
-    FEmotionalMotionMapping CurrentMapping = GetCurrentEmotionalMapping();
+    const FEmotionalMotionMapping& CurrentMapping = GetCompiledMapping(DominantEmotion);
     
     if (CurrentMapping.EmotionalMontage && CachedAnimInstance)
     {
@@ -366,52 +495,43 @@ void UAvatarMotionLinkComponent::ProcessEmotionalAnimation(float DeltaTime)
     }
 }
 
+void UAvatarMotionLinkComponent::UpdateGestureCooldowns(float DeltaTime)
+{
+    for (float& Cooldown : GestureCooldowns)
+    {
+        Cooldown = FMath::Max(Cooldown - DeltaTime, 0.0f);
+    }
+}
+
 void UAvatarMotionLinkComponent::ProcessMemoryGestures(float DeltaTime)
 {
-    if (!MemoryThreads) return;
+    if (!MemoryThreads || !CachedAnimInstance) return;
+
+    // Only gestures keyed to the dominant emotion can trigger, and not while that emotion is cooling down
+    const int32 Archetype = static_cast<int32>(DominantEmotion);
+    if (GestureCooldowns[Archetype] > 0.0f) return;
 
-    // Check for recent memory activations
-    for (const FMemoryGestureMapping& GestureMapping : MemoryGestures)
+    for (const int32 GestureIndex : GesturesByArchetype[Archetype])
     {
-        // Check if this emotion is on cooldown
-        if (GestureCooldowns.Contains(GestureMapping.TriggerEmotion))
-        {
-            continue; // Skip if on cooldown
-        }
+        const FMemoryGestureMapping& GestureMapping = MemoryGestures[GestureIndex];
 
         // Query memory threads for recent emotional memories
         // This would integrate with your memory system
         // For now, using random trigger based on current emotional state
-        if (DominantEmotion == GestureMapping.TriggerEmotion)
+        if (GestureMapping.GestureMontage && FMath::RandRange(0.0f, 1.0f) < GestureMapping.TriggerProbability * DeltaTime)
         {
-            if (FMath::RandRange(0.0f, 1.0f) < GestureMapping.TriggerProbability * DeltaTime)
-            {
-                // Trigger gesture
-                if (GestureMapping.GestureMontage && CachedAnimInstance)
-                {
-                    CachedAnimInstance->Montage_Play(GestureMapping.GestureMontage, 1.0f);
-                    OnMemoryGestureTriggered(GestureMapping.TriggerEmotion, GestureMapping.GestureMontage);
-                    
-                    // Set cooldown
-                    GestureCooldowns.Add(GestureMapping.TriggerEmotion, GestureMapping.GestureCooldown);
-                }
-            }
+            CachedAnimInstance->Montage_Play(GestureMapping.GestureMontage, 1.0f);
+            OnMemoryGestureTriggered(GestureMapping.TriggerEmotion, GestureMapping.GestureMontage);
+
+            GestureCooldowns[Archetype] = GestureMapping.GestureCooldown;
+            break;
         }
     }
 }
 
 FEmotionalMotionMapping UAvatarMotionLinkComponent::GetCurrentEmotionalMapping() const
 {
-    for (const FEmotionalMotionMapping& Mapping : EmotionalMappings)
-    {
-        if (Mapping.EmotionalState == DominantEmotion)
-        {
-            return Mapping;
-        }
-    }
-    
-    // Return default mapping if none found
-    return FEmotionalMotionMapping();
+    return GetCompiledMapping(DominantEmotion);
 }
 
 float UAvatarMotionLinkComponent::CalculateConsciousnessIntensity(float Valence, float Arousal) const
@@ -424,23 +544,6 @@ float UAvatarMotionLinkComponent::CalculateConsciousnessIntensity(float Valence,
 
 EEmotionalArchetype UAvatarMotionLinkComponent::DetermineDominantEmotion(float Valence, float Arousal) const
 {
-    // Map valence/arousal to emotional archetypes
-    // This is a simplified mapping - you might want more sophisticated classification
-    
-    if (Arousal > 0.7f)
-    {
-        if (Valence > 0.5f) return EEmotionalArchetype::Joy;
-        else if (Valence < -0.5f) return EEmotionalArchetype::Rage;
-        else return EEmotionalArchetype::Awe;
-    }
-    else if (Arousal < 0.3f)
-    {
-        if (Valence < -0.5f) return EEmotionalArchetype::Grief;
-        else return EEmotionalArchetype::Longing;
-    }
-    else
-    {
-        if (Valence < -0.3f) return EEmotionalArchetype::Fear;
-        else return EEmotionalArchetype::Curiosity;
-    }
+    // Same classifier and intensity as the consciousness component, so body and mind agree on the archetype
+    return FHexademicArchetypeClassifier::Get().Classify(Valence, Arousal, CalculateConsciousnessIntensity(Valence, Arousal));
 }
@@ -1,6 +1,9 @@
 #include "Bridge/BehaviorTreeBridge.h"
 #include "AIController.h" // For AAIController
 #include "GameFramework/Pawn.h" // For APawn (owner of AIController)
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Enum.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Float.h"
+#include "Subsystems/HexademicComponentRegistrySubsystem.h"
 
 UBehaviorTreeBridge::UBehaviorTreeBridge()
 {
@@ -14,7 +17,7 @@ void UBehaviorTreeBridge::BeginPlay()
     // Attempt to find linked components if not set in editor
     if (!LinkedConsciousness)
     {
-        LinkedConsciousness = GetOwner()->FindComponentByClass<UHexademicConsciousnessComponent>();
+        LinkedConsciousness = UHexademicComponentRegistrySubsystem::FindComponent<UHexademicConsciousnessComponent>(GetOwner());
         if (!LinkedConsciousness) UE_LOG(LogTemp, Warning, TEXT("[BTBridge:%s] LinkedConsciousness not found."), *GetOwner()->GetName());
     }
 
@@ -45,16 +48,42 @@ void UBehaviorTreeBridge::BeginPlay()
             UE_LOG(LogTemp, Warning, TEXT("[BTBridge:%s] LinkedBehaviorTree is typically managed by AIController; set manually if needed."), *GetOwner()->GetName());
         }
     }
+
+    BindConsciousness();
+}
+
+void UBehaviorTreeBridge::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UnbindConsciousness();
+    Super::EndPlay(EndPlayReason);
 }
 
 void UBehaviorTreeBridge::SetLinkedConsciousness(UHexademicConsciousnessComponent* InConsciousness)
 {
     LinkedConsciousness = InConsciousness;
+    if (HasBegunPlay())
+    {
+        BindConsciousness();
+    }
 }
 
 void UBehaviorTreeBridge::SetLinkedBlackboard(UBlackboardComponent* InBlackboard)
 {
     LinkedBlackboard = InBlackboard;
+    ResolvedBlackboardAsset.Reset();
+    if (HasBegunPlay())
+    {
+        SyncBlackboard(EConsciousnessStateFields::All); // A new Blackboard starts with none of our keys written
+    }
+}
+
+void UBehaviorTreeBridge::SetSyncOnStateChange(bool bInSyncOnStateChange)
+{
+    bSyncOnStateChange = bInSyncOnStateChange;
+    if (HasBegunPlay())
+    {
+        BindConsciousness();
+    }
 }
 
 void UBehaviorTreeBridge::SetLinkedBehaviorTree(UBehaviorTreeComponent* InBehaviorTree)
@@ -62,6 +91,44 @@ void UBehaviorTreeBridge::SetLinkedBehaviorTree(UBehaviorTreeComponent* InBehavi
     LinkedBehaviorTree = InBehaviorTree;
 }
 
+void UBehaviorTreeBridge::BindConsciousness()
+{
+    UnbindConsciousness();
+    if (!LinkedConsciousness || !bSyncOnStateChange) return;
+
+    StateChangedHandle = LinkedConsciousness->OnStateChanged.AddUObject(this, &UBehaviorTreeBridge::HandleConsciousnessStateChanged);
+    BoundConsciousness = LinkedConsciousness;
+
+    // Changes are only reported from here on; bring every key up to date with the state as it stands
+    SyncBlackboard(EConsciousnessStateFields::All);
+}
+
+void UBehaviorTreeBridge::UnbindConsciousness()
+{
+    if (UHexademicConsciousnessComponent* Consciousness = BoundConsciousness.Get())
+    {
+        Consciousness->OnStateChanged.Remove(StateChangedHandle);
+    }
+    StateChangedHandle.Reset();
+    BoundConsciousness.Reset();
+}
+
+void UBehaviorTreeBridge::HandleConsciousnessStateChanged(UHexademicConsciousnessComponent* Consciousness, EConsciousnessStateFields ChangedFields)
+{
+    SyncBlackboard(ChangedFields);
+}
+
+void UBehaviorTreeBridge::ResolveBlackboardKeys()
+{
+    const UBlackboardData* Asset = LinkedBlackboard->GetBlackboardAsset();
+    ResolvedBlackboardAsset = Asset;
+
+    DominantEmotionKey = LinkedBlackboard->GetKeyID(DominantEmotionKeyName);
+    VitalityKey = LinkedBlackboard->GetKeyID(VitalityKeyName);
+    CognitiveLoadKey = LinkedBlackboard->GetKeyID(CognitiveLoadKeyName);
+    CoherenceKey = LinkedBlackboard->GetKeyID(CoherenceKeyName);
+}
+
 void UBehaviorTreeBridge::UpdateBlackboardFromConsciousness()
 {
     if (!LinkedConsciousness || !LinkedBlackboard)
@@ -70,24 +137,37 @@ void UBehaviorTreeBridge::UpdateBlackboardFromConsciousness()
         return;
     }
 
-    FConsciousnessState State = LinkedConsciousness->GetConsciousnessState();
+    SyncBlackboard(EConsciousnessStateFields::All);
+}
+
+void UBehaviorTreeBridge::SyncBlackboard(EConsciousnessStateFields ChangedFields)
+{
+    if (!LinkedConsciousness || !LinkedBlackboard) return;
+
+    // Key IDs stay valid for as long as the Blackboard runs the same asset; a new asset has none of our values yet
+    if (ResolvedBlackboardAsset.Get() != LinkedBlackboard->GetBlackboardAsset())
+    {
+        ResolveBlackboardKeys();
+        ChangedFields = EConsciousnessStateFields::All;
+    }
+
+    const FConsciousnessState& State = LinkedConsciousness->GetConsciousnessStateRef();
 
-    // Update Blackboard keys
-    if (LinkedBlackboard->DoesKeyExist(DominantEmotionKeyName))
+    if (EnumHasAnyFlags(ChangedFields, EConsciousnessStateFields::DominantEmotion) && DominantEmotionKey != FBlackboard::InvalidKey)
     {
-        LinkedBlackboard->SetValueAsEnum(DominantEmotionKeyName, (uint8)State.DominantEmotionalArchetype);
+        LinkedBlackboard->SetValue<UBlackboardKeyType_Enum>(DominantEmotionKey, static_cast<uint8>(State.DominantEmotionalArchetype));
     }
-    if (LinkedBlackboard->DoesKeyExist(VitalityKeyName))
+    if (EnumHasAnyFlags(ChangedFields, EConsciousnessStateFields::Vitality) && VitalityKey != FBlackboard::InvalidKey)
     {
-        LinkedBlackboard->SetValueAsFloat(VitalityKeyName, State.Vitality);
+        LinkedBlackboard->SetValue<UBlackboardKeyType_Float>(VitalityKey, State.Vitality);
     }
-    if (LinkedBlackboard->DoesKeyExist(CognitiveLoadKeyName))
+    if (EnumHasAnyFlags(ChangedFields, EConsciousnessStateFields::CognitiveLoad) && CognitiveLoadKey != FBlackboard::InvalidKey)
     {
-        LinkedBlackboard->SetValueAsFloat(CognitiveLoadKeyName, State.CognitiveLoad);
+        LinkedBlackboard->SetValue<UBlackboardKeyType_Float>(CognitiveLoadKey, State.CognitiveLoad);
     }
-    if (LinkedBlackboard->DoesKeyExist(CoherenceKeyName))
+    if (EnumHasAnyFlags(ChangedFields, EConsciousnessStateFields::Coherence) && CoherenceKey != FBlackboard::InvalidKey)
     {
-        LinkedBlackboard->SetValueAsFloat(CoherenceKeyName, State.LatticeSnapshot.Amplitude); // Using Lattice Amplitude as proxy for Coherence for now
+        LinkedBlackboard->SetValue<UBlackboardKeyType_Float>(CoherenceKey, LinkedConsciousness->GetCoherence());
     }
 
     UE_LOG(LogTemp, Verbose, TEXT("[BTBridge:%s] Blackboard updated from consciousness. Vitality: %.2f, Emotion: %s"),
@@ -98,7 +178,7 @@ EEmotionalArchetype UBehaviorTreeBridge::GetDominantEmotionalArchetype() const
 {
     if (LinkedConsciousness)
     {
-        return LinkedConsciousness->GetConsciousnessState().DominantEmotionalArchetype;
+        return LinkedConsciousness->GetConsciousnessStateRef().DominantEmotionalArchetype;
     }
     return EEmotionalArchetype::Curiosity; // Default or neutral
 }
@@ -107,7 +187,7 @@ float UBehaviorTreeBridge::GetVitality() const
 {
     if (LinkedConsciousness)
     {
-        return LinkedConsciousness->GetConsciousnessState().Vitality;
+        return LinkedConsciousness->GetConsciousnessStateRef().Vitality;
     }
     return 0.0f;
 }
@@ -116,7 +196,7 @@ float UBehaviorTreeBridge::GetCognitiveLoad() const
 {
     if (LinkedConsciousness)
     {
-        return LinkedConsciousness->GetConsciousnessState().CognitiveLoad;
+        return LinkedConsciousness->GetConsciousnessStateRef().CognitiveLoad;
     }
     return 0.0f;
 }
@@ -125,8 +205,7 @@ bool UBehaviorTreeBridge::IsCoherenceHigh(float Threshold) const
 {
     if (LinkedConsciousness)
     {
-        // Using HexLattice Amplitude as a proxy for coherence in this context
-        return LinkedConsciousness->GetConsciousnessState().LatticeSnapshot.Amplitude >= Threshold;
+        return LinkedConsciousness->GetCoherence() >= Threshold;
     }
     return false;
 }
@@ -2,9 +2,11 @@
 #include "EmotionCognitionComponent.h" // Mind
 #include "EmbodiedAvatarComponent.h" // Body
 #include "AvatarMotionLinkComponent.h" // Motion
+#include "Subsystems/HexademicComponentRegistrySubsystem.h"
 // #include "DUIDSOrchestrator.h" // Main API - commented out because UDUIDSOrchestrator might include this
 // #include "HexademicWavefrontAPI.h" // Wavefront API (for sigils) - commented out because UDUIDSOrchestrator might include this
 #include "HexademicCore.h" // Ensure FAetherTouchPacket is included
+#include "Core/HexademicSessionRecorder.h"
 
 UConsciousnessBridgeComponent::UConsciousnessBridgeComponent()
 {
@@ -19,17 +21,17 @@ void UConsciousnessBridgeComponent::BeginPlay()
     // If not set in editor, attempt to find them in the same actor or world
     if (!EmotionMind)
     {
-        EmotionMind = GetOwner()->FindComponentByClass<UEmotionCognitionComponent>();
+        EmotionMind = UHexademicComponentRegistrySubsystem::FindComponent<UEmotionCognitionComponent>(GetOwner());
         if (!EmotionMind) UE_LOG(LogTemp, Warning, TEXT("[ConsciousnessBridge] EmotionMind not found on owner."));
     }
     if (!AvatarBody)
     {
-        AvatarBody = GetOwner()->FindComponentByClass<UEmbodiedAvatarComponent>();
+        AvatarBody = UHexademicComponentRegistrySubsystem::FindComponent<UEmbodiedAvatarComponent>(GetOwner());
         if (!AvatarBody) UE_LOG(LogTemp, Warning, TEXT("[ConsciousnessBridge] AvatarBody not found on owner."));
     }
     if (!AvatarMotion)
     {
-        AvatarMotion = GetOwner()->FindComponentByClass<UAvatarMotionLinkComponent>();
+        AvatarMotion = UHexademicComponentRegistrySubsystem::FindComponent<UAvatarMotionLinkComponent>(GetOwner());
         if (!AvatarMotion) UE_LOG(LogTemp, Warning, TEXT("[ConsciousnessBridge] AvatarMotion not found on owner."));
     }
 
@@ -61,6 +63,9 @@ void UConsciousnessBridgeComponent::TickComponent(float DeltaTime, ELevelTick Ti
 void UConsciousnessBridgeComponent::ProcessIncomingHapticPacket(const FAetherTouchPacket& Packet)
 {
     // Full Haptic -> Emotion -> Visual pipeline:
+    // Recorded once here; the body call below is part of this packet, not a separate input
+    FHexademicSessionRecorder::Get().RecordHapticPacket(this, Packet);
+    FHexademicSessionRecorder::FSuppressScope SuppressNestedRecording;
     
     // 1. Route to Body for immediate visual feedback (e.g., localized pulse)
     if (AvatarBody)
@@ -76,7 +81,7 @@ void UConsciousnessBridgeComponent::ProcessIncomingHapticPacket(const FAetherTou
     // 2. Route to Mind for emotional modulation and memory imprinting
     if (EmotionMind)
     {
-        EmotionMind->ModulateEmotionFromHaptic(Packet.Intensity, Packet.RegionTag);
+        EmotionMind->ModulateEmotionFromHapticRegion(Packet.Intensity, Packet.ResolveRegion());
         UE_LOG(LogTemp, Log, TEXT("[ConsciousnessBridge] Haptic routed to EmotionMind for emotional modulation: %s"), *Packet.RegionTag);
         // Crucially, store the memory *after* emotional modulation has occurred
         EmotionMind->StoreHapticEmotionMemory(Packet);
@@ -133,8 +138,8 @@ void UConsciousnessBridgeComponent::ApplyHexademicState()
         if (Sigil.GetResonanceAmplitude() >= 0.85f)
         {
             // Apply visual effect of the sigil to the body, e.g., a glow, an overlay
-            AvatarBody->ApplySigilColorWavefront(Sigil.SigilID, Sigil.GetConsciousnessColor());
-            UE_LOG(LogTemp, Verbose, TEXT("[ConsciousnessBridge] Applied Sigil %s to AvatarBody."), *Sigil.SigilID);
+            AvatarBody->ApplySigilColorWavefront(Sigil.GetSigilID(), Sigil.GetConsciousnessColor());
+            UE_LOG(LogTemp, Verbose, TEXT("[ConsciousnessBridge] Applied Sigil %s to AvatarBody."), *Sigil.GetSigilID());
         }
     }
     */
@@ -0,0 +1,26 @@
+#include "Bridge/HexademicMotionAnimInstance.h"
+
+void UHexademicMotionAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
+{
+    Super::NativeUpdateAnimation(DeltaSeconds);
+
+    // The worker update for this frame has not started yet, so this is the one safe point to hand the block over
+    FrameParams = PendingParams;
+}
+
+void UHexademicMotionAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+    Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+    // Breath advances by phase rather than by world time, so a change of rate never jumps the cycle
+    BreathPhase = FMath::Frac(BreathPhase + DeltaSeconds * FrameParams.BreathRate);
+    BreathCurveValue = (FMath::Sin(BreathPhase * 2.0f * PI) * 0.5f + 0.5f) * FrameParams.BreathDepth;
+
+    AppliedSpinePosture = FMath::RInterpTo(AppliedSpinePosture, FrameParams.SpinePosture, DeltaSeconds, FrameParams.PostureBlendSpeed);
+    AppliedHeadPosture = FMath::RInterpTo(AppliedHeadPosture, FrameParams.HeadPosture, DeltaSeconds, FrameParams.PostureBlendSpeed);
+    SpineBoneRotation = AppliedSpinePosture * (1.0f / FMath::Max(FrameParams.SpineBoneCount, 1));
+    HeadBoneRotation = AppliedHeadPosture;
+
+    LocomotionPlayRate = FrameParams.LocomotionPlayRate;
+    ConsciousnessIntensity = FrameParams.ConsciousnessIntensity;
+}
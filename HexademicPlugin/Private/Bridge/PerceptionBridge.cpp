@@ -1,5 +1,7 @@
 #include "Bridge/PerceptionBridge.h"
 #include "AIController.h" // For AAIController
+#include "Core/HexademicSessionRecorder.h"
+#include "Subsystems/HexademicComponentRegistrySubsystem.h"
 
 UPerceptionBridge::UPerceptionBridge()
 {
@@ -13,7 +15,7 @@ void UPerceptionBridge::BeginPlay()
     // Attempt to find linked components if not set in editor
     if (!LinkedConsciousness)
     {
-        LinkedConsciousness = GetOwner()->FindComponentByClass<UHexademicConsciousnessComponent>();
+        LinkedConsciousness = UHexademicComponentRegistrySubsystem::FindComponent<UHexademicConsciousnessComponent>(GetOwner());
         if (!LinkedConsciousness) UE_LOG(LogTemp, Warning, TEXT("[PerceptionBridge:%s] LinkedConsciousness not found."), *GetOwner()->GetName());
     }
 
@@ -27,7 +29,7 @@ void UPerceptionBridge::BeginPlay()
         }
         else // If owner is a Pawn directly
         {
-            LinkedPerception = GetOwner()->FindComponentByClass<UAIPerceptionComponent>();
+            LinkedPerception = UHexademicComponentRegistrySubsystem::FindComponent<UAIPerceptionComponent>(GetOwner());
         }
 
         if (LinkedPerception)
@@ -102,6 +104,10 @@ void UPerceptionBridge::ProcessStimulus(const FAIStimulus& Stimulus)
     }
     // Add other senses like touch, damage, etc.
 
+    // Recorded here with the impact it produced, so replay applies the same stimulus without this bridge's tuning
+    FHexademicSessionRecorder::Get().RecordPerception(this, Stimulus.Strength, Stimulus.StimulusLocation, Stimulus.Type.Name, EmotionalValence, EmotionalArousal, EmotionalIntensity);
+    FHexademicSessionRecorder::FSuppressScope SuppressNestedRecording;
+
     // Apply the derived emotional impact to the consciousness
     LinkedConsciousness->ApplyExternalEmotionalStimulus(EmotionalValence, EmotionalArousal, EmotionalIntensity);
 }
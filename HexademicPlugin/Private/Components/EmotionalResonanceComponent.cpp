@@ -8,6 +8,19 @@ UEmotionalResonanceComponent::UEmotionalResonanceComponent()
 void UEmotionalResonanceComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    TuningBinding.Bind(this, [this](const FHexademicTuningTable& Table, FHexademicTuningBinding& Binding)
+    {
+        Binding.Apply(ValenceResonanceFactor, Table.Emotional.ValenceResonanceFactor);
+        Binding.Apply(ArousalResonanceFactor, Table.Emotional.ArousalResonanceFactor);
+        Binding.Apply(IntensityResonanceFactor, Table.Emotional.IntensityResonanceFactor);
+    });
+}
+
+void UEmotionalResonanceComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    TuningBinding.Unbind();
+    Super::EndPlay(EndPlayReason);
 }
 
 void UEmotionalResonanceComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
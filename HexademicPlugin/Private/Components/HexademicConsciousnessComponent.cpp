@@ -11,6 +11,9 @@
 #include "Body/EmpathicFieldComponent.h"
 #include "Fractal/UFractalConsciousnessManagerComponent.h"
 #include "API/HexademicWavefrontAPI.h" // NEW: For WavefrontAPI [cite: 14]
+#include "Core/HexademicSessionRecorder.h"
+#include "Core/HexademicArchetypeClassifier.h"
+#include "Subsystems/HexademicComponentRegistrySubsystem.h"
 
 UHexademicConsciousnessComponent::UHexademicConsciousnessComponent()
 {
@@ -47,31 +50,19 @@ void UHexademicConsciousnessComponent::AutoDiscoverSubComponents()
     AActor* OwnerActor = GetOwner();
     if (!OwnerActor) return;
 
-    // Helper lambda to find and assign component if not already set
-    auto FindAndAssign = [&](UActorComponent*& ComponentPtr, TSubclassOf<UActorComponent> Class, const FString& Name)
-    {
-        if (!ComponentPtr)
-        {
-            ComponentPtr = OwnerActor->FindComponentByClass(Class);
-            if (!ComponentPtr)
-            {
-                UE_LOG(LogTemp, Warning, TEXT("[ConsciousnessComponent] %s not found on owner %s. Some features may be disabled."), *Name, *OwnerActor->GetName());
-            }
-        }
-    };
-
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(EmotionMind), UEmotionCognitionComponent::StaticClass(), TEXT("EmotionMind"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(BiologicalNeeds), UBiologicalNeedsComponent::StaticClass(), TEXT("BiologicalNeeds"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(ReflexSystem), UReflexResponseComponent::StaticClass(), TEXT("ReflexSystem"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(AutonomicSystem), UAutonomicNervousSystemComponent::StaticClass(), TEXT("AutonomicSystem"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(HormoneSystem), UHormoneAffectBridgeComponent::StaticClass(), TEXT("HormoneSystem"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(MemoryContainer), UEluenMemoryContainerComponent::StaticClass(), TEXT("MemoryContainer"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(CreativeSynthesizer), UCreativeSynthesizer::StaticClass(), TEXT("CreativeSynthesizer"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(EnvironmentalResonator), UEnvironmentalResonator::StaticClass(), TEXT("EnvironmentalResonator"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(IncrementalPersister), UIncrementalPersister::StaticClass(), TEXT("IncrementalPersister"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(EmpathicField), UEmpathicFieldComponent::StaticClass(), TEXT("EmpathicField"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(FractalManager), UFractalConsciousnessManagerComponent::StaticClass(), TEXT("FractalManager"));
-    FindAndAssign(reinterpret_cast<UActorComponent*&>(WavefrontAPI), UHexademicWavefrontAPI::StaticClass(), TEXT("WavefrontAPI")); // NEW [cite: 14]
+    // Registry lookups where the world has the subsystem; FindComponentByClass otherwise (editor previews, bare worlds)
+    UHexademicComponentRegistrySubsystem::BindComponent(OwnerActor, EmotionMind, TEXT("EmotionMind"));
+    UHexademicComponentRegistrySubsystem::BindComponent(OwnerActor, BiologicalNeeds, TEXT("BiologicalNeeds"));
+    UHexademicComponentRegistrySubsystem::BindComponent(OwnerActor, ReflexSystem, TEXT("ReflexSystem"));
+    UHexademicComponentRegistrySubsystem::BindComponent(OwnerActor, AutonomicSystem, TEXT("AutonomicSystem"));
+    UHexademicComponentRegistrySubsystem::BindComponent(OwnerActor, HormoneSystem, TEXT("HormoneSystem"));
+    UHexademicComponentRegistrySubsystem::BindComponent(OwnerActor, MemoryContainer, TEXT("MemoryContainer"));
+    UHexademicComponentRegistrySubsystem::BindComponent(OwnerActor, CreativeSynthesizer, TEXT("CreativeSynthesizer"));
+    UHexademicComponentRegistrySubsystem::BindComponent(OwnerActor, EnvironmentalResonator, TEXT("EnvironmentalResonator"));
+    UHexademicComponentRegistrySubsystem::BindComponent(OwnerActor, IncrementalPersister, TEXT("IncrementalPersister"));
+    UHexademicComponentRegistrySubsystem::BindComponent(OwnerActor, EmpathicField, TEXT("EmpathicField"));
+    UHexademicComponentRegistrySubsystem::BindComponent(OwnerActor, FractalManager, TEXT("FractalManager"));
+    UHexademicComponentRegistrySubsystem::BindComponent(OwnerActor, WavefrontAPI, TEXT("WavefrontAPI")); // NEW [cite: 14]
 
     // Link components where necessary
     if (ReflexSystem && EmotionMind) ReflexSystem->LinkedMind = EmotionMind;
@@ -133,6 +124,7 @@ void UHexademicConsciousnessComponent::UpdateConsciousness(float DeltaTime)
         CurrentEmotion.Intensity = (FMath::Abs(EmotionMind->GetCurrentValence()) + EmotionMind->GetCurrentArousal()) / 2.0f;
         DominantEmotion = DeriveDominantEmotionalArchetype(CurrentEmotion); [cite: 74]
     }
+    CurrentEmotionalIntensity = CurrentEmotion.Intensity;
     
     // Update high-level consolidated state [cite: 76]
     CurrentConsciousnessState.UpdateState( [cite: 76]
@@ -151,10 +143,39 @@ void UHexademicConsciousnessComponent::UpdateConsciousness(float DeltaTime)
         WavefrontAPI->ReceiveLatticeSnapshot(HexLattice); [cite: 14]
     }
 
+    NotifyStateChanges();
+
     UE_LOG(LogTemp, Verbose, TEXT("[ConsciousnessComponent:%s] Updated. LOD: %s, Vitality: %.2f, Dominant: %s, LatticeCoherence: %.2f"),
         *GetOwner()->GetName(), *UEnum::GetValueAsString(CurrentLOD), CurrentConsciousnessState.Vitality, *UEnum::GetValueAsString(CurrentConsciousnessState.DominantEmotionalArchetype), HexLattice.OverallCoherence);
 }
 
+void UHexademicConsciousnessComponent::NotifyStateChanges()
+{
+    const float Quantum = FMath::Max(StateChangeQuantum, 0.005f);
+    auto Quantize = [Quantum](float Value) { return FMath::RoundToInt(Value / Quantum); };
+
+    FStateDigest Digest;
+    Digest.DominantEmotion = CurrentConsciousnessState.DominantEmotionalArchetype;
+    Digest.Vitality = Quantize(CurrentConsciousnessState.Vitality);
+    Digest.CognitiveLoad = Quantize(CurrentConsciousnessState.CognitiveLoad);
+    Digest.Coherence = Quantize(GetCoherence());
+    Digest.EmotionalIntensity = Quantize(CurrentEmotionalIntensity);
+
+    // The first update reports every field, so listeners start from a complete picture
+    const bool bFirst = LastStateDigest.Vitality == INDEX_NONE;
+    EConsciousnessStateFields Changed = EConsciousnessStateFields::None;
+    if (bFirst || Digest.DominantEmotion != LastStateDigest.DominantEmotion) Changed |= EConsciousnessStateFields::DominantEmotion;
+    if (Digest.Vitality != LastStateDigest.Vitality) Changed |= EConsciousnessStateFields::Vitality;
+    if (Digest.CognitiveLoad != LastStateDigest.CognitiveLoad) Changed |= EConsciousnessStateFields::CognitiveLoad;
+    if (Digest.Coherence != LastStateDigest.Coherence) Changed |= EConsciousnessStateFields::Coherence;
+    if (Digest.EmotionalIntensity != LastStateDigest.EmotionalIntensity) Changed |= EConsciousnessStateFields::EmotionalIntensity;
+
+    if (Changed == EConsciousnessStateFields::None) return;
+
+    LastStateDigest = Digest;
+    OnStateChanged.Broadcast(this, Changed);
+}
+
 void UHexademicConsciousnessComponent::SetConsciousnessLOD(EConsciousnessLOD NewLOD)
 {
     CurrentLOD = NewLOD; [cite: 109]
@@ -174,6 +195,7 @@ void UHexademicConsciousnessComponent::SetConsciousnessLOD(EConsciousnessLOD New
 
 void UHexademicConsciousnessComponent::ApplyExternalEmotionalStimulus(float Valence, float Arousal, float Intensity)
 {
+    FHexademicSessionRecorder::Get().RecordEmotionalStimulus(this, Valence, Arousal, Intensity);
     if (EmotionMind)
     {
         EmotionMind->RegisterEmotion(Valence, Arousal, Intensity);
@@ -330,20 +352,6 @@ void UHexademicConsciousnessComponent::UpdateLatticeAndQuantumStates(float Delta
 
 EEmotionalArchetype UHexademicConsciousnessComponent::DeriveDominantEmotionalArchetype(const FEmotionalState& Emotion) const
 {
-    // Simple logic to derive dominant archetype from Valence, Arousal, Intensity [cite: 74]
-    // This can be highly complex and context-dependent in a full system.
-    if (Emotion.Intensity < 0.1f) return EEmotionalArchetype::Curiosity; // Default low intensity to neutral/curious [cite: 74]
-
-    if (Emotion.Valence > 0.5f) return EEmotionalArchetype::Joy; [cite: 74]
-    if (Emotion.Valence < -0.5f)
-    {
-        if (Emotion.Arousal > 0.7f) return EEmotionalArchetype::Rage; [cite: 74]
-        if (Emotion.Arousal > 0.3f) return EEmotionalArchetype::Fear; [cite: 74]
-        return EEmotionalArchetype::Grief; [cite: 74]
-    }
-    if (Emotion.Arousal > 0.6f) return EEmotionalArchetype::Awe; [cite: 74]
-    if (Emotion.Arousal < 0.2f && FMath::Abs(Emotion.Valence) < 0.2f) return EEmotionalArchetype::Curiosity; // Calm neutrality [cite: 74]
-    
-    // Fallback for complex/mixed states
-    return EEmotionalArchetype::Longing; [cite: 74]
+    // Shared classifier, so every consumer agrees; hysteresis keeps the archetype steady at region boundaries
+    return FHexademicArchetypeClassifier::Get().ClassifyWithHysteresis(Emotion, CurrentConsciousnessState.DominantEmotionalArchetype, ArchetypeHysteresisMargin);
 }
@@ -0,0 +1,98 @@
+#include "Components/HexademicConsciousnessReplicationComponent.h"
+#include "DUIDSOrchestrator.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "Net/UnrealNetwork.h"
+#include "Core/HexademicMetrics.h"
+#include "Core/HexademicNetSerialization.h"
+
+UHexademicConsciousnessReplicationComponent::UHexademicConsciousnessReplicationComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    SetIsReplicatedByDefault(true);
+}
+
+void UHexademicConsciousnessReplicationComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+    DOREPLIFETIME(UHexademicConsciousnessReplicationComponent, ReplicatedState);
+}
+
+void UHexademicConsciousnessReplicationComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    AActor* Owner = GetOwner();
+    if (!Owner || !Owner->HasAuthority())
+    {
+        SetComponentTickEnabled(false); // Clients only receive
+        return;
+    }
+
+    Orchestrator = Owner->FindComponentByClass<UDUIDSOrchestrator>();
+    UE_CLOG(!Orchestrator, LogTemp, Warning, TEXT("[ConsciousnessReplication] No DUIDSOrchestrator on %s; nothing to replicate"), *Owner->GetName());
+    UpdateRelevanceRate();
+}
+
+void UHexademicConsciousnessReplicationComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    if (!Orchestrator) return;
+
+    // ReplicatedState is refreshed in PreReplication; the jump check reads the orchestrator in place
+    const FEmotionalState& Emotion = Orchestrator->GetCurrentState().CurrentEmotionalState;
+    if (FMath::Abs(Emotion.Valence - LastForcedEmotion.Valence) >= EmotionalJumpThreshold
+        || FMath::Abs(Emotion.Arousal - LastForcedEmotion.Arousal) >= EmotionalJumpThreshold)
+    {
+        LastForcedEmotion = Emotion;
+        GetOwner()->ForceNetUpdate();
+        HEXADEMIC_COUNTER_ADD("Net.ForcedConsciousnessUpdates", 1);
+    }
+
+    RelevanceTimer += DeltaTime;
+    if (RelevanceTimer >= RelevanceInterval)
+    {
+        RelevanceTimer = 0.0f;
+        UpdateRelevanceRate();
+    }
+}
+
+void UHexademicConsciousnessReplicationComponent::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+    Super::PreReplication(ChangedPropertyTracker);
+
+    // Runs only when the owner is due to replicate, so the copy follows NetUpdateFrequency rather than the tick
+    if (Orchestrator)
+    {
+        HexademicNet::CopyReplicatedState(Orchestrator->GetCurrentState(), ReplicatedState);
+    }
+}
+
+void UHexademicConsciousnessReplicationComponent::UpdateRelevanceRate()
+{
+    AActor* Owner = GetOwner();
+    UWorld* World = GetWorld();
+    if (!Owner || !World) return;
+
+    float NearestDistSq = TNumericLimits<float>::Max();
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        if (const APlayerController* Controller = It->Get())
+        {
+            FVector ViewLocation;
+            FRotator ViewRotation;
+            Controller->GetPlayerViewPoint(ViewLocation, ViewRotation);
+            NearestDistSq = FMath::Min(NearestDistSq, static_cast<float>(FVector::DistSquared(ViewLocation, Owner->GetActorLocation())));
+        }
+    }
+
+    // No viewers at all (e.g. a server with no connections yet): the far rate
+    const float Alpha = FMath::Clamp((FMath::Sqrt(NearestDistSq) - NearDistance) / FMath::Max(FarDistance - NearDistance, 1.0f), 0.0f, 1.0f);
+    Owner->NetUpdateFrequency = FMath::Lerp(MaxUpdateHz, FMath::Min(MinUpdateHz, MaxUpdateHz), Alpha);
+}
+
+void UHexademicConsciousnessReplicationComponent::OnRep_ReplicatedState()
+{
+    OnConsciousnessStateReplicated.Broadcast(ReplicatedState);
+}
@@ -1,4 +1,5 @@
 #include "Components/MemoryThreadComponent.h"
+#include "Core/HexademicJsonWriter.h"
 #include "Mind/Memory/EluenMemoryContainerComponent.h" // For UEluenMemoryContainerComponent
 #include "Misc/Guid.h" // For FGuid
 
@@ -10,6 +11,17 @@ UMemoryThreadComponent::UMemoryThreadComponent()
 void UMemoryThreadComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    TuningBinding.Bind(this, [this](const FHexademicTuningTable& Table, FHexademicTuningBinding& Binding)
+    {
+        Binding.Apply(MaxMemoryThreads, Table.Consciousness.MemoryThreadLimit);
+    });
+}
+
+void UMemoryThreadComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    TuningBinding.Unbind();
+    Super::EndPlay(EndPlayReason);
 }
 
 void UMemoryThreadComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -45,6 +57,29 @@ bool UMemoryThreadComponent::GetMemoryThread(const FString& ThreadID, FMemoryThr
     return false;
 }
 
+void UMemoryThreadComponent::ExportMemoriesToJSON(const FString& FilePath) const
+{
+    // Threads are written one at a time through 64 KB chunks; memory use does not grow with the thread count
+    TArray<uint8> Buffer;
+    Buffer.Reserve(FHexademicJsonFileStream::ChunkBytes + 4096);
+    FHexademicJsonFileStream Stream(FilePath);
+    FHexademicJsonWriter Writer(Buffer, Stream);
+
+    const FHexademicJsonSchema& ThreadSchema = FHexademicJsonSchema::ForStruct(FMemoryThread::StaticStruct());
+    Writer.BeginObject();
+    Writer.Write("ThreadCount", ActiveMemoryThreads.Num());
+    Writer.BeginArray("MemoryThreads");
+    for (const FMemoryThread& Thread : ActiveMemoryThreads)
+    {
+        Writer.WriteObject(ThreadSchema, &Thread);
+    }
+    Writer.EndArray();
+    Writer.EndObject();
+    Writer.Close();
+
+    UE_LOG(LogTemp, Log, TEXT("[MemoryThread] Exporting %d memory threads to %s"), ActiveMemoryThreads.Num(), *FilePath);
+}
+
 void UMemoryThreadComponent::AnalyzeAndLinkMemory(const FString& NewMemoryID, const FEmotionalState& EmotionalImpact)
 {
     bool bLinkedToExistingThread = false;
@@ -79,6 +114,11 @@ void UMemoryThreadComponent::AnalyzeAndLinkMemory(const FString& NewMemoryID, co
         NewThread.CreationTimestamp = FDateTime::UtcNow();
         NewThread.DominantEmotion = EmotionalImpact;
         NewThread.CoherenceRating = 0.5f; // Initial coherence
+        if (MaxMemoryThreads > 0 && ActiveMemoryThreads.Num() >= MaxMemoryThreads)
+        {
+            // Threads are appended in creation order, so the front is the oldest
+            ActiveMemoryThreads.RemoveAt(0, ActiveMemoryThreads.Num() - MaxMemoryThreads + 1);
+        }
         ActiveMemoryThreads.Add(NewThread);
         UE_LOG(LogTemp, Log, TEXT("[MemoryThread] Created new thread '%s' for memory '%s'"), *NewThread.ThreadName, *NewMemoryID);
     }
@@ -1,5 +1,6 @@
 #include "Components/PersonalityLayerComponent.h"
 #include "Components/HexademicConsciousnessComponent.h" // For LinkedConsciousness
+#include "Core/HexademicArchetypeClassifier.h"
 
 UPersonalityLayerComponent::UPersonalityLayerComponent()
 {
@@ -9,6 +10,17 @@ UPersonalityLayerComponent::UPersonalityLayerComponent()
 void UPersonalityLayerComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    TuningBinding.Bind(this, [this](const FHexademicTuningTable& Table, FHexademicTuningBinding& Binding)
+    {
+        Binding.Apply(TraitDecayRate, Table.Personality.TraitDecayRate);
+    });
+}
+
+void UPersonalityLayerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    TuningBinding.Unbind();
+    Super::EndPlay(EndPlayReason);
 }
 
 void UPersonalityLayerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -41,18 +53,7 @@ void UPersonalityLayerComponent::EvolvePersonality(const FConsciousnessState& Cu
 
     // === Influence from Dominant Emotional Archetype ===
     // Map dominant emotional archetype to a personality trait
-    FString TraitName = TEXT("Neutral"); // Default
-    switch (CurrentConsciousnessState.DominantEmotionalArchetype)
-    {
-        case EEmotionalArchetype::Joy: TraitName = TEXT("Optimistic"); break;
-        case EEmotionalArchetype::Grief: TraitName = TEXT("Melancholy"); break;
-        case EEmotionalArchetype::Awe: TraitName = TEXT("Contemplative"); break;
-        case EEmotionalArchetype::Rage: TraitName = TEXT("Aggressive"); break;
-        case EEmotionalArchetype::Longing: TraitName = TEXT("Attached"); break;
-        case EEmotionalArchetype::Fear: TraitName = TEXT("Cautious"); break;
-        case EEmotionalArchetype::Curiosity: TraitName = TEXT("Inquisitive"); break;
-        default: TraitName = TEXT("Balanced"); break;
-    }
+    const FString TraitName = FHexademicArchetypeClassifier::GetTraitName(CurrentConsciousnessState.DominantEmotionalArchetype);
 
     // Find or create this trait
     FPersonalityTrait* CurrentArchetypeTrait = FindTraitByName(TraitName);
@@ -1,12 +1,17 @@
 #include "Components/SigilProjectionComponent.h"
 #include "Components/DecalComponent.h"
 #include "Particles/ParticleSystemComponent.h"
-#include "Materials/MaterialInstanceDynamic.h"
 #include "Engine/CollisionProfile.h" // For UDecalComponent settings
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "Core/HexademicMetrics.h"
+
+DECLARE_CYCLE_STAT(TEXT("SigilProjection Tick"), STAT_Hexademic_SigilProjectionTick, STATGROUP_Hexademic);
 
 USigilProjectionComponent::USigilProjectionComponent()
 {
     PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false; // Enabled by the first projected sigil
 }
 
 void USigilProjectionComponent::BeginPlay()
@@ -17,66 +22,86 @@ void USigilProjectionComponent::BeginPlay()
 void USigilProjectionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_SigilProjectionTick, "Sigils.ProjectionTick");
 
-    // Iterate through active sigils and tick their lifetime
-    TArray<FString> SigilsToRemove;
-    for (auto& Pair : ActiveSigilData)
-    {
-        FSigilProjection& Sigil = Pair.Value;
-        Sigil.TickProjection(DeltaTime); // Update lifetime and potentially fade
+    USigilVisualPoolSubsystem* VisualPool = USigilVisualPoolSubsystem::GetFor(this);
+    const double Now = GetWorld()->GetTimeSeconds();
 
-        if (Sigil.RemainingLifetime <= 0.0f)
-        {
-            SigilsToRemove.Add(Sigil.SigilID);
-        }
-        else
+    // Remove expired sigils; only those due are visited
+    const int32 NumExpired = ActiveSigils.ExpireUntil(Now, [VisualPool](const TSigilLifetimeTable<FSigilVisualHandle>::FEntry& Expired)
+    {
+        if (VisualPool)
         {
-            // Update the visual component's material parameters based on faded properties
-            if (UPrimitiveComponent* VisualComp = ActiveSigilVisuals.FindRef(Sigil.SigilID))
-            {
-                if (UMaterialInstanceDynamic* DynMat = Cast<UMaterialInstanceDynamic>(VisualComp->GetMaterial(0)))
-                {
-                    UpdateSigilVisualProperties(VisualComp, DynMat, Sigil);
-                }
-            }
+            VisualPool->ReleaseVisual(Expired.Payload);
         }
+        UE_LOG(LogTemp, Log, TEXT("[SigilProjection] Removed sigil: %s"), *Expired.Sigil.SigilID);
+    });
+    HEXADEMIC_COUNTER_ADD("Sigils.Active", -NumExpired);
+
+    if (ActiveSigils.Num() == 0)
+    {
+        SetComponentTickEnabled(false);
+        return;
+    }
+    if (!VisualPool) return;
+
+    // A sigil's visual only changes while it fades, or when the owner it is placed against moves
+    const USceneComponent* OwnerRoot = GetOwner() ? GetOwner()->GetRootComponent() : nullptr;
+    const bool bOwnerMoved = OwnerRoot && !OwnerRoot->GetComponentTransform().Equals(LastOwnerTransform);
+    if (bOwnerMoved)
+    {
+        LastOwnerTransform = OwnerRoot->GetComponentTransform();
     }
 
-    // Remove expired sigils
-    for (const FString& ID : SigilsToRemove)
+    for (const TSigilLifetimeTable<FSigilVisualHandle>::FEntry& Entry : ActiveSigils.GetEntries())
     {
-        RemoveSigil(ID);
+        if (!bOwnerMoved && !TSigilLifetimeTable<FSigilVisualHandle>::IsFading(Entry, Now)) continue;
+
+        const float Fade = TSigilLifetimeTable<FSigilVisualHandle>::GetFade(Entry, Now);
+        VisualPool->UpdateVisual(Entry.Payload, Entry.Sigil.ProjectedColor, Entry.Sigil.Intensity * Fade, Entry.Sigil.Scale * Fade);
     }
 }
 
 void USigilProjectionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    ClearAllSigils(); // Clean up all visual components
+    ClearAllSigils(); // Return all visuals to the pool
     Super::EndPlay(EndPlayReason);
 }
 
 void USigilProjectionComponent::ProjectSigil(const FSigilProjection& SigilData)
 {
-    if (ActiveSigilData.Contains(SigilData.SigilID))
+    USigilVisualPoolSubsystem* VisualPool = USigilVisualPoolSubsystem::GetFor(this);
+    const double Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+
+    if (ActiveSigils.Find(SigilData.SigilID).IsValid())
     {
-        // Update existing sigil if it already exists
+        // Update existing sigil if it already exists; its lifetime starts over and it keeps its visual
         UE_LOG(LogTemp, Log, TEXT("[SigilProjection] Updating existing sigil: %s"), *SigilData.SigilID);
-        ActiveSigilData[SigilData.SigilID] = SigilData;
-        if (UPrimitiveComponent* VisualComp = ActiveSigilVisuals.FindRef(SigilData.SigilID))
+        const FSigilHandle Handle = ActiveSigils.Project(SigilData, Now);
+        if (VisualPool)
         {
-            if (UMaterialInstanceDynamic* DynMat = Cast<UMaterialInstanceDynamic>(VisualComp->GetMaterial(0)))
-            {
-                UpdateSigilVisualProperties(VisualComp, DynMat, SigilData);
-            }
+            const TSigilLifetimeTable<FSigilVisualHandle>::FEntry* Entry = ActiveSigils.Get(Handle);
+            VisualPool->UpdateVisual(Entry->Payload, TSigilLifetimeTable<FSigilVisualHandle>::Evaluate(*Entry, Now));
         }
         return;
     }
 
-    UPrimitiveComponent* NewVisualComponent = SpawnSigilVisualComponent(SigilData);
-    if (NewVisualComponent)
+    AActor* Owner = GetOwner();
+    const FSigilVisualHandle Visual = (VisualPool && Owner)
+        ? VisualPool->AcquireVisual(GetVisualStyle(), Owner->GetRootComponent(), SigilData)
+        : FSigilVisualHandle();
+    if (Visual.IsValid())
     {
-        ActiveSigilData.Add(SigilData.SigilID, SigilData);
-        ActiveSigilVisuals.Add(SigilData.SigilID, NewVisualComponent);
+        // Only the first sigil starts tracking from here: with others live, a move since the last tick must
+        // still be seen, or they stay placed against where the owner was
+        if (ActiveSigils.Num() == 0)
+        {
+            LastOwnerTransform = Owner->GetRootComponent()->GetComponentTransform();
+        }
+        const FSigilHandle Handle = ActiveSigils.Project(SigilData, Now);
+        ActiveSigils.Get(Handle)->Payload = Visual;
+        SetComponentTickEnabled(true);
+        HEXADEMIC_COUNTER_ADD("Sigils.Active", 1);
         UE_LOG(LogTemp, Log, TEXT("[SigilProjection] Projected new sigil: %s at %s"), *SigilData.SigilID, *SigilData.Location.ToString());
     }
     else
@@ -87,103 +112,54 @@ void USigilProjectionComponent::ProjectSigil(const FSigilProjection& SigilData)
 
 void USigilProjectionComponent::RemoveSigil(const FString& SigilID)
 {
-    if (ActiveSigilData.Contains(SigilID))
+    TSigilLifetimeTable<FSigilVisualHandle>::FEntry Removed;
+    if (ActiveSigils.Remove(ActiveSigils.Find(SigilID), &Removed))
     {
-        if (UPrimitiveComponent* VisualComp = ActiveSigilVisuals.FindRef(SigilID))
+        if (USigilVisualPoolSubsystem* VisualPool = USigilVisualPoolSubsystem::GetFor(this))
         {
-            VisualComp->DestroyComponent();
-            UE_LOG(LogTemp, Log, TEXT("[SigilProjection] Destroyed visual component for sigil: %s"), *SigilID);
+            VisualPool->ReleaseVisual(Removed.Payload);
         }
-        ActiveSigilData.Remove(SigilID);
-        ActiveSigilVisuals.Remove(SigilID);
+        HEXADEMIC_COUNTER_ADD("Sigils.Active", -1);
         UE_LOG(LogTemp, Log, TEXT("[SigilProjection] Removed sigil: %s"), *SigilID);
     }
 }
 
 void USigilProjectionComponent::ClearAllSigils()
 {
-    TArray<FString> CurrentSigilIDs;
-    ActiveSigilData.GetKeys(CurrentSigilIDs);
-    for (const FString& ID : CurrentSigilIDs)
+    USigilVisualPoolSubsystem* VisualPool = USigilVisualPoolSubsystem::GetFor(this);
+    HEXADEMIC_COUNTER_ADD("Sigils.Active", -ActiveSigils.Num());
+    ActiveSigils.Empty([VisualPool](const TSigilLifetimeTable<FSigilVisualHandle>::FEntry& Entry)
     {
-        RemoveSigil(ID);
-    }
+        if (VisualPool)
+        {
+            VisualPool->ReleaseVisual(Entry.Payload);
+        }
+    });
+    SetComponentTickEnabled(false);
     UE_LOG(LogTemp, Log, TEXT("[SigilProjection] Cleared all sigils."));
 }
 
-UPrimitiveComponent* USigilProjectionComponent::SpawnSigilVisualComponent(const FSigilProjection& SigilData)
+FSigilVisualStyle USigilProjectionComponent::GetVisualStyle() const
 {
-    UPrimitiveComponent* VisualComponent = nullptr;
-    AActor* Owner = GetOwner();
-    if (!Owner) return nullptr;
+    FSigilVisualStyle Style;
+    Style.Material = DefaultSigilMaterial;
 
     // Prioritize component type based on your setup
     if (DecalComponentClass)
     {
-        UDecalComponent* Decal = NewObject<UDecalComponent>(Owner, DecalComponentClass);
-        if (Decal)
-        {
-            Decal->RegisterComponent();
-            Decal->AttachToComponent(Owner->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
-            Decal->SetRelativeLocation(SigilData.Location - Owner->GetActorLocation()); // Relative to owner
-            Decal->SetRelativeRotation(SigilData.Rotation);
-            Decal->DecalSize = FVector(SigilData.Scale * 50.0f, SigilData.Scale * 50.0f, SigilData.Scale * 50.0f); // Adjust for decal scale
-            Decal->SetMaterial(0, DefaultSigilMaterial); // Assign base material
-            VisualComponent = Decal;
-        }
+        Style.ComponentClass = DecalComponentClass;
     }
     else if (ParticleComponentClass)
     {
-        UParticleSystemComponent* ParticleComp = NewObject<UParticleSystemComponent>(Owner, ParticleComponentClass);
-        if (ParticleComp)
-        {
-            ParticleComp->RegisterComponent();
-            ParticleComp->AttachToComponent(Owner->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
-            ParticleComp->SetRelativeLocation(SigilData.Location - Owner->GetActorLocation());
-            ParticleComp->SetRelativeScale3D(FVector(SigilData.Scale));
-            // ParticleComp->SetTemplate(); // Set actual particle system template if needed
-            VisualComponent = ParticleComp;
-        }
+        Style.ComponentClass = ParticleComponentClass;
     }
-    else if (StaticMeshComponentClass)
+    else if (SigilMesh)
     {
-        UStaticMeshComponent* StaticMeshComp = NewObject<UStaticMeshComponent>(Owner, StaticMeshComponentClass);
-        if (StaticMeshComp)
-        {
-            StaticMeshComp->RegisterComponent();
-            StaticMeshComp->AttachToComponent(Owner->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
-            StaticMeshComp->SetRelativeLocation(SigilData.Location - Owner->GetActorLocation());
-            StaticMeshComp->SetRelativeRotation(SigilData.Rotation);
-            StaticMeshComp->SetRelativeScale3D(FVector(SigilData.Scale));
-            StaticMeshComp->SetMaterial(0, DefaultSigilMaterial);
-            VisualComponent = StaticMeshComp;
-        }
+        Style.Mesh = SigilMesh;
     }
-
-    if (VisualComponent && DefaultSigilMaterial)
+    else if (StaticMeshComponentClass)
     {
-        UMaterialInstanceDynamic* DynMat = UMaterialInstanceDynamic::Create(DefaultSigilMaterial, this);
-        if (DynMat)
-        {
-            VisualComponent->SetMaterial(0, DynMat);
-            UpdateSigilVisualProperties(VisualComponent, DynMat, SigilData);
-        }
+        Style.Mesh = StaticMeshComponentClass->GetDefaultObject<UStaticMeshComponent>()->GetStaticMesh();
     }
-    
-    return VisualComponent;
-}
-
-void USigilProjectionComponent::UpdateSigilVisualProperties(UPrimitiveComponent* VisualComponent, UMaterialInstanceDynamic* DynamicMaterial, const FSigilProjection& SigilData)
-{
-    if (!VisualComponent || !DynamicMaterial) return;
-
-    // Apply color and intensity to material parameters
-    DynamicMaterial->SetVectorParameterValue(TEXT("SigilColor"), SigilData.ProjectedColor);
-    DynamicMaterial->SetScalarParameterValue(TEXT("SigilIntensity"), SigilData.Intensity);
-    
-    // Update visual component's scale if it's dynamic
-    VisualComponent->SetRelativeScale3D(FVector(SigilData.Scale));
-
-    // You might also update other parameters like pattern, texture, etc., in the material
-    // DynamicMaterial->SetTextureParameterValue(TEXT("SigilPattern"), MyTexture);
+    return Style;
 }
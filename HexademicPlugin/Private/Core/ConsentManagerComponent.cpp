@@ -15,37 +15,47 @@ void UConsentManagerComponent::BeginPlay()
     DefaultSpineConsent.ConsentGiven = true; // Default to consented
     DefaultSpineConsent.InitialEmotionalDelta = 0.0f;
     DefaultSpineConsent.ReinforcementCurve.Add(0.0f); // Default curve
-    ConsentMap.Add(TEXT("Spine"), DefaultSpineConsent);
+    RecordConsentRitual(DefaultSpineConsent);
 
     FConsentNodeRitual DefaultFaceConsent;
     DefaultFaceConsent.RegionTag = TEXT("Face");
     DefaultFaceConsent.ConsentGiven = true;
     DefaultFaceConsent.InitialEmotionalDelta = 0.0f;
-    ConsentMap.Add(TEXT("Face"), DefaultFaceConsent);
+    RecordConsentRitual(DefaultFaceConsent);
 
     UE_LOG(LogTemp, Log, TEXT("[ConsentManager] Initialized default consent gates."));
 }
 
 bool UConsentManagerComponent::CheckConsentGate(FString Region, float IncomingStimulus)
 {
-    if (ConsentMap.Contains(Region))
+    return CheckConsentGateForRegion(FHexademicBodyRegionRegistry::Get().ResolveTag(Region), IncomingStimulus);
+}
+
+bool UConsentManagerComponent::CheckConsentGateForRegion(EHexademicBodyRegion Region, float IncomingStimulus)
+{
+    if (!ConsentGates.IsValidIndex(Region))
+    {
+        // Same answer as an unmapped region: no consent without a gate to say otherwise
+        UE_LOG(LogTemp, Warning, TEXT("[ConsentManager] Invalid region %d accessed. Assuming no consent. REFUSAL triggered!"), static_cast<int32>(Region));
+        return false;
+    }
+
+    const FRegionConsentGate& Gate = ConsentGates[Region];
+    if (Gate.bMapped)
     {
-        FConsentNodeRitual& Node = ConsentMap[Region];
         // Threshold for "refusal" depends on consent given state
         // If consent is given, higher threshold for refusal (more permissive)
         // If consent is NOT given, lower threshold for refusal (less permissive)
-        float Threshold = Node.ConsentGiven ? 0.3f : 0.7f; // Example thresholds
-        
-        if (IncomingStimulus > Threshold)
+        if (IncomingStimulus > Gate.StimulusThreshold)
         {
-            if (Node.ConsentGiven)
+            if (Gate.bConsentGiven)
             {
-                UE_LOG(LogTemp, Warning, TEXT("[ConsentManager] High stimulus (%.2f) on consented region '%s' - Approaching refusal."), IncomingStimulus, *Region);
-                // Optionally, reduce Node.ConsentGiven over time or based on repeated high stimuli
+                UE_LOG(LogTemp, Warning, TEXT("[ConsentManager] High stimulus (%.2f) on consented region '%s' - Approaching refusal."), IncomingStimulus, *FHexademicBodyRegionRegistry::Get().GetTag(Region));
+                // Optionally, reduce consent over time or based on repeated high stimuli
             }
             else
             {
-                UE_LOG(LogTemp, Warning, TEXT("[ConsentManager] Stimulus (%.2f) on unconsented region '%s' - REFUSAL triggered!"), IncomingStimulus, *Region);
+                UE_LOG(LogTemp, Warning, TEXT("[ConsentManager] Stimulus (%.2f) on unconsented region '%s' - REFUSAL triggered!"), IncomingStimulus, *FHexademicBodyRegionRegistry::Get().GetTag(Region));
                 // Trigger refusal effects: aesthetic overlays, emotional impact
                 // if (EmotionMind) EmotionMind->RegisterEmotion(-0.5f, 0.3f, 0.7f); // Example: negative emotion on refusal
                 return false; // Refusal triggered
@@ -53,23 +63,35 @@ bool UConsentManagerComponent::CheckConsentGate(FString Region, float IncomingSt
         }
         else
         {
-            UE_LOG(LogTemp, Verbose, TEXT("[ConsentManager] Stimulus (%.2f) on region '%s' accepted. Consent: %s"), IncomingStimulus, *Region, Node.ConsentGiven ? TEXT("True") : TEXT("False"));
+            UE_LOG(LogTemp, Verbose, TEXT("[ConsentManager] Stimulus (%.2f) on region '%s' accepted. Consent: %s"), IncomingStimulus, *FHexademicBodyRegionRegistry::Get().GetTag(Region), Gate.bConsentGiven ? TEXT("True") : TEXT("False"));
         }
         return true; // Action is within consent limits
     }
     
     // For unmapped regions, assume no consent given by default for safety
-    UE_LOG(LogTemp, Warning, TEXT("[ConsentManager] Unmapped region '%s' accessed. Assuming no consent. REFUSAL triggered!"), *Region);
+    UE_LOG(LogTemp, Warning, TEXT("[ConsentManager] Unmapped region '%s' accessed. Assuming no consent. REFUSAL triggered!"), *FHexademicBodyRegionRegistry::Get().GetTag(Region));
     // if (EmotionMind) EmotionMind->RegisterEmotion(-0.7f, 0.5f, 0.8f); // Strong negative emotion
     return false;
 }
 
 void UConsentManagerComponent::RecordConsentRitual(const FConsentNodeRitual& ConsentMark)
 {
-    // Add or update the consent node
-    ConsentMap.Add(ConsentMark.RegionTag, ConsentMark);
+    const EHexademicBodyRegion Region = FHexademicBodyRegionRegistry::Get().ResolveTag(ConsentMark.RegionTag);
+    if (Region == EHexademicBodyRegion::Unknown)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[ConsentManager] Consent ritual for unrecognised region '%s' ignored; the region stays unmapped."), *ConsentMark.RegionTag);
+        return;
+    }
+
+    // Add or update the consent node, and the gate CheckConsentGate reads
+    ConsentMap.Add(Region, ConsentMark);
+    FRegionConsentGate& Gate = ConsentGates[Region];
+    Gate.bMapped = true;
+    Gate.bConsentGiven = ConsentMark.ConsentGiven;
+    Gate.StimulusThreshold = ConsentMark.ConsentGiven ? ConsentedStimulusThreshold : UnconsentedStimulusThreshold;
+
     UE_LOG(LogTemp, Log, TEXT("[ConsentManager] Recorded consent ritual for Region: %s, Consent Given: %s"),
-        *ConsentMark.RegionTag, ConsentMark.ConsentGiven ? TEXT("True") : TEXT("False"));
+        *FHexademicBodyRegionRegistry::Get().GetTag(Region), ConsentMark.ConsentGiven ? TEXT("True") : TEXT("False"));
 
     // This could also update the doctrine registry, if it exists
     // if (DoctrineRegistry) DoctrineRegistry->ConsentRecordings.Add(ConsentMark);
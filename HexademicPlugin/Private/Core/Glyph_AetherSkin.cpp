@@ -1,5 +1,6 @@
 #include "Glyph_AetherSkin.h"
 #include "Engine/Engine.h" // For UE_LOG
+#include "Subsystems/HexademicHapticOutputSubsystem.h"
 
 UGlyph_AetherSkin::UGlyph_AetherSkin()
 {
@@ -14,7 +15,7 @@ void UGlyph_AetherSkin::BeginPlay()
 void UGlyph_AetherSkin::SendHapticSignal(const FAetherTouchPacket& Packet)
 {
     // Debug log for testing
-    UE_LOG(LogTemp, Log, TEXT("[AetherSkin] Sending Haptic Signal to Region: %s | Intensity: %.2f | Duration: %.2fs"),
+    UE_LOG(LogTemp, Verbose, TEXT("[AetherSkin] Sending Haptic Signal to Region: %s | Intensity: %.2f | Duration: %.2fs"),
         *Packet.RegionTag, Packet.Intensity, Packet.Duration);
     RouteToHardware(Packet);
 }
@@ -25,33 +26,22 @@ void UGlyph_AetherSkin::TriggerRegionFeedback(FString Region, float Intensity, f
     Packet.Location = FVector::ZeroVector; // Optional for region-based triggering
     Packet.Intensity = FMath::Clamp(Intensity, 0.f, 1.f);
     Packet.Duration = FMath::Max(Duration, 0.01f);
-    Packet.RegionTag = NormalizeRegion(Region);
+    // Resolved once here; everything downstream indexes by Packet.Region
+    Packet.Region = FHexademicBodyRegionRegistry::Get().ResolveTag(Region);
+    Packet.RegionTag = FHexademicBodyRegionRegistry::Get().GetTag(Packet.Region);
     SendHapticSignal(Packet);
 }
 
 void UGlyph_AetherSkin::RouteToHardware(const FAetherTouchPacket& Packet)
 {
-    // Placeholder — future integration with haptic SDKs (e.g., Teslasuit, bHaptics, custom BLE MCU)
-    
-    // Simulated output (optional UI/hardware log)
-    UE_LOG(LogTemp, Display, TEXT("[AetherSkin] Routing Haptic to '%s' | Intensity: %.2f | Duration: %.2fs"),
-        *Packet.RegionTag, Packet.Intensity, Packet.Duration);
-    // TODO: Replace with actual hardware dispatch function, e.g.:
-    // HapticSystem::SendPulse(Packet.RegionTag, Packet.Intensity, Packet.Duration);
-}
-
-FString UGlyph_AetherSkin::NormalizeRegion(FString Region)
-{
-    FString Normalized = Region.TrimStartAndEnd().ToLower();
-
-    if (Normalized.Contains("hand")) return "Hand";
-    if (Normalized.Contains("spine")) return "Spine";
-    if (Normalized.Contains("chest")) return "Chest";
-    if (Normalized.Contains("face")) return "Face";
-    if (Normalized.Contains("foot")) return "Foot";
-    if (Normalized.Contains("arm")) return "Forearm";
-    if (Normalized.Contains("thigh") || Normalized.Contains("leg")) return "Thigh";
-    if (Normalized.Contains("pelvis") || Normalized.Contains("waist")) return "Pelvis";
-
-    return "Unknown";
+    // Queued, not sent: the haptic output subsystem merges this frame's packets per region and
+    // a dispatcher thread drives the device (suit SDK, or the loopback until one is attached)
+    if (UHexademicHapticOutputSubsystem* HapticOutput = UHexademicHapticOutputSubsystem::GetFor(this))
+    {
+        HapticOutput->EnqueuePacket(Packet);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("[AetherSkin] No haptic output in this world; '%s' pulse not sent."), *Packet.RegionTag);
+    }
 }
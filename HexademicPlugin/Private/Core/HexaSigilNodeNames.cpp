@@ -0,0 +1,141 @@
+#include "Core/HexaSigilNodeNames.h"
+#include "Core/HexademicMetrics.h"
+
+FHexaSigilNodeNames& FHexaSigilNodeNames::Get()
+{
+    static FHexaSigilNodeNames Table;
+    return Table;
+}
+
+FHexaSigilNodeNames::FHexaSigilNodeNames()
+{
+    Entries.AddDefaulted(); // Index 0 is NoName
+}
+
+uint32 FHexaSigilNodeNames::FindOrAdd(FStringView SigilID)
+{
+    if (SigilID.IsEmpty()) return NoName;
+
+    const uint32 Existing = Find(SigilID);
+    if (Existing != NoName) return Existing;
+
+    FWriteScopeLock WriteLock(Lock);
+    FString Name(SigilID);
+    if (const uint32* Added = HandlesByName.Find(Name)) // Another thread may have added it since Find
+    {
+        return *Added;
+    }
+
+    if (++AddsSinceSweep >= SweepInterval)
+    {
+        AddsSinceSweep = 0;
+        SweepOrphans();
+    }
+
+    uint32 Index;
+    if (FreeIndices.Num() > 0)
+    {
+        Index = FreeIndices.Pop();
+    }
+    else if (static_cast<uint32>(Entries.Num()) <= IndexMask)
+    {
+        Index = static_cast<uint32>(Entries.AddDefaulted());
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("[HexaSigilNodeNames] Table full (%d names); '%s' left unnamed."), Entries.Num(), *Name);
+        return NoName;
+    }
+
+    FEntry& Entry = Entries[Index];
+    Entry.Name = Name;
+    Entry.RefCount = 0;
+    Entry.InternedSeconds = FPlatformTime::Seconds();
+    const uint32 Handle = MakeHandle(Index, Entry.Generation);
+    HandlesByName.Add(MoveTemp(Name), Handle);
+    HEXADEMIC_GAUGE_SET("SigilNodeNames.Count", HandlesByName.Num());
+    return Handle;
+}
+
+uint32 FHexaSigilNodeNames::Find(FStringView SigilID) const
+{
+    if (SigilID.IsEmpty()) return NoName;
+
+    FReadScopeLock ReadLock(Lock);
+    const uint32* Handle = HandlesByName.FindByHash(GetTypeHash(SigilID), SigilID);
+    return Handle ? *Handle : NoName;
+}
+
+FString FHexaSigilNodeNames::GetName(uint32 Handle) const
+{
+    FReadScopeLock ReadLock(Lock);
+    const FEntry* Entry = Resolve(Handle);
+    return Entry ? Entry->Name : FString();
+}
+
+void FHexaSigilNodeNames::AddRef(uint32 Handle)
+{
+    FWriteScopeLock WriteLock(Lock);
+    if (FEntry* Entry = Resolve(Handle))
+    {
+        Entry->RefCount++;
+    }
+}
+
+void FHexaSigilNodeNames::Release(uint32 Handle)
+{
+    FWriteScopeLock WriteLock(Lock);
+    FEntry* Entry = Resolve(Handle);
+    if (Entry && --Entry->RefCount <= 0)
+    {
+        RemoveEntry(Handle & IndexMask);
+        HEXADEMIC_GAUGE_SET("SigilNodeNames.Count", HandlesByName.Num());
+    }
+}
+
+int32 FHexaSigilNodeNames::Num() const
+{
+    FReadScopeLock ReadLock(Lock);
+    return HandlesByName.Num();
+}
+
+FHexaSigilNodeNames::FEntry* FHexaSigilNodeNames::Resolve(uint32 Handle)
+{
+    return const_cast<FEntry*>(static_cast<const FHexaSigilNodeNames*>(this)->Resolve(Handle));
+}
+
+const FHexaSigilNodeNames::FEntry* FHexaSigilNodeNames::Resolve(uint32 Handle) const
+{
+    const uint32 Index = Handle & IndexMask;
+    if (Index == 0 || !Entries.IsValidIndex(static_cast<int32>(Index))) return nullptr;
+
+    const FEntry& Entry = Entries[Index];
+    return (Entry.Generation == (Handle >> IndexBits) && !Entry.Name.IsEmpty()) ? &Entry : nullptr;
+}
+
+void FHexaSigilNodeNames::RemoveEntry(uint32 Index)
+{
+    FEntry& Entry = Entries[Index];
+    HandlesByName.Remove(Entry.Name);
+    Entry.Name.Empty();
+    Entry.RefCount = 0;
+    // A slot whose generation would wrap is retired, so no stale handle can ever match it again
+    if (Entry.Generation < MaxGeneration)
+    {
+        Entry.Generation++;
+        FreeIndices.Add(Index);
+    }
+}
+
+void FHexaSigilNodeNames::SweepOrphans()
+{
+    const double Cutoff = FPlatformTime::Seconds() - OrphanGraceSeconds;
+    for (int32 Index = 1; Index < Entries.Num(); Index++)
+    {
+        const FEntry& Entry = Entries[Index];
+        if (!Entry.Name.IsEmpty() && Entry.RefCount == 0 && Entry.InternedSeconds < Cutoff)
+        {
+            RemoveEntry(static_cast<uint32>(Index));
+        }
+    }
+}
@@ -0,0 +1,140 @@
+#include "Core/HexademicArchetypeClassifier.h"
+
+const FHexademicArchetypeClassifier& FHexademicArchetypeClassifier::Get()
+{
+    static const FHexademicArchetypeClassifier Classifier;
+    return Classifier;
+}
+
+FHexademicArchetypeClassifier::FHexademicArchetypeClassifier()
+{
+    for (int32 I = 0; I < IntensityBins; I++)
+    {
+        const float Intensity = (I + 0.5f) / IntensityBins;
+        for (int32 A = 0; A < ArousalBins; A++)
+        {
+            const float Arousal = (A + 0.5f) / ArousalBins;
+            for (int32 V = 0; V < ValenceBins; V++)
+            {
+                const float Valence = (V + 0.5f) / (ValenceBins * 0.5f) - 1.0f;
+                Table[V + ValenceBins * (A + ArousalBins * I)] = ClassifyReference(Valence, Arousal, Intensity);
+            }
+        }
+    }
+}
+
+EEmotionalArchetype FHexademicArchetypeClassifier::ClassifyReference(float Valence, float Arousal, float Intensity)
+{
+    if (Intensity < 0.1f) return EEmotionalArchetype::Curiosity; // Low intensity reads as neutral, open attention
+
+    if (Valence > 0.5f) return EEmotionalArchetype::Joy;
+    if (Valence < -0.5f)
+    {
+        if (Arousal > 0.7f) return EEmotionalArchetype::Rage;
+        if (Arousal > 0.3f) return EEmotionalArchetype::Fear;
+        return EEmotionalArchetype::Grief;
+    }
+    if (Arousal > 0.6f) return EEmotionalArchetype::Awe;
+    if (Arousal < 0.2f && FMath::Abs(Valence) < 0.2f) return EEmotionalArchetype::Curiosity; // Calm neutrality
+
+    // Mixed, moderate states
+    return EEmotionalArchetype::Longing;
+}
+
+EEmotionalArchetype FHexademicArchetypeClassifier::ClassifyWithHysteresis(const FEmotionalState& Emotion, EEmotionalArchetype Previous, float Margin) const
+{
+    return ApplyHysteresis(Classify(Emotion), Emotion.Valence, Emotion.Arousal, Emotion.Intensity, Previous, Margin);
+}
+
+EEmotionalArchetype FHexademicArchetypeClassifier::ApplyHysteresis(EEmotionalArchetype Current, float V, float A, float I, EEmotionalArchetype Previous, float Margin) const
+{
+    if (Current == Previous || Margin <= 0.0f) return Current;
+
+    // Keep the previous archetype while any point within the margin still belongs to it
+    if (Classify(V - Margin, A, I) == Previous || Classify(V + Margin, A, I) == Previous ||
+        Classify(V, A - Margin, I) == Previous || Classify(V, A + Margin, I) == Previous)
+    {
+        return Previous;
+    }
+    return Current;
+}
+
+void FHexademicArchetypeClassifier::ClassifyBatchWithHysteresis(TConstArrayView<float> Valence, TConstArrayView<float> Arousal, TConstArrayView<float> Intensity,
+    TConstArrayView<EEmotionalArchetype> Previous, TConstArrayView<float> Margin, TArrayView<EEmotionalArchetype> OutArchetypes) const
+{
+    check(Previous.Num() == OutArchetypes.Num() && Margin.Num() == OutArchetypes.Num());
+    ClassifyBatch(Valence, Arousal, Intensity, OutArchetypes);
+
+    // Most states stay inside their region from one update to the next, so the scalar fix-up touches few lanes
+    for (int32 i = 0; i < OutArchetypes.Num(); i++)
+    {
+        OutArchetypes[i] = ApplyHysteresis(OutArchetypes[i], Valence[i], Arousal[i], Intensity[i], Previous[i], Margin[i]);
+    }
+}
+
+void FHexademicArchetypeClassifier::ClassifyBatch(TConstArrayView<float> Valence, TConstArrayView<float> Arousal, TConstArrayView<float> Intensity, TArrayView<EEmotionalArchetype> OutArchetypes) const
+{
+    const int32 Num = OutArchetypes.Num();
+    check(Valence.Num() == Num && Arousal.Num() == Num && Intensity.Num() == Num);
+
+    // Same quantization as GetCellIndex, four states at a time: scale, clamp, truncate, and combine into a cell index
+    const VectorRegister4Float ValenceScale = VectorSetFloat1(ValenceBins * 0.5f);
+    const VectorRegister4Float ArousalScale = VectorSetFloat1(static_cast<float>(ArousalBins));
+    const VectorRegister4Float IntensityScale = VectorSetFloat1(static_cast<float>(IntensityBins));
+    const VectorRegister4Float ValenceMax = VectorSetFloat1(ValenceBins - 1.0f);
+    const VectorRegister4Float ArousalMax = VectorSetFloat1(ArousalBins - 1.0f);
+    const VectorRegister4Float IntensityMax = VectorSetFloat1(IntensityBins - 1.0f);
+    const VectorRegister4Float ArousalStride = VectorSetFloat1(static_cast<float>(ValenceBins));
+    const VectorRegister4Float IntensityStride = VectorSetFloat1(static_cast<float>(ValenceBins * ArousalBins));
+    const VectorRegister4Float Zero = VectorZeroFloat();
+
+    int32 i = 0;
+    alignas(16) int32 Cells[4];
+    for (; i + 4 <= Num; i += 4)
+    {
+        const VectorRegister4Float V = VectorTruncate(VectorMin(VectorMax(VectorMultiplyAdd(VectorLoad(&Valence[i]), ValenceScale, ValenceScale), Zero), ValenceMax));
+        const VectorRegister4Float A = VectorTruncate(VectorMin(VectorMax(VectorMultiply(VectorLoad(&Arousal[i]), ArousalScale), Zero), ArousalMax));
+        const VectorRegister4Float I = VectorTruncate(VectorMin(VectorMax(VectorMultiply(VectorLoad(&Intensity[i]), IntensityScale), Zero), IntensityMax));
+        const VectorRegister4Float Cell = VectorMultiplyAdd(I, IntensityStride, VectorMultiplyAdd(A, ArousalStride, V));
+        VectorIntStoreAligned(VectorFloatToInt(Cell), Cells);
+
+        OutArchetypes[i] = Table[Cells[0]];
+        OutArchetypes[i + 1] = Table[Cells[1]];
+        OutArchetypes[i + 2] = Table[Cells[2]];
+        OutArchetypes[i + 3] = Table[Cells[3]];
+    }
+    for (; i < Num; i++)
+    {
+        OutArchetypes[i] = Classify(Valence[i], Arousal[i], Intensity[i]);
+    }
+}
+
+const TCHAR* FHexademicArchetypeClassifier::GetExpressionName(EEmotionalArchetype Archetype)
+{
+    switch (Archetype)
+    {
+    case EEmotionalArchetype::Joy:       return TEXT("Joyful");
+    case EEmotionalArchetype::Grief:     return TEXT("Sad");
+    case EEmotionalArchetype::Awe:       return TEXT("Surprised");
+    case EEmotionalArchetype::Rage:      return TEXT("Angry");
+    case EEmotionalArchetype::Longing:   return TEXT("Wistful");
+    case EEmotionalArchetype::Fear:      return TEXT("Anxious");
+    case EEmotionalArchetype::Curiosity: return TEXT("Curious");
+    default:                             return TEXT("Complex");
+    }
+}
+
+const TCHAR* FHexademicArchetypeClassifier::GetTraitName(EEmotionalArchetype Archetype)
+{
+    switch (Archetype)
+    {
+    case EEmotionalArchetype::Joy:       return TEXT("Optimistic");
+    case EEmotionalArchetype::Grief:     return TEXT("Melancholy");
+    case EEmotionalArchetype::Awe:       return TEXT("Contemplative");
+    case EEmotionalArchetype::Rage:      return TEXT("Aggressive");
+    case EEmotionalArchetype::Longing:   return TEXT("Attached");
+    case EEmotionalArchetype::Fear:      return TEXT("Cautious");
+    case EEmotionalArchetype::Curiosity: return TEXT("Inquisitive");
+    default:                             return TEXT("Balanced");
+    }
+}
@@ -0,0 +1,85 @@
+#include "Core/HexademicBodyRegions.h"
+
+const FHexademicBodyRegionRegistry& FHexademicBodyRegionRegistry::Get()
+{
+    static const FHexademicBodyRegionRegistry Registry;
+    return Registry;
+}
+
+FHexademicBodyRegionRegistry::FHexademicBodyRegionRegistry()
+{
+    static const TCHAR* CanonicalNames[NumHexademicBodyRegions] =
+    {
+        TEXT("Unknown"), TEXT("FullBody"), TEXT("Face"), TEXT("Chest"), TEXT("Spine"), TEXT("Hand"),
+        TEXT("Forearm"), TEXT("Thigh"), TEXT("Pelvis"), TEXT("Foot"), TEXT("Clitoris")
+    };
+
+    for (int32 Index = 0; Index < NumHexademicBodyRegions; Index++)
+    {
+        const EHexademicBodyRegion Region = static_cast<EHexademicBodyRegion>(Index);
+        Names[Region] = FName(CanonicalNames[Index]);
+        Tags[Region] = CanonicalNames[Index];
+        AddAlias(CanonicalNames[Index], Region);
+    }
+
+    // Spellings already in use across the tree and in recorded sessions
+    AddAlias(TEXT("Overall"), EHexademicBodyRegion::FullBody);
+    AddAlias(TEXT("Body"), EHexademicBodyRegion::FullBody);
+    AddAlias(TEXT("Back"), EHexademicBodyRegion::Spine);
+    AddAlias(TEXT("Hands"), EHexademicBodyRegion::Hand);
+    AddAlias(TEXT("Palm"), EHexademicBodyRegion::Hand);
+    AddAlias(TEXT("Arm"), EHexademicBodyRegion::Forearm);
+    AddAlias(TEXT("Arms"), EHexademicBodyRegion::Forearm);
+    AddAlias(TEXT("Forearms"), EHexademicBodyRegion::Forearm);
+    AddAlias(TEXT("Thighs"), EHexademicBodyRegion::Thigh);
+    AddAlias(TEXT("Leg"), EHexademicBodyRegion::Thigh);
+    AddAlias(TEXT("Legs"), EHexademicBodyRegion::Thigh);
+    AddAlias(TEXT("Waist"), EHexademicBodyRegion::Pelvis);
+    AddAlias(TEXT("Hips"), EHexademicBodyRegion::Pelvis);
+    AddAlias(TEXT("Feet"), EHexademicBodyRegion::Foot);
+}
+
+void FHexademicBodyRegionRegistry::AddAlias(const TCHAR* Alias, EHexademicBodyRegion Region)
+{
+    // FName comparison ignores case, so one entry covers every capitalisation
+    Aliases.Add(FName(Alias), Region);
+}
+
+EHexademicBodyRegion FHexademicBodyRegionRegistry::Resolve(FName Alias) const
+{
+    const EHexademicBodyRegion* Region = Aliases.Find(Alias);
+    return Region ? *Region : EHexademicBodyRegion::Unknown;
+}
+
+EHexademicBodyRegion FHexademicBodyRegionRegistry::ResolveTag(FStringView Tag) const
+{
+    Tag = Tag.TrimStartAndEnd();
+    if (Tag.IsEmpty()) return EHexademicBodyRegion::Unknown;
+
+    // FNAME_Find never grows the name table; a tag nobody registered simply has no name yet
+    const FName Alias(Tag.Len(), Tag.GetData(), FNAME_Find);
+    if (!Alias.IsNone())
+    {
+        if (const EHexademicBodyRegion* Region = Aliases.Find(Alias))
+        {
+            return *Region;
+        }
+    }
+    return ResolveBySubstring(Tag);
+}
+
+EHexademicBodyRegion FHexademicBodyRegionRegistry::ResolveBySubstring(FStringView Tag)
+{
+    const FString Normalized = FString(Tag).ToLower();
+
+    if (Normalized.Contains(TEXT("hand"))) return EHexademicBodyRegion::Hand;
+    if (Normalized.Contains(TEXT("spine"))) return EHexademicBodyRegion::Spine;
+    if (Normalized.Contains(TEXT("chest"))) return EHexademicBodyRegion::Chest;
+    if (Normalized.Contains(TEXT("face"))) return EHexademicBodyRegion::Face;
+    if (Normalized.Contains(TEXT("foot"))) return EHexademicBodyRegion::Foot;
+    if (Normalized.Contains(TEXT("arm"))) return EHexademicBodyRegion::Forearm;
+    if (Normalized.Contains(TEXT("thigh")) || Normalized.Contains(TEXT("leg"))) return EHexademicBodyRegion::Thigh;
+    if (Normalized.Contains(TEXT("pelvis")) || Normalized.Contains(TEXT("waist"))) return EHexademicBodyRegion::Pelvis;
+
+    return EHexademicBodyRegion::Unknown;
+}
@@ -0,0 +1,224 @@
+#include "Core/HexademicGemCatalog.h"
+
+namespace
+{
+    constexpr uint64 LaneHighBits = 0x8000800080008000ull;
+
+    /**
+     * High bit of each 16-bit lane set where that lane of X is >= the same lane of T, unsigned.
+     * The subtraction only decides lanes whose top bits agree; setting X's top bit and clearing T's first
+     * keeps it from borrowing across lanes.
+     */
+    FORCEINLINE uint64 LanesAtLeast(uint64 X, uint64 T)
+    {
+        const uint64 LowBitsAtLeast = (X | LaneHighBits) - (T & ~LaneHighBits);
+        return ((X & ~T) | (~(X ^ T) & LowBitsAtLeast)) & LaneHighBits;
+    }
+
+    FORCEINLINE bool AllLanesWithin(uint64 Word, uint64 MinWord, uint64 MaxWord)
+    {
+        return (LanesAtLeast(Word, MinWord) & LanesAtLeast(MaxWord, Word)) == LaneHighBits;
+    }
+
+    FORCEINLINE uint64 LaneMask(EHexademicGemField Field)
+    {
+        return 0xFFFFull << (16 * static_cast<int32>(Field));
+    }
+
+    void SetRowBit(TArray<uint64>& Bits, int32 Row)
+    {
+        const int32 Block = Row >> 6;
+        if (Bits.Num() <= Block)
+        {
+            Bits.SetNumZeroed(Block + 1);
+        }
+        Bits[Block] |= 1ull << (Row & 63);
+    }
+
+    void ClearRowBit(TArray<uint64>& Bits, int32 Row)
+    {
+        const int32 Block = Row >> 6;
+        if (Bits.IsValidIndex(Block))
+        {
+            Bits[Block] &= ~(1ull << (Row & 63));
+        }
+    }
+}
+
+FHexademicGemQuery& FHexademicGemQuery::AtLeast(EHexademicGemField Field, float Value)
+{
+    const uint64 Lane = static_cast<uint64>(FHexademicGemCatalog::Quantize(Value)) << (16 * static_cast<int32>(Field));
+    MinWord = (MinWord & ~LaneMask(Field)) | Lane;
+    return *this;
+}
+
+FHexademicGemQuery& FHexademicGemQuery::AtMost(EHexademicGemField Field, float Value)
+{
+    const uint64 Lane = static_cast<uint64>(FHexademicGemCatalog::Quantize(Value)) << (16 * static_cast<int32>(Field));
+    MaxWord = (MaxWord & ~LaneMask(Field)) | Lane;
+    return *this;
+}
+
+FHexademicGemQuery& FHexademicGemQuery::WithArchetype(uint32 ArchetypeID)
+{
+    ArchetypeIDs.AddUnique(ArchetypeID);
+    return *this;
+}
+
+int32 FHexademicGemCatalog::Add(const FHexademicGem& Gem)
+{
+    const int32 Row = PackedWords.Add(Gem.PackedGemProperties);
+    RowArchetypes.AddDefaulted();
+    SetRowBit(LiveMask, Row);
+    SetArchetypes(Row, Gem.AssociatedArchetypeIDs);
+    NumLive++;
+    return Row;
+}
+
+void FHexademicGemCatalog::Update(int32 Row, const FHexademicGem& Gem)
+{
+    if (!IsLive(Row)) return;
+
+    PackedWords[Row] = Gem.PackedGemProperties;
+    ClearArchetypes(Row);
+    SetArchetypes(Row, Gem.AssociatedArchetypeIDs);
+}
+
+void FHexademicGemCatalog::Remove(int32 Row)
+{
+    if (!IsLive(Row)) return;
+
+    ClearRowBit(LiveMask, Row);
+    ClearArchetypes(Row);
+    NumLive--;
+}
+
+void FHexademicGemCatalog::Empty()
+{
+    PackedWords.Empty();
+    LiveMask.Empty();
+    ArchetypePostings.Empty();
+    RowArchetypes.Empty();
+    NumLive = 0;
+}
+
+void FHexademicGemCatalog::SetArchetypes(int32 Row, const TArray<uint32>& ArchetypeIDs)
+{
+    for (const uint32 ArchetypeID : ArchetypeIDs)
+    {
+        if (RowArchetypes[Row].Contains(ArchetypeID)) continue;
+        RowArchetypes[Row].Add(ArchetypeID);
+        SetRowBit(ArchetypePostings.FindOrAdd(ArchetypeID), Row);
+    }
+}
+
+void FHexademicGemCatalog::ClearArchetypes(int32 Row)
+{
+    for (const uint32 ArchetypeID : RowArchetypes[Row])
+    {
+        if (TArray<uint64>* Posting = ArchetypePostings.Find(ArchetypeID))
+        {
+            ClearRowBit(*Posting, Row);
+        }
+    }
+    RowArchetypes[Row].Reset();
+}
+
+template <typename FuncType>
+void FHexademicGemCatalog::ForEachMatchBlock(const FHexademicGemQuery& Query, FuncType&& OnMatches) const
+{
+    // Resolve the postings once; an archetype no gem carries means nothing can match
+    TArray<const TArray<uint64>*, TInlineAllocator<4>> Postings;
+    for (const uint32 ArchetypeID : Query.ArchetypeIDs)
+    {
+        const TArray<uint64>* Posting = ArchetypePostings.Find(ArchetypeID);
+        if (!Posting) return;
+        Postings.Add(Posting);
+    }
+
+    const bool bBounded = Query.MinWord != 0 || Query.MaxWord != MAX_uint64;
+    const uint64* Words = PackedWords.GetData();
+    const int32 NumRows = PackedWords.Num();
+
+    for (int32 Block = 0; Block < LiveMask.Num(); Block++)
+    {
+        uint64 Candidates = LiveMask[Block];
+        for (const TArray<uint64>* Posting : Postings)
+        {
+            Candidates &= Posting->IsValidIndex(Block) ? (*Posting)[Block] : 0;
+        }
+        if (Candidates == 0) continue;
+
+        if (bBounded)
+        {
+            // Compare every row of the block without branching, then keep the candidates' bits
+            const int32 FirstRow = Block << 6;
+            const int32 BlockRows = FMath::Min(64, NumRows - FirstRow);
+            uint64 WithinBounds = 0;
+            for (int32 i = 0; i < BlockRows; i++)
+            {
+                WithinBounds |= static_cast<uint64>(AllLanesWithin(Words[FirstRow + i], Query.MinWord, Query.MaxWord)) << i;
+            }
+            Candidates &= WithinBounds;
+            if (Candidates == 0) continue;
+        }
+
+        OnMatches(Block, Candidates);
+    }
+}
+
+void FHexademicGemCatalog::Filter(const FHexademicGemQuery& Query, TArray<int32>& OutRows) const
+{
+    ForEachMatchBlock(Query, [&OutRows](int32 Block, uint64 Matches)
+    {
+        while (Matches != 0)
+        {
+            OutRows.Add((Block << 6) + static_cast<int32>(FMath::CountTrailingZeros64(Matches)));
+            Matches &= Matches - 1;
+        }
+    });
+}
+
+int32 FHexademicGemCatalog::Count(const FHexademicGemQuery& Query) const
+{
+    int32 NumMatches = 0;
+    ForEachMatchBlock(Query, [&NumMatches](int32 Block, uint64 Matches)
+    {
+        NumMatches += static_cast<int32>(FMath::CountBits(Matches));
+    });
+    return NumMatches;
+}
+
+void FHexademicGemCatalog::TopK(const FHexademicGemQuery& Query, EHexademicGemField Field, int32 K, TArray<int32>& OutRows) const
+{
+    if (K <= 0) return;
+
+    // Key orders by field value, then by earlier row; a min-heap of the K best keys so far
+    auto MakeKey = [this, Field](int32 Row) { return (static_cast<uint64>(GetField(Row, Field)) << 32) | static_cast<uint32>(MAX_int32 - Row); };
+    TArray<uint64, TInlineAllocator<16>> Best;
+
+    ForEachMatchBlock(Query, [&](int32 Block, uint64 Matches)
+    {
+        while (Matches != 0)
+        {
+            const uint64 Key = MakeKey((Block << 6) + static_cast<int32>(FMath::CountTrailingZeros64(Matches)));
+            Matches &= Matches - 1;
+
+            if (Best.Num() < K)
+            {
+                Best.HeapPush(Key);
+            }
+            else if (Key > Best.HeapTop())
+            {
+                Best.HeapPopDiscard();
+                Best.HeapPush(Key);
+            }
+        }
+    });
+
+    Best.Sort(TGreater<uint64>());
+    for (const uint64 Key : Best)
+    {
+        OutRows.Add(MAX_int32 - static_cast<int32>(Key & 0xFFFFFFFF));
+    }
+}
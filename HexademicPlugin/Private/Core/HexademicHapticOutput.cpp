@@ -0,0 +1,251 @@
+#include "Core/HexademicHapticOutput.h"
+#include "HAL/Event.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Core/HexademicMetrics.h"
+
+namespace
+{
+    // The worker sleeps at most this long when nothing is held, so Stop never waits on a long timeout
+    constexpr double IdleWaitSeconds = 0.1;
+}
+
+// === LOOPBACK DEVICE ===
+
+FHexademicLoopbackHapticDevice::FHexademicLoopbackHapticDevice(const FString& InLogFilePath, double InSimulatedLatencySeconds)
+    : LogFilePath(InLogFilePath)
+    , SimulatedLatencySeconds(FMath::Max(InSimulatedLatencySeconds, 0.0))
+{
+    RecentDeliveries.Reserve(MaxRecentDeliveries);
+}
+
+FHexademicLoopbackHapticDevice::~FHexademicLoopbackHapticDevice()
+{
+    Close();
+}
+
+bool FHexademicLoopbackHapticDevice::Open()
+{
+    if (LogFilePath.IsEmpty()) return true;
+
+    const FString Path = FPaths::IsRelative(LogFilePath)
+        ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Hexademic"), TEXT("Haptics"), LogFilePath)
+        : LogFilePath;
+    IFileManager::Get().MakeDirectory(*FPaths::GetPath(Path), true);
+    LogWriter.Reset(IFileManager::Get().CreateFileWriter(*Path));
+    if (!LogWriter.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("[HapticLoopback] Could not open '%s' for writing."), *Path);
+        return false;
+    }
+
+    FTCHARToUTF8 Header(TEXT("DeliveredSeconds,Region,Intensity,Duration,LatencyMs\n"));
+    LogWriter->Serialize(const_cast<ANSICHAR*>(Header.Get()), Header.Length());
+    UE_LOG(LogTemp, Log, TEXT("[HapticLoopback] Logging delivered pulses to '%s'."), *Path);
+    return true;
+}
+
+void FHexademicLoopbackHapticDevice::Close()
+{
+    if (LogWriter.IsValid())
+    {
+        LogWriter->Close();
+        LogWriter.Reset();
+    }
+}
+
+void FHexademicLoopbackHapticDevice::SendPulses(TConstArrayView<FHexademicHapticPulse> Pulses)
+{
+    if (SimulatedLatencySeconds > 0.0)
+    {
+        FPlatformProcess::Sleep(static_cast<float>(SimulatedLatencySeconds)); // Stands in for device I/O
+    }
+    const double DeliveredSeconds = FPlatformTime::Seconds();
+
+    {
+        FScopeLock Lock(&RecentLock);
+        for (const FHexademicHapticPulse& Pulse : Pulses)
+        {
+            FDeliveredPulse Delivered{Pulse, DeliveredSeconds};
+            if (RecentDeliveries.Num() < MaxRecentDeliveries)
+            {
+                RecentDeliveries.Add(Delivered);
+            }
+            else
+            {
+                RecentDeliveries[NextRecentIndex] = Delivered;
+            }
+            NextRecentIndex = (NextRecentIndex + 1) % MaxRecentDeliveries;
+        }
+    }
+    NumDelivered.fetch_add(Pulses.Num(), std::memory_order_relaxed);
+
+    if (LogWriter.IsValid())
+    {
+        for (const FHexademicHapticPulse& Pulse : Pulses)
+        {
+            const FString Line = FString::Printf(TEXT("%.6f,%s,%.3f,%.3f,%.3f\n"), DeliveredSeconds,
+                *FHexademicBodyRegionRegistry::Get().GetTag(Pulse.Region), Pulse.Intensity, Pulse.Duration,
+                (DeliveredSeconds - Pulse.EnqueueSeconds) * 1000.0);
+            FTCHARToUTF8 Utf8(*Line);
+            LogWriter->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+        }
+    }
+}
+
+void FHexademicLoopbackHapticDevice::GetRecentDeliveries(TArray<FDeliveredPulse>& OutDeliveries) const
+{
+    FScopeLock Lock(&RecentLock);
+    OutDeliveries.Reset(RecentDeliveries.Num());
+    if (RecentDeliveries.Num() < MaxRecentDeliveries)
+    {
+        OutDeliveries.Append(RecentDeliveries);
+        return;
+    }
+    for (int32 Offset = 0; Offset < MaxRecentDeliveries; Offset++)
+    {
+        OutDeliveries.Add(RecentDeliveries[(NextRecentIndex + Offset) % MaxRecentDeliveries]);
+    }
+}
+
+// === DISPATCHER ===
+
+FHexademicHapticDispatcher::FHexademicHapticDispatcher(const TSharedRef<IHexademicHapticDevice, ESPMode::ThreadSafe>& InDevice, double InMaxPulseAgeSeconds)
+    : Device(InDevice)
+    , MaxPulseAgeSeconds(InMaxPulseAgeSeconds)
+    , ChannelReadyAtSeconds(0.0)
+{
+    WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+    Thread = FRunnableThread::Create(this, TEXT("HexademicHapticDispatcher"), 0, TPri_AboveNormal);
+}
+
+FHexademicHapticDispatcher::~FHexademicHapticDispatcher()
+{
+    if (Thread)
+    {
+        Thread->Kill(true); // Calls Stop, then waits for Run and Exit to finish
+        delete Thread;
+        Thread = nullptr;
+    }
+    FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+    WakeEvent = nullptr;
+}
+
+void FHexademicHapticDispatcher::Submit(const FHexademicHapticFrame& Frame)
+{
+    if (Frame.IsEmpty()) return;
+
+    {
+        FScopeLock Lock(&SubmitLock);
+        for (int32 Index = 0; Index < NumHexademicBodyRegions; Index++)
+        {
+            const EHexademicBodyRegion Region = static_cast<EHexademicBodyRegion>(Index);
+            if (Frame.Contains(Region))
+            {
+                Submitted.Add(Frame.Pulses[Region]);
+            }
+        }
+    }
+    WakeEvent->Trigger();
+}
+
+bool FHexademicHapticDispatcher::Init()
+{
+    if (!Device->Open())
+    {
+        UE_LOG(LogTemp, Error, TEXT("[HapticDispatcher] Device '%s' failed to open; haptic output is disabled."), Device->GetDeviceName());
+        return false;
+    }
+    UE_LOG(LogTemp, Log, TEXT("[HapticDispatcher] Dispatching to device '%s'."), Device->GetDeviceName());
+    return true;
+}
+
+uint32 FHexademicHapticDispatcher::Run()
+{
+    double WaitSeconds = IdleWaitSeconds;
+    while (!bStopping.load(std::memory_order_relaxed))
+    {
+        WakeEvent->Wait(FMath::Max(1, FMath::CeilToInt(WaitSeconds * 1000.0)));
+        if (bStopping.load(std::memory_order_relaxed)) break;
+
+        {
+            FScopeLock Lock(&SubmitLock);
+            for (int32 Index = 0; Index < NumHexademicBodyRegions; Index++)
+            {
+                const EHexademicBodyRegion Region = static_cast<EHexademicBodyRegion>(Index);
+                if (Submitted.Contains(Region))
+                {
+                    Held.Add(Submitted.Pulses[Region]);
+                }
+            }
+            Submitted.Reset();
+        }
+
+        WaitSeconds = SendReadyPulses(FPlatformTime::Seconds());
+    }
+    return 0;
+}
+
+void FHexademicHapticDispatcher::Stop()
+{
+    bStopping.store(true, std::memory_order_relaxed);
+    WakeEvent->Trigger();
+}
+
+void FHexademicHapticDispatcher::Exit()
+{
+    Device->Close();
+}
+
+double FHexademicHapticDispatcher::SendReadyPulses(double NowSeconds)
+{
+    static const FHexademicMetricHandle LatencyHandle = FHexademicMetricsRegistry::Get().RegisterHistogram(TEXT("Haptics.DispatchLatencyUs"));
+
+    Batch.Reset();
+    double SecondsUntilNextReady = IdleWaitSeconds;
+    int32 NumDropped = 0;
+    const double ChannelInterval = Device->GetMinChannelInterval();
+    const double MaxPulseAge = MaxPulseAgeSeconds.load(std::memory_order_relaxed);
+
+    for (int32 Index = 0; Index < NumHexademicBodyRegions; Index++)
+    {
+        const EHexademicBodyRegion Region = static_cast<EHexademicBodyRegion>(Index);
+        if (!Held.Contains(Region)) continue;
+
+        const FHexademicHapticPulse& Pulse = Held.Pulses[Region];
+        if (NowSeconds - Pulse.EnqueueSeconds > MaxPulseAge)
+        {
+            Held.Remove(Region); // Too late to feel right; playing it now would only add lag
+            NumDropped++;
+            continue;
+        }
+        if (ChannelReadyAtSeconds[Region] > NowSeconds)
+        {
+            SecondsUntilNextReady = FMath::Min(SecondsUntilNextReady, ChannelReadyAtSeconds[Region] - NowSeconds);
+            continue;
+        }
+
+        Batch.Add(Pulse);
+        Held.Remove(Region);
+        ChannelReadyAtSeconds[Region] = NowSeconds + ChannelInterval;
+    }
+
+    if (NumDropped > 0)
+    {
+        HEXADEMIC_COUNTER_ADD("Haptics.PulsesDropped", NumDropped);
+    }
+    if (Batch.Num() == 0) return SecondsUntilNextReady;
+
+    Device->SendPulses(Batch);
+
+    const double DeliveredSeconds = FPlatformTime::Seconds();
+    for (const FHexademicHapticPulse& Pulse : Batch)
+    {
+        FHexademicMetricsRegistry::Get().RecordSample(LatencyHandle, (DeliveredSeconds - Pulse.EnqueueSeconds) * 1000000.0);
+    }
+    HEXADEMIC_COUNTER_ADD("Haptics.PulsesSent", Batch.Num());
+    return SecondsUntilNextReady;
+}
@@ -0,0 +1,637 @@
+#include "Core/HexademicJsonWriter.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/Event.h"
+#include "Misc/Guid.h"
+#include "Misc/ScopeRWLock.h"
+#include "Misc/StringBuilder.h"
+#include "UObject/UnrealType.h"
+#include "UObject/EnumProperty.h"
+#include "Core/HexademicMetrics.h"
+
+// --- FHexademicJsonFileStream ---
+
+FHexademicJsonFileStream::FHexademicJsonFileStream(const FString& FilePath)
+    : State(MakeShared<FState, ESPMode::ThreadSafe>())
+{
+    State->FilePath = FilePath;
+    State->TempPath = FString::Printf(TEXT("%s.%s.tmp"), *FilePath, *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+    State->ChunkWritten = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FHexademicJsonFileStream::~FHexademicJsonFileStream()
+{
+    if (!bClosed)
+    {
+        TArray<uint8> NoBytes;
+        Close(NoBytes);
+    }
+}
+
+FHexademicJsonFileStream::FState::~FState()
+{
+    FPlatformProcess::ReturnSynchEventToPool(ChunkWritten);
+}
+
+void FHexademicJsonFileStream::Submit(TArray<uint8>& Buffer)
+{
+    if (bClosed || Buffer.Num() == 0) return;
+    Enqueue(Buffer, false);
+}
+
+void FHexademicJsonFileStream::Close(TArray<uint8>& Buffer)
+{
+    if (bClosed) return;
+    Enqueue(Buffer, true);
+    bClosed = true;
+}
+
+void FHexademicJsonFileStream::Flush()
+{
+    while (State->NumInFlight.load() > 0)
+    {
+        State->ChunkWritten->Wait();
+    }
+}
+
+void FHexademicJsonFileStream::Enqueue(TArray<uint8>& Buffer, bool bLast)
+{
+    // Memory stays bounded: past MaxChunksInFlight the producer waits for the disk to catch up
+    while (State->NumInFlight.load() >= MaxChunksInFlight)
+    {
+        HEXADEMIC_COUNTER_ADD("Json.StreamStalls", 1);
+        State->ChunkWritten->Wait();
+    }
+
+    FChunk Chunk;
+    Chunk.Bytes = MoveTemp(Buffer);
+    Chunk.bLast = bLast;
+    State->NumInFlight++;
+    State->Pending.Enqueue(MoveTemp(Chunk));
+
+    // Hand the caller a buffer the pool is done with, so steady-state streaming allocates nothing
+    State->Recycled.Dequeue(Buffer);
+
+    if (!State->bDraining.exchange(true))
+    {
+        Async(EAsyncExecution::ThreadPool, [StreamState = State]() { StreamState->Drain(); });
+    }
+}
+
+void FHexademicJsonFileStream::FState::Drain()
+{
+    for (;;)
+    {
+        FChunk Chunk;
+        while (Pending.Dequeue(Chunk))
+        {
+            if (!File.IsValid() && !bOpenFailed)
+            {
+                File.Reset(IFileManager::Get().CreateFileWriter(*TempPath));
+                bOpenFailed = !File.IsValid();
+                UE_CLOG(bOpenFailed, LogTemp, Warning, TEXT("[JsonWriter] Could not open %s for writing."), *TempPath);
+            }
+            if (File.IsValid() && Chunk.Bytes.Num() > 0)
+            {
+                File->Serialize(Chunk.Bytes.GetData(), Chunk.Bytes.Num());
+                HEXADEMIC_COUNTER_ADD("Json.BytesWritten", Chunk.Bytes.Num());
+            }
+            if (Chunk.bLast && File.IsValid())
+            {
+                const bool bWritten = File->Close();
+                File.Reset();
+                // The rename is the commit point: whichever stream on this path finishes last wins, whole
+                if (!bWritten || !IFileManager::Get().Move(*FilePath, *TempPath, true))
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("[JsonWriter] Could not move %s into place."), *FilePath);
+                    IFileManager::Get().Delete(*TempPath);
+                }
+            }
+
+            Chunk.Bytes.Reset();
+            Recycled.Enqueue(MoveTemp(Chunk.Bytes));
+            NumInFlight--;
+            ChunkWritten->Trigger();
+        }
+
+        bDraining = false;
+        // A chunk queued after the last Dequeue but before the flag cleared found a drain still running; take it now
+        if (Pending.IsEmpty() || bDraining.exchange(true)) return;
+    }
+}
+
+// --- FHexademicJsonSchema ---
+
+const FHexademicJsonSchema& FHexademicJsonSchema::ForStruct(const UScriptStruct* Struct)
+{
+    static FRWLock CacheLock;
+    static TMap<const UScriptStruct*, TUniquePtr<FHexademicJsonSchema>> Cache;
+
+    {
+        FReadScopeLock ReadLock(CacheLock);
+        if (const TUniquePtr<FHexademicJsonSchema>* Cached = Cache.Find(Struct))
+        {
+            return **Cached;
+        }
+    }
+
+    TUniquePtr<FHexademicJsonSchema> Schema = MakeUnique<FHexademicJsonSchema>();
+    for (TFieldIterator<FProperty> It(Struct); It; ++It)
+    {
+        const FProperty* Property = *It;
+        const FTCHARToUTF8 Key(*Struct->GetAuthoredNameForField(Property));
+        const FAnsiStringView KeyView(reinterpret_cast<const ANSICHAR*>(Key.Get()), Key.Length());
+
+        // Static arrays (size != element size) go through WriteProperty, which writes them as JSON arrays
+        EFieldKind Kind = EFieldKind::Reflected;
+        const UScriptStruct* NestedStruct = nullptr;
+        if (Property->GetSize() == Property->GetElementSize())
+        {
+            const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property);
+            const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+            if (BoolProperty && BoolProperty->IsNativeBool()) Kind = EFieldKind::Bool;
+            else if (Property->IsA<FIntProperty>()) Kind = EFieldKind::Int32;
+            else if (Property->IsA<FInt64Property>()) Kind = EFieldKind::Int64;
+            else if (Property->IsA<FFloatProperty>()) Kind = EFieldKind::Float;
+            else if (Property->IsA<FDoubleProperty>()) Kind = EFieldKind::Double;
+            else if (Property->IsA<FStrProperty>()) Kind = EFieldKind::String;
+            else if (StructProperty && StructProperty->Struct == TBaseStructure<FDateTime>::Get()) Kind = EFieldKind::DateTime;
+            else if (StructProperty)
+            {
+                Kind = EFieldKind::Struct;
+                NestedStruct = StructProperty->Struct;
+            }
+        }
+        Schema->AddField(KeyView, Property->GetOffset_ForInternal(), Kind, Property, NestedStruct);
+    }
+
+    FWriteScopeLock WriteLock(CacheLock);
+    if (const TUniquePtr<FHexademicJsonSchema>* Cached = Cache.Find(Struct)) // Built by another thread meanwhile
+    {
+        return **Cached;
+    }
+    return *Cache.Add(Struct, MoveTemp(Schema));
+}
+
+void FHexademicJsonSchema::AddField(FAnsiStringView Key, int32 Offset, EFieldKind Kind, const FProperty* Property, const UScriptStruct* Struct)
+{
+    FField& Field = Fields.AddDefaulted_GetRef();
+    Field.KeyStart = KeyText.Num();
+    Field.Offset = Offset;
+    Field.Kind = Kind;
+    Field.Property = Property;
+    Field.Struct = Struct;
+
+    // Stored quoted and escaped, ready to copy into the output
+    KeyText.Add('"');
+    for (const ANSICHAR Char : Key)
+    {
+        if (Char == '"' || Char == '\\') KeyText.Add('\\');
+        KeyText.Add(static_cast<uint8>(Char));
+    }
+    KeyText.Add('"');
+    KeyText.Add(':');
+    Field.KeyLen = KeyText.Num() - Field.KeyStart;
+}
+
+// --- FHexademicJsonWriter ---
+
+FHexademicJsonWriter::FHexademicJsonWriter(TArray<uint8>& InBuffer)
+    : Buffer(&InBuffer)
+{
+}
+
+FHexademicJsonWriter::FHexademicJsonWriter(TArray<uint8>& InBuffer, FHexademicJsonFileStream& InStream)
+    : Buffer(&InBuffer)
+    , Stream(&InStream)
+{
+}
+
+void FHexademicJsonWriter::MaybeSubmit()
+{
+    if (Stream && Buffer->Num() >= FHexademicJsonFileStream::ChunkBytes)
+    {
+        Stream->Submit(*Buffer);
+    }
+}
+
+void FHexademicJsonWriter::BeforeValue()
+{
+    MaybeSubmit();
+    if (bAfterKey)
+    {
+        bAfterKey = false;
+        return;
+    }
+    const uint64 DepthBit = 1ull << Depth;
+    if (HasElements & DepthBit) WriteChar(',');
+    HasElements |= DepthBit;
+}
+
+void FHexademicJsonWriter::BeginObject()
+{
+    BeforeValue();
+    WriteChar('{');
+    check(Depth < MaxDepth - 1);
+    Depth++;
+    HasElements &= ~(1ull << Depth);
+}
+
+void FHexademicJsonWriter::EndObject()
+{
+    Depth--;
+    WriteChar('}');
+}
+
+void FHexademicJsonWriter::BeginArray()
+{
+    BeforeValue();
+    WriteChar('[');
+    check(Depth < MaxDepth - 1);
+    Depth++;
+    HasElements &= ~(1ull << Depth);
+}
+
+void FHexademicJsonWriter::EndArray()
+{
+    Depth--;
+    WriteChar(']');
+}
+
+void FHexademicJsonWriter::WriteKey(FAnsiStringView Key)
+{
+    BeforeValue();
+    WriteChar('"');
+    WriteEscaped(Key);
+    WriteRaw("\":", 2);
+    bAfterKey = true;
+}
+
+void FHexademicJsonWriter::WriteKey(FStringView Key)
+{
+    BeforeValue();
+    WriteChar('"');
+    WriteEscaped(Key);
+    WriteRaw("\":", 2);
+    bAfterKey = true;
+}
+
+void FHexademicJsonWriter::WriteKeyBytes(const uint8* QuotedKey, int32 Num)
+{
+    BeforeValue();
+    WriteRaw(QuotedKey, Num);
+    bAfterKey = true;
+}
+
+void FHexademicJsonWriter::WriteNull()
+{
+    BeforeValue();
+    WriteRaw("null", 4);
+}
+
+void FHexademicJsonWriter::WriteValue(bool Value)
+{
+    BeforeValue();
+    if (Value) WriteRaw("true", 4);
+    else WriteRaw("false", 5);
+}
+
+void FHexademicJsonWriter::WriteValue(int64 Value)
+{
+    BeforeValue();
+    ANSICHAR Text[24];
+    WriteRaw(Text, FCStringAnsi::Snprintf(Text, UE_ARRAY_COUNT(Text), "%lld", static_cast<long long>(Value)));
+}
+
+void FHexademicJsonWriter::WriteValue(uint64 Value)
+{
+    BeforeValue();
+    ANSICHAR Text[24];
+    WriteRaw(Text, FCStringAnsi::Snprintf(Text, UE_ARRAY_COUNT(Text), "%llu", static_cast<unsigned long long>(Value)));
+}
+
+void FHexademicJsonWriter::WriteValue(float Value)
+{
+    if (!FMath::IsFinite(Value))
+    {
+        WriteNull();
+        return;
+    }
+    BeforeValue();
+    ANSICHAR Text[32];
+    WriteRaw(Text, FCStringAnsi::Snprintf(Text, UE_ARRAY_COUNT(Text), "%.9g", static_cast<double>(Value))); // Enough digits to read back the same float
+}
+
+void FHexademicJsonWriter::WriteValue(double Value)
+{
+    if (!FMath::IsFinite(Value))
+    {
+        WriteNull();
+        return;
+    }
+    BeforeValue();
+    ANSICHAR Text[32];
+    WriteRaw(Text, FCStringAnsi::Snprintf(Text, UE_ARRAY_COUNT(Text), "%.17g", Value));
+}
+
+void FHexademicJsonWriter::WriteValue(FStringView Value)
+{
+    BeforeValue();
+    WriteChar('"');
+    WriteEscaped(Value);
+    WriteChar('"');
+}
+
+void FHexademicJsonWriter::WriteValue(const FDateTime& Value)
+{
+    BeforeValue();
+    int32 Year, Month, Day;
+    Value.GetDate(Year, Month, Day);
+    ANSICHAR Text[40];
+    WriteRaw(Text, FCStringAnsi::Snprintf(Text, UE_ARRAY_COUNT(Text), "\"%04d-%02d-%02dT%02d:%02d:%02d.%03dZ\"",
+        Year, Month, Day, Value.GetHour(), Value.GetMinute(), Value.GetSecond(), Value.GetMillisecond()));
+}
+
+void FHexademicJsonWriter::WriteEscaped(FAnsiStringView Text)
+{
+    for (const ANSICHAR Char : Text)
+    {
+        if (Char == '"' || Char == '\\') WriteChar('\\');
+        WriteChar(Char);
+    }
+}
+
+void FHexademicJsonWriter::WriteEscaped(FStringView Text)
+{
+    const TCHAR* Chars = Text.GetData();
+    const int32 Num = Text.Len();
+    for (int32 i = 0; i < Num; i++)
+    {
+        uint32 CodePoint = static_cast<uint32>(Chars[i]);
+
+        // UTF-16 platforms: join surrogate pairs, replace unpaired halves
+        if (CodePoint >= 0xD800 && CodePoint <= 0xDFFF)
+        {
+            const uint32 Next = i + 1 < Num ? static_cast<uint32>(Chars[i + 1]) : 0;
+            if (CodePoint <= 0xDBFF && Next >= 0xDC00 && Next <= 0xDFFF)
+            {
+                CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Next - 0xDC00);
+                i++;
+            }
+            else
+            {
+                CodePoint = 0xFFFD;
+            }
+        }
+
+        if (CodePoint < 0x80)
+        {
+            switch (CodePoint)
+            {
+            case '"': WriteRaw("\\\"", 2); break;
+            case '\\': WriteRaw("\\\\", 2); break;
+            case '\n': WriteRaw("\\n", 2); break;
+            case '\r': WriteRaw("\\r", 2); break;
+            case '\t': WriteRaw("\\t", 2); break;
+            case '\b': WriteRaw("\\b", 2); break;
+            case '\f': WriteRaw("\\f", 2); break;
+            default:
+                if (CodePoint < 0x20)
+                {
+                    ANSICHAR Escape[8];
+                    WriteRaw(Escape, FCStringAnsi::Snprintf(Escape, UE_ARRAY_COUNT(Escape), "\\u%04x", CodePoint));
+                }
+                else
+                {
+                    WriteChar(static_cast<ANSICHAR>(CodePoint));
+                }
+            }
+        }
+        else if (CodePoint < 0x800)
+        {
+            const uint8 Bytes[2] = { uint8(0xC0 | (CodePoint >> 6)), uint8(0x80 | (CodePoint & 0x3F)) };
+            WriteRaw(Bytes, 2);
+        }
+        else if (CodePoint < 0x10000)
+        {
+            const uint8 Bytes[3] = { uint8(0xE0 | (CodePoint >> 12)), uint8(0x80 | ((CodePoint >> 6) & 0x3F)), uint8(0x80 | (CodePoint & 0x3F)) };
+            WriteRaw(Bytes, 3);
+        }
+        else
+        {
+            const uint8 Bytes[4] = { uint8(0xF0 | (CodePoint >> 18)), uint8(0x80 | ((CodePoint >> 12) & 0x3F)), uint8(0x80 | ((CodePoint >> 6) & 0x3F)), uint8(0x80 | (CodePoint & 0x3F)) };
+            WriteRaw(Bytes, 4);
+        }
+    }
+}
+
+void FHexademicJsonWriter::WriteObject(const FHexademicJsonSchema& Schema, const void* Data)
+{
+    BeginObject();
+    for (const FHexademicJsonSchema::FField& Field : Schema.GetFields())
+    {
+        WriteKeyBytes(Schema.GetKey(Field), Field.KeyLen);
+        const uint8* ValuePtr = static_cast<const uint8*>(Data) + Field.Offset;
+        switch (Field.Kind)
+        {
+        case FHexademicJsonSchema::EFieldKind::Bool: WriteValue(*reinterpret_cast<const bool*>(ValuePtr)); break;
+        case FHexademicJsonSchema::EFieldKind::Int32: WriteValue(*reinterpret_cast<const int32*>(ValuePtr)); break;
+        case FHexademicJsonSchema::EFieldKind::Int64: WriteValue(*reinterpret_cast<const int64*>(ValuePtr)); break;
+        case FHexademicJsonSchema::EFieldKind::Float: WriteValue(*reinterpret_cast<const float*>(ValuePtr)); break;
+        case FHexademicJsonSchema::EFieldKind::Double: WriteValue(*reinterpret_cast<const double*>(ValuePtr)); break;
+        case FHexademicJsonSchema::EFieldKind::String: WriteValue(*reinterpret_cast<const FString*>(ValuePtr)); break;
+        case FHexademicJsonSchema::EFieldKind::DateTime: WriteValue(*reinterpret_cast<const FDateTime*>(ValuePtr)); break;
+        case FHexademicJsonSchema::EFieldKind::Struct: WriteObject(FHexademicJsonSchema::ForStruct(Field.Struct), ValuePtr); break;
+        case FHexademicJsonSchema::EFieldKind::Reflected: WriteProperty(Field.Property, ValuePtr); break;
+        }
+    }
+    EndObject();
+}
+
+void FHexademicJsonWriter::WriteProperty(const FProperty* Property, const void* ValuePtr)
+{
+    const int32 ArrayDim = Property->GetSize() / Property->GetElementSize();
+    if (ArrayDim == 1)
+    {
+        WritePropertyValue(Property, ValuePtr);
+        return;
+    }
+
+    BeginArray();
+    for (int32 Index = 0; Index < ArrayDim; Index++)
+    {
+        WritePropertyValue(Property, static_cast<const uint8*>(ValuePtr) + Index * Property->GetElementSize());
+    }
+    EndArray();
+}
+
+void FHexademicJsonWriter::WriteNameValue(FName Name, bool bStripEnumPrefix)
+{
+    TStringBuilder<128> Text;
+    Name.AppendString(Text);
+    FStringView View = Text.ToView();
+    int32 ScopeIndex = INDEX_NONE;
+    if (bStripEnumPrefix && View.FindLastChar(TEXT(':'), ScopeIndex))
+    {
+        View.RightChopInline(ScopeIndex + 1); // "EEnum::Value" is written as "Value", like FJsonObjectConverter
+    }
+    WriteValue(View);
+}
+
+void FHexademicJsonWriter::WritePropertyValue(const FProperty* Property, const void* ValuePtr)
+{
+    if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+    {
+        WriteValue(BoolProperty->GetPropertyValue(ValuePtr));
+    }
+    else if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+    {
+        const int64 Value = EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr);
+        WriteNameValue(EnumProperty->GetEnum()->GetNameByValue(Value), true);
+    }
+    else if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+    {
+        if (const UEnum* Enum = NumericProperty->GetIntPropertyEnum())
+        {
+            WriteNameValue(Enum->GetNameByValue(NumericProperty->GetSignedIntPropertyValue(ValuePtr)), true);
+        }
+        else if (const FFloatProperty* FloatProperty = CastField<FFloatProperty>(Property))
+        {
+            WriteValue(FloatProperty->GetPropertyValue(ValuePtr));
+        }
+        else if (NumericProperty->IsFloatingPoint())
+        {
+            WriteValue(NumericProperty->GetFloatingPointPropertyValue(ValuePtr));
+        }
+        else if (Property->IsA<FUInt64Property>())
+        {
+            WriteValue(NumericProperty->GetUnsignedIntPropertyValue(ValuePtr));
+        }
+        else
+        {
+            WriteValue(NumericProperty->GetSignedIntPropertyValue(ValuePtr));
+        }
+    }
+    else if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+    {
+        WriteValue(StrProperty->GetPropertyValue(ValuePtr));
+    }
+    else if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+    {
+        WriteNameValue(NameProperty->GetPropertyValue(ValuePtr), false);
+    }
+    else if (const FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+    {
+        WriteValue(TextProperty->GetPropertyValue(ValuePtr).ToString());
+    }
+    else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+    {
+        if (StructProperty->Struct == TBaseStructure<FDateTime>::Get())
+        {
+            WriteValue(*static_cast<const FDateTime*>(ValuePtr));
+        }
+        else
+        {
+            WriteObject(FHexademicJsonSchema::ForStruct(StructProperty->Struct), ValuePtr);
+        }
+    }
+    else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+    {
+        FScriptArrayHelper Array(ArrayProperty, ValuePtr);
+        BeginArray();
+        for (int32 Index = 0; Index < Array.Num(); Index++)
+        {
+            WritePropertyValue(ArrayProperty->Inner, Array.GetRawPtr(Index));
+        }
+        EndArray();
+    }
+    else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+    {
+        FScriptSetHelper Set(SetProperty, ValuePtr);
+        BeginArray();
+        for (int32 Index = 0; Index < Set.GetMaxIndex(); Index++)
+        {
+            if (Set.IsValidIndex(Index))
+            {
+                WritePropertyValue(SetProperty->ElementProp, Set.GetElementPtr(Index));
+            }
+        }
+        EndArray();
+    }
+    else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+    {
+        FScriptMapHelper Map(MapProperty, ValuePtr);
+        BeginObject();
+        for (int32 Index = 0; Index < Map.GetMaxIndex(); Index++)
+        {
+            if (Map.IsValidIndex(Index))
+            {
+                WriteMapKey(MapProperty->KeyProp, Map.GetKeyPtr(Index), Index);
+                WritePropertyValue(MapProperty->ValueProp, Map.GetValuePtr(Index));
+            }
+        }
+        EndObject();
+    }
+    else if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+    {
+        const UObject* Object = ObjectProperty->GetObjectPropertyValue(ValuePtr);
+        if (!Object)
+        {
+            WriteNull();
+            return;
+        }
+        TStringBuilder<256> Path;
+        Object->GetPathName(nullptr, Path);
+        WriteValue(Path.ToView());
+    }
+    else
+    {
+        WriteNull(); // Delegates and other types with no JSON form
+    }
+}
+
+void FHexademicJsonWriter::WriteMapKey(const FProperty* KeyProperty, const void* KeyPtr, int32 Index)
+{
+    // JSON keys are strings: names, strings and enums are written as-is, integers in decimal
+    TStringBuilder<128> Key;
+    const UEnum* Enum = nullptr;
+    if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(KeyProperty))
+    {
+        Enum = EnumProperty->GetEnum();
+        Enum->GetNameByValue(EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(KeyPtr)).AppendString(Key);
+    }
+    else if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(KeyProperty); NumericProperty && NumericProperty->IsInteger())
+    {
+        Enum = NumericProperty->GetIntPropertyEnum();
+        if (Enum) Enum->GetNameByValue(NumericProperty->GetSignedIntPropertyValue(KeyPtr)).AppendString(Key);
+        else Key.Appendf(TEXT("%lld"), static_cast<long long>(NumericProperty->GetSignedIntPropertyValue(KeyPtr)));
+    }
+    else if (const FStrProperty* StrProperty = CastField<FStrProperty>(KeyProperty))
+    {
+        Key.Append(StrProperty->GetPropertyValue(KeyPtr));
+    }
+    else if (const FNameProperty* NameProperty = CastField<FNameProperty>(KeyProperty))
+    {
+        NameProperty->GetPropertyValue(KeyPtr).AppendString(Key);
+    }
+    else
+    {
+        Key.Appendf(TEXT("%d"), Index); // No string form; keep the entries distinct
+    }
+
+    FStringView View = Key.ToView();
+    int32 ScopeIndex = INDEX_NONE;
+    if (Enum && View.FindLastChar(TEXT(':'), ScopeIndex))
+    {
+        View.RightChopInline(ScopeIndex + 1);
+    }
+    WriteKey(View);
+}
+
+void FHexademicJsonWriter::Close()
+{
+    if (Stream)
+    {
+        Stream->Close(*Buffer);
+    }
+}
@@ -0,0 +1,252 @@
+#include "Core/HexademicMetrics.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    FORCEINLINE int32 HistogramBucketFor(double Value)
+    {
+        if (Value < 1.0)
+        {
+            return 0;
+        }
+        const int32 Bucket = int32(FMath::FloorLog2_64(uint64(Value))) + 1;
+        return FMath::Min(Bucket, FHexademicMetricsRegistry::NumHistogramBuckets - 1);
+    }
+
+    // Upper bound of a bucket, used as the percentile estimate
+    FORCEINLINE double HistogramBucketUpperBound(int32 Bucket)
+    {
+        return Bucket == 0 ? 1.0 : double(uint64(1) << Bucket);
+    }
+
+    FAutoConsoleCommand GHexademicMetricsDumpCommand(
+        TEXT("hexademic.Metrics.Dump"),
+        TEXT("Logs every Hexademic counter, gauge and stage timing histogram."),
+        FConsoleCommandDelegate::CreateLambda([]() { FHexademicMetricsRegistry::Get().DumpToLog(); }));
+
+    FAutoConsoleCommand GHexademicMetricsResetCommand(
+        TEXT("hexademic.Metrics.Reset"),
+        TEXT("Clears every Hexademic metric value."),
+        FConsoleCommandDelegate::CreateLambda([]() { FHexademicMetricsRegistry::Get().ResetValues(); }));
+}
+
+FHexademicMetricsRegistry& FHexademicMetricsRegistry::Get()
+{
+    static FHexademicMetricsRegistry Registry;
+    return Registry;
+}
+
+FHexademicMetricHandle FHexademicMetricsRegistry::Register(FName Name, EHexademicMetricKind Kind)
+{
+    FScopeLock Lock(&RegistrationLock);
+
+    FHexademicMetricHandle Handle;
+    if (const int32* ExistingIndex = NameToIndex.Find(Name))
+    {
+        if (Slots[*ExistingIndex].Kind != Kind)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[HexademicMetrics] Metric '%s' already registered with a different kind."), *Name.ToString());
+            return Handle;
+        }
+        Handle.Index = *ExistingIndex;
+        return Handle;
+    }
+
+    const int32 NewIndex = NumSlots.load(std::memory_order_relaxed);
+    if (NewIndex >= MaxMetrics)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[HexademicMetrics] Metric capacity (%d) exhausted, '%s' not registered."), MaxMetrics, *Name.ToString());
+        return Handle;
+    }
+
+    FMetricSlot& Slot = Slots[NewIndex];
+    Slot.Name = Name;
+    Slot.Kind = Kind;
+    ResetSlot(Slot);
+    NameToIndex.Add(Name, NewIndex);
+    NumSlots.store(NewIndex + 1, std::memory_order_release);
+
+    Handle.Index = NewIndex;
+    return Handle;
+}
+
+FHexademicMetricHandle FHexademicMetricsRegistry::FindMetric(FName Name) const
+{
+    FScopeLock Lock(&RegistrationLock);
+    FHexademicMetricHandle Handle;
+    if (const int32* ExistingIndex = NameToIndex.Find(Name))
+    {
+        Handle.Index = *ExistingIndex;
+    }
+    return Handle;
+}
+
+void FHexademicMetricsRegistry::AddCounter(FHexademicMetricHandle Handle, int64 Delta)
+{
+    if (!Handle.IsValid()) return;
+    Slots[Handle.Index].Count.fetch_add(Delta, std::memory_order_relaxed);
+}
+
+void FHexademicMetricsRegistry::SetGauge(FHexademicMetricHandle Handle, double Value)
+{
+    if (!Handle.IsValid()) return;
+    Slots[Handle.Index].Gauge.store(Value, std::memory_order_relaxed);
+}
+
+void FHexademicMetricsRegistry::RecordSample(FHexademicMetricHandle Handle, double Value)
+{
+    if (!Handle.IsValid()) return;
+
+    FMetricSlot& Slot = Slots[Handle.Index];
+    const int64 Fixed = int64(Value * FixedPointScale);
+
+    Slot.Count.fetch_add(1, std::memory_order_relaxed);
+    Slot.FixedSum.fetch_add(Fixed, std::memory_order_relaxed);
+    Slot.Buckets[HistogramBucketFor(Value)].fetch_add(1, std::memory_order_relaxed);
+
+    int64 CurrentMin = Slot.FixedMin.load(std::memory_order_relaxed);
+    while (Fixed < CurrentMin && !Slot.FixedMin.compare_exchange_weak(CurrentMin, Fixed, std::memory_order_relaxed)) {}
+
+    int64 CurrentMax = Slot.FixedMax.load(std::memory_order_relaxed);
+    while (Fixed > CurrentMax && !Slot.FixedMax.compare_exchange_weak(CurrentMax, Fixed, std::memory_order_relaxed)) {}
+}
+
+bool FHexademicMetricsRegistry::GetSnapshot(FName Name, FHexademicMetricSnapshot& OutSnapshot) const
+{
+    return GetSnapshot(FindMetric(Name), OutSnapshot);
+}
+
+bool FHexademicMetricsRegistry::GetSnapshot(FHexademicMetricHandle Handle, FHexademicMetricSnapshot& OutSnapshot) const
+{
+    if (!Handle.IsValid() || Handle.Index >= NumSlots.load(std::memory_order_acquire)) return false;
+    FillSnapshot(Slots[Handle.Index], OutSnapshot);
+    return true;
+}
+
+void FHexademicMetricsRegistry::GetAllSnapshots(TArray<FHexademicMetricSnapshot>& OutSnapshots) const
+{
+    const int32 Count = NumSlots.load(std::memory_order_acquire);
+    OutSnapshots.Reset(Count);
+    for (int32 i = 0; i < Count; i++)
+    {
+        FillSnapshot(Slots[i], OutSnapshots.AddDefaulted_GetRef());
+    }
+}
+
+void FHexademicMetricsRegistry::ResetValues()
+{
+    const int32 Count = NumSlots.load(std::memory_order_acquire);
+    for (int32 i = 0; i < Count; i++)
+    {
+        ResetSlot(Slots[i]);
+    }
+    UE_LOG(LogTemp, Log, TEXT("[HexademicMetrics] Reset %d metrics."), Count);
+}
+
+void FHexademicMetricsRegistry::DumpToLog() const
+{
+    TArray<FHexademicMetricSnapshot> Snapshots;
+    GetAllSnapshots(Snapshots);
+
+    UE_LOG(LogTemp, Log, TEXT("--- Hexademic Metrics (%d) ---"), Snapshots.Num());
+    for (const FHexademicMetricSnapshot& Snapshot : Snapshots)
+    {
+        switch (Snapshot.Kind)
+        {
+        case EHexademicMetricKind::Counter:
+            UE_LOG(LogTemp, Log, TEXT("[Counter]   %-40s %lld"), *Snapshot.Name.ToString(), Snapshot.Count);
+            break;
+        case EHexademicMetricKind::Gauge:
+            UE_LOG(LogTemp, Log, TEXT("[Gauge]     %-40s %.3f"), *Snapshot.Name.ToString(), Snapshot.Value);
+            break;
+        case EHexademicMetricKind::Histogram:
+            UE_LOG(LogTemp, Log, TEXT("[Histogram] %-40s n=%lld mean=%.2f min=%.2f max=%.2f p50<=%.0f p95<=%.0f p99<=%.0f"),
+                *Snapshot.Name.ToString(), Snapshot.Count, Snapshot.Value, Snapshot.Min, Snapshot.Max, Snapshot.P50, Snapshot.P95, Snapshot.P99);
+            break;
+        }
+    }
+}
+
+void FHexademicMetricsRegistry::ResetSlot(FMetricSlot& Slot)
+{
+    Slot.Count.store(0, std::memory_order_relaxed);
+    Slot.Gauge.store(0.0, std::memory_order_relaxed);
+    Slot.FixedSum.store(0, std::memory_order_relaxed);
+    Slot.FixedMin.store(MAX_int64, std::memory_order_relaxed);
+    Slot.FixedMax.store(MIN_int64, std::memory_order_relaxed);
+    for (std::atomic<int64>& Bucket : Slot.Buckets)
+    {
+        Bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void FHexademicMetricsRegistry::FillSnapshot(const FMetricSlot& Slot, FHexademicMetricSnapshot& OutSnapshot) const
+{
+    OutSnapshot = FHexademicMetricSnapshot();
+    OutSnapshot.Name = Slot.Name;
+    OutSnapshot.Kind = Slot.Kind;
+    OutSnapshot.Count = Slot.Count.load(std::memory_order_relaxed);
+
+    if (Slot.Kind == EHexademicMetricKind::Gauge)
+    {
+        OutSnapshot.Value = Slot.Gauge.load(std::memory_order_relaxed);
+        OutSnapshot.Min = OutSnapshot.Max = OutSnapshot.Value;
+        return;
+    }
+    if (Slot.Kind != EHexademicMetricKind::Histogram || OutSnapshot.Count == 0)
+    {
+        return;
+    }
+
+    OutSnapshot.Value = double(Slot.FixedSum.load(std::memory_order_relaxed)) / FixedPointScale / double(OutSnapshot.Count);
+    OutSnapshot.Min = double(Slot.FixedMin.load(std::memory_order_relaxed)) / FixedPointScale;
+    OutSnapshot.Max = double(Slot.FixedMax.load(std::memory_order_relaxed)) / FixedPointScale;
+
+    int64 BucketCounts[NumHistogramBuckets];
+    int64 Total = 0;
+    for (int32 b = 0; b < NumHistogramBuckets; b++)
+    {
+        BucketCounts[b] = Slot.Buckets[b].load(std::memory_order_relaxed);
+        Total += BucketCounts[b];
+    }
+
+    auto Percentile = [&](double Fraction)
+    {
+        const int64 Target = FMath::Max<int64>(1, int64(FMath::CeilToDouble(double(Total) * Fraction)));
+        int64 Running = 0;
+        for (int32 b = 0; b < NumHistogramBuckets; b++)
+        {
+            Running += BucketCounts[b];
+            if (Running >= Target)
+            {
+                return FMath::Min(HistogramBucketUpperBound(b), OutSnapshot.Max);
+            }
+        }
+        return OutSnapshot.Max;
+    };
+    OutSnapshot.P50 = Percentile(0.50);
+    OutSnapshot.P95 = Percentile(0.95);
+    OutSnapshot.P99 = Percentile(0.99);
+}
+
+//=============================================================================
+// UHexademicMetricsLibrary
+//=============================================================================
+
+bool UHexademicMetricsLibrary::GetMetricSnapshot(FName MetricName, FHexademicMetricSnapshot& OutSnapshot)
+{
+    return FHexademicMetricsRegistry::Get().GetSnapshot(MetricName, OutSnapshot);
+}
+
+TArray<FHexademicMetricSnapshot> UHexademicMetricsLibrary::GetAllMetricSnapshots()
+{
+    TArray<FHexademicMetricSnapshot> Snapshots;
+    FHexademicMetricsRegistry::Get().GetAllSnapshots(Snapshots);
+    return Snapshots;
+}
+
+void UHexademicMetricsLibrary::ResetMetrics()
+{
+    FHexademicMetricsRegistry::Get().ResetValues();
+}
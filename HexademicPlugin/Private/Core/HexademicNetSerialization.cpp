@@ -0,0 +1,457 @@
+#include "Core/HexademicNetSerialization.h"
+#include "Engine/NetSerialization.h"
+#include "Algo/StableSort.h"
+#include "Serialization/BitWriter.h"
+#include "Serialization/BitReader.h"
+#include "HAL/IConsoleManager.h"
+#include "HexademicCore.h"
+#include "Core/ConsciousnessState.h"
+
+using HexademicNet::SerializeQuantized;
+
+namespace
+{
+    constexpr int32 VAIBits = 10; // Matches the VAI lanes of FPackedHexaSigilNode::EmotionalPack
+    constexpr int32 MaxReplicatedCognitiveThreads = 8;
+    constexpr int32 MaxReplicatedLatticeValues = 64;
+
+    /** Field groups of FUnifiedConsciousnessState; one dirty bit each in a delta. */
+    enum class EStateGroup : uint8
+    {
+        Autonomic,
+        Hormonal,
+        Emotion,
+        Cognition,
+        Needs,
+        Embodiment,
+        Awareness,
+        Text,
+        Count
+    };
+    constexpr int32 NumStateGroups = static_cast<int32>(EStateGroup::Count);
+    constexpr uint32 AllStateGroups = (1u << NumStateGroups) - 1;
+
+    /** One scalar of the unified state and its wire budget. */
+    struct FQuantizedField
+    {
+        int32 Offset = 0;
+        float Min = 0.0f;
+        float Max = 1.0f;
+        uint8 NumBits = 8;
+        EStateGroup Group = EStateGroup::Cognition;
+        bool bDouble = false; // FVector components
+    };
+
+    /** The replicated scalars in wire order, grouped. Text is handled apart. */
+    const TArray<FQuantizedField>& GetStateFields()
+    {
+        static const TArray<FQuantizedField> Fields = []()
+        {
+            TArray<FQuantizedField> Table;
+            auto Add = [&Table](int32 Offset, float Min, float Max, uint8 NumBits, EStateGroup Group, bool bDouble = false)
+            {
+                Table.Add({ Offset, Min, Max, NumBits, Group, bDouble });
+            };
+            using S = FUnifiedConsciousnessState;
+
+            Add(STRUCT_OFFSET(S, HeartRateBPM), 0.0f, 250.0f, 10, EStateGroup::Autonomic);
+            Add(STRUCT_OFFSET(S, RespirationRateBPM), 0.0f, 80.0f, 8, EStateGroup::Autonomic);
+            Add(STRUCT_OFFSET(S, SkinConductanceResponse), 0.0f, 1.0f, 8, EStateGroup::Autonomic);
+            Add(STRUCT_OFFSET(S, InternalTemperature), 30.0f, 45.0f, 10, EStateGroup::Autonomic);
+            Add(STRUCT_OFFSET(S, HeartRate), 0.0f, 250.0f, 10, EStateGroup::Autonomic);
+            Add(STRUCT_OFFSET(S, BreathingRate), 0.0f, 80.0f, 8, EStateGroup::Autonomic);
+            Add(STRUCT_OFFSET(S, CoreBodyTemperature), 30.0f, 45.0f, 10, EStateGroup::Autonomic);
+            Add(STRUCT_OFFSET(S, SkinTemperature), 20.0f, 45.0f, 10, EStateGroup::Autonomic);
+
+            for (const int32 Offset : { STRUCT_OFFSET(S, CortisolLevel), STRUCT_OFFSET(S, DopamineLevel), STRUCT_OFFSET(S, SerotoninLevel),
+                                        STRUCT_OFFSET(S, AdrenalineLevel), STRUCT_OFFSET(S, OxytocinLevel), STRUCT_OFFSET(S, MelatoninLevel) })
+            {
+                Add(Offset, 0.0f, 1.0f, 8, EStateGroup::Hormonal);
+            }
+
+            for (const int32 Emotion : { STRUCT_OFFSET(S, CurrentEmotionalState), STRUCT_OFFSET(S, CurrentResonance) })
+            {
+                Add(Emotion + STRUCT_OFFSET(FEmotionalState, Valence), -1.0f, 1.0f, VAIBits, EStateGroup::Emotion);
+                Add(Emotion + STRUCT_OFFSET(FEmotionalState, Arousal), 0.0f, 1.0f, VAIBits, EStateGroup::Emotion);
+                Add(Emotion + STRUCT_OFFSET(FEmotionalState, Intensity), 0.0f, 1.0f, VAIBits, EStateGroup::Emotion);
+                Add(Emotion + STRUCT_OFFSET(FEmotionalState, Dominance), -1.0f, 1.0f, VAIBits, EStateGroup::Emotion);
+            }
+
+            for (const int32 Offset : { STRUCT_OFFSET(S, CoherenceMetric), STRUCT_OFFSET(S, CognitiveLoad), STRUCT_OFFSET(S, AttentionFocus), STRUCT_OFFSET(S, CreativeState) })
+            {
+                Add(Offset, 0.0f, 1.0f, 8, EStateGroup::Cognition);
+            }
+
+            // Same 10 bits FPackedBiologicalNeedsState packs needs at
+            for (const int32 Offset : { STRUCT_OFFSET(S, HungerLevel), STRUCT_OFFSET(S, ThirstLevel), STRUCT_OFFSET(S, FatigueLevel) })
+            {
+                Add(Offset, 0.0f, 1.0f, 10, EStateGroup::Needs);
+            }
+
+            const int32 Posture = STRUCT_OFFSET(S, BodyPostureSignature);
+            Add(Posture + STRUCT_OFFSET(FVector, X), -180.0f, 180.0f, 10, EStateGroup::Embodiment, true);
+            Add(Posture + STRUCT_OFFSET(FVector, Y), -180.0f, 180.0f, 10, EStateGroup::Embodiment, true);
+            Add(Posture + STRUCT_OFFSET(FVector, Z), -180.0f, 180.0f, 10, EStateGroup::Embodiment, true);
+            for (int32 Region = 0; Region < NumHexademicBodyRegions; Region++)
+            {
+                Add(STRUCT_OFFSET(S, RegionSkinTones) + Region * sizeof(float), 0.0f, 1.0f, 8, EStateGroup::Embodiment);
+            }
+            Add(STRUCT_OFFSET(S, OverallEmbodimentCoherence), 0.0f, 1.0f, 8, EStateGroup::Embodiment);
+
+            for (const int32 Offset : { STRUCT_OFFSET(S, AwarenessLevel), STRUCT_OFFSET(S, VolitionCapacity), STRUCT_OFFSET(S, SelfAwareness),
+                                        STRUCT_OFFSET(S, EnvironmentalAwareness), STRUCT_OFFSET(S, TemporalAwareness) })
+            {
+                Add(Offset, 0.0f, 1.0f, 8, EStateGroup::Awareness);
+            }
+
+            // Wire order is group order, so a delta reads its groups front to back
+            Algo::StableSortBy(Table, &FQuantizedField::Group);
+            return Table;
+        }();
+        return Fields;
+    }
+
+    using FQuantizedState = TArray<uint16, TInlineAllocator<64>>;
+
+    void QuantizeState(const FUnifiedConsciousnessState& State, FQuantizedState& OutValues)
+    {
+        const uint8* Base = reinterpret_cast<const uint8*>(&State);
+        for (const FQuantizedField& Field : GetStateFields())
+        {
+            const float Value = Field.bDouble ? static_cast<float>(*reinterpret_cast<const double*>(Base + Field.Offset)) : *reinterpret_cast<const float*>(Base + Field.Offset);
+            OutValues.Add(static_cast<uint16>(HexademicNet::Quantize(Value, Field.Min, Field.Max, Field.NumBits)));
+        }
+    }
+
+    uint32 HashStateText(const FUnifiedConsciousnessState& State)
+    {
+        uint32 Hash = HashCombine(GetTypeHash(State.CurrentThought), GetTypeHash(State.CurrentFacialExpression));
+        const int32 NumThreads = FMath::Min(State.ActiveCognitiveThreads.Num(), MaxReplicatedCognitiveThreads);
+        for (int32 Index = 0; Index < NumThreads; Index++)
+        {
+            Hash = HashCombine(Hash, GetTypeHash(State.ActiveCognitiveThreads[Index]));
+        }
+        return HashCombine(Hash, NumThreads);
+    }
+
+    /** Writes the groups in GroupMask from Values, which must come from QuantizeState. */
+    void WriteGroups(FArchive& Ar, FUnifiedConsciousnessState& State, uint32 GroupMask, const FQuantizedState& Values)
+    {
+        Ar.SerializeBits(&GroupMask, NumStateGroups);
+
+        const TArray<FQuantizedField>& Fields = GetStateFields();
+        for (int32 Index = 0; Index < Fields.Num(); Index++)
+        {
+            if (GroupMask & (1u << static_cast<int32>(Fields[Index].Group)))
+            {
+                uint32 Quantized = Values[Index];
+                Ar.SerializeBits(&Quantized, Fields[Index].NumBits);
+            }
+        }
+
+        if (GroupMask & (1u << static_cast<int32>(EStateGroup::Text)))
+        {
+            Ar << State.CurrentThought;
+            Ar << State.CurrentFacialExpression;
+            uint32 NumThreads = FMath::Min(State.ActiveCognitiveThreads.Num(), MaxReplicatedCognitiveThreads);
+            Ar.SerializeInt(NumThreads, MaxReplicatedCognitiveThreads + 1);
+            for (uint32 Index = 0; Index < NumThreads; Index++)
+            {
+                Ar << State.ActiveCognitiveThreads[Index];
+            }
+        }
+    }
+
+    /** Reads a group mask and the groups it names into State; groups not sent keep their values. */
+    bool ReadGroups(FArchive& Ar, FUnifiedConsciousnessState& State)
+    {
+        uint32 GroupMask = 0;
+        Ar.SerializeBits(&GroupMask, NumStateGroups);
+
+        uint8* Base = reinterpret_cast<uint8*>(&State);
+        for (const FQuantizedField& Field : GetStateFields())
+        {
+            if (!(GroupMask & (1u << static_cast<int32>(Field.Group)))) continue;
+
+            uint32 Quantized = 0;
+            Ar.SerializeBits(&Quantized, Field.NumBits);
+            const float Value = HexademicNet::Dequantize(Quantized, Field.Min, Field.Max, Field.NumBits);
+            if (Field.bDouble) *reinterpret_cast<double*>(Base + Field.Offset) = Value;
+            else *reinterpret_cast<float*>(Base + Field.Offset) = Value;
+        }
+
+        if (GroupMask & (1u << static_cast<int32>(EStateGroup::Text)))
+        {
+            Ar << State.CurrentThought;
+            Ar << State.CurrentFacialExpression;
+            uint32 NumThreads = 0;
+            Ar.SerializeInt(NumThreads, MaxReplicatedCognitiveThreads + 1);
+            State.ActiveCognitiveThreads.SetNum(NumThreads);
+            for (FString& Thread : State.ActiveCognitiveThreads)
+            {
+                Ar << Thread;
+            }
+        }
+
+        State.LastUpdateTimestamp = FDateTime::UtcNow();
+        return !Ar.IsError();
+    }
+
+    /** What a connection last received: the quantized fields and a hash of the text group. */
+    class FConsciousnessDeltaState : public INetDeltaBaseState
+    {
+    public:
+        FQuantizedState Values;
+        uint32 TextHash = 0;
+
+        virtual bool IsStateEqual(INetDeltaBaseState* OtherState) override
+        {
+            const FConsciousnessDeltaState* Other = static_cast<const FConsciousnessDeltaState*>(OtherState);
+            return TextHash == Other->TextHash && Values == Other->Values;
+        }
+    };
+
+    uint32 GetDirtyGroups(const FQuantizedState& Values, uint32 TextHash, const FConsciousnessDeltaState* Old)
+    {
+        if (!Old || Old->Values.Num() != Values.Num())
+        {
+            return AllStateGroups;
+        }
+
+        uint32 GroupMask = 0;
+        const TArray<FQuantizedField>& Fields = GetStateFields();
+        for (int32 Index = 0; Index < Fields.Num(); Index++)
+        {
+            if (Values[Index] != Old->Values[Index]) GroupMask |= 1u << static_cast<int32>(Fields[Index].Group);
+        }
+        if (TextHash != Old->TextHash) GroupMask |= 1u << static_cast<int32>(EStateGroup::Text);
+        return GroupMask;
+    }
+}
+
+bool FEmotionalState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    SerializeQuantized(Ar, Valence, -1.0f, 1.0f, VAIBits);
+    SerializeQuantized(Ar, Arousal, 0.0f, 1.0f, VAIBits);
+    SerializeQuantized(Ar, Intensity, 0.0f, 1.0f, VAIBits);
+    SerializeQuantized(Ar, Dominance, -1.0f, 1.0f, VAIBits);
+    bOutSuccess = !Ar.IsError();
+    return true;
+}
+
+bool FConsciousnessState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    SerializeQuantized(Ar, Vitality, 0.0f, 1.0f, 8);
+    SerializeQuantized(Ar, CognitiveLoad, 0.0f, 1.0f, 8);
+    SerializeQuantized(Ar, FocusLevel, 0.0f, 1.0f, 8);
+    SerializeQuantized(Ar, AwarenessLevel, 0.0f, 1.0f, 8);
+
+    uint32 Archetype = static_cast<uint32>(DominantEmotionalArchetype);
+    Ar.SerializeInt(Archetype, 16);
+    DominantEmotionalArchetype = static_cast<EEmotionalArchetype>(Archetype);
+
+    uint8 bActive = bIsActive ? 1 : 0;
+    Ar.SerializeBits(&bActive, 1);
+    bIsActive = bActive != 0;
+
+    FHexadecimalStateLattice& Lattice = LatticeSnapshot;
+    SerializeQuantized(Ar, Lattice.Amplitude, 0.0f, 1.0f, 8);
+    SerializeQuantized(Ar, Lattice.Phase, -2.0f * PI, 2.0f * PI, 10);
+    SerializeQuantized(Ar, Lattice.EntanglementStrength, 0.0f, 1.0f, 8);
+
+    // Lattice values are nibbles (0x0 - 0xF)
+    uint32 NumValues = FMath::Min(Lattice.StateVector.Num(), MaxReplicatedLatticeValues);
+    Ar.SerializeInt(NumValues, MaxReplicatedLatticeValues + 1);
+    if (Ar.IsLoading())
+    {
+        Lattice.StateVector.SetNumZeroed(NumValues);
+        Lattice.LastEvolution = FDateTime::UtcNow();
+        LastUpdateTime = FDateTime::UtcNow();
+    }
+    for (uint32 Index = 0; Index < NumValues; Index++)
+    {
+        uint8 Nibble = Lattice.StateVector[Index] & 0xF;
+        Ar.SerializeBits(&Nibble, 4);
+        Lattice.StateVector[Index] = Nibble;
+    }
+
+    bOutSuccess = !Ar.IsError();
+    return true;
+}
+
+bool FUnifiedConsciousnessState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    if (Ar.IsSaving())
+    {
+        FQuantizedState Values;
+        QuantizeState(*this, Values);
+        WriteGroups(Ar, *this, AllStateGroups, Values);
+        bOutSuccess = !Ar.IsError();
+    }
+    else
+    {
+        bOutSuccess = ReadGroups(Ar, *this);
+    }
+    return true;
+}
+
+bool FUnifiedConsciousnessState::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+{
+    if (DeltaParms.Writer)
+    {
+        TSharedPtr<FConsciousnessDeltaState> NewState = MakeShared<FConsciousnessDeltaState>();
+        QuantizeState(*this, NewState->Values);
+        NewState->TextHash = HashStateText(*this);
+
+        const uint32 GroupMask = GetDirtyGroups(NewState->Values, NewState->TextHash, static_cast<const FConsciousnessDeltaState*>(DeltaParms.OldState));
+        if (GroupMask == 0)
+        {
+            return false; // Nothing moved by a whole quantization step: the connection keeps its old state
+        }
+
+        *DeltaParms.NewState = NewState;
+        WriteGroups(*DeltaParms.Writer, *this, GroupMask, NewState->Values);
+        return true;
+    }
+
+    if (DeltaParms.Reader)
+    {
+        return ReadGroups(*DeltaParms.Reader, *this);
+    }
+    return true;
+}
+
+namespace HexademicNet
+{
+    void CopyReplicatedState(const FUnifiedConsciousnessState& Source, FUnifiedConsciousnessState& Target)
+    {
+        const uint8* SourceBase = reinterpret_cast<const uint8*>(&Source);
+        uint8* TargetBase = reinterpret_cast<uint8*>(&Target);
+        for (const FQuantizedField& Field : GetStateFields())
+        {
+            FMemory::Memcpy(TargetBase + Field.Offset, SourceBase + Field.Offset, Field.bDouble ? sizeof(double) : sizeof(float));
+        }
+
+        // Strings rarely change between updates; compare before copying so an unchanged one is not reallocated
+        auto CopyText = [](const FString& From, FString& To)
+        {
+            if (!To.Equals(From, ESearchCase::CaseSensitive)) To = From;
+        };
+        CopyText(Source.CurrentThought, Target.CurrentThought);
+        CopyText(Source.CurrentFacialExpression, Target.CurrentFacialExpression);
+        const int32 NumThreads = FMath::Min(Source.ActiveCognitiveThreads.Num(), MaxReplicatedCognitiveThreads);
+        Target.ActiveCognitiveThreads.SetNum(NumThreads);
+        for (int32 Index = 0; Index < NumThreads; Index++)
+        {
+            CopyText(Source.ActiveCognitiveThreads[Index], Target.ActiveCognitiveThreads[Index]);
+        }
+        Target.LastUpdateTimestamp = Source.LastUpdateTimestamp;
+    }
+
+    FBandwidthReport MeasureConsciousnessBandwidth(int32 NumAgents, float Seconds, float UpdateHz)
+    {
+        FBandwidthReport Report;
+        NumAgents = FMath::Max(NumAgents, 1);
+        const int32 NumUpdates = FMath::Max(FMath::RoundToInt(Seconds * UpdateHz), 1);
+        const float DeltaTime = 1.0f / FMath::Max(UpdateHz, 1.0f);
+
+        int64 ReflectedBits = 0;
+        int64 SnapshotBits = 0;
+        int64 DeltaBits = 0;
+        FRandomStream Random(0x4E455457);
+
+        for (int32 Agent = 0; Agent < NumAgents; Agent++)
+        {
+            FUnifiedConsciousnessState Server;
+            FUnifiedConsciousnessState Client;
+            TSharedPtr<INetDeltaBaseState> Acked;
+            Server.CurrentThought = TEXT("Observing the room");
+            Server.ActiveCognitiveThreads = { TEXT("Memory_Recall"), TEXT("Scene_Appraisal") };
+            Server.InternalTemperature = 37.0f;
+            Server.HeartRateBPM = 70.0f;
+
+            const float Phase = Random.FRand() * 2.0f * PI;
+            for (int32 Update = 0; Update < NumUpdates; Update++)
+            {
+                // Emotion drifts every update, physiology slowly, needs and text rarely: what a live agent looks like
+                const float Time = Update * DeltaTime;
+                Server.CurrentEmotionalState.Valence = FMath::Sin(Time * 0.7f + Phase) * 0.8f;
+                Server.CurrentEmotionalState.Arousal = 0.5f + 0.4f * FMath::Sin(Time * 1.3f + Phase);
+                Server.CurrentEmotionalState.Intensity = 0.5f + 0.3f * FMath::Cos(Time * 0.9f + Phase);
+                Server.CurrentResonance = Server.CurrentEmotionalState;
+                Server.HeartRateBPM = 70.0f + 10.0f * FMath::Sin(Time * 0.1f + Phase);
+                Server.CortisolLevel = 0.3f + 0.1f * FMath::Sin(Time * 0.05f);
+                Server.HungerLevel = FMath::Fmod(Time * 0.001f, 1.0f);
+                if (Update % FMath::Max(FMath::RoundToInt(UpdateHz * 5.0f), 1) == 0)
+                {
+                    Server.CurrentThought = FString::Printf(TEXT("Thought %d"), Update);
+                }
+
+                {
+                    FBitWriter Writer(0, true);
+                    Server.StaticStruct()->SerializeBin(Writer, &Server);
+                    ReflectedBits += Writer.GetNumBits();
+                }
+                {
+                    FBitWriter Writer(0, true);
+                    bool bSuccess = false;
+                    Server.NetSerialize(Writer, nullptr, bSuccess);
+                    SnapshotBits += Writer.GetNumBits();
+                }
+
+                // Delta against what this client acknowledged, then read back on the client copy
+                FNetBitWriter Writer(0);
+                TSharedPtr<INetDeltaBaseState> NewState;
+                FNetDeltaSerializeInfo WriteParms;
+                WriteParms.Writer = &Writer;
+                WriteParms.OldState = Acked.Get();
+                WriteParms.NewState = &NewState;
+                if (!Server.NetDeltaSerialize(WriteParms))
+                {
+                    continue;
+                }
+                DeltaBits += Writer.GetNumBits();
+                Acked = NewState;
+
+                FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+                FNetDeltaSerializeInfo ReadParms;
+                ReadParms.Reader = &Reader;
+                Client.NetDeltaSerialize(ReadParms);
+
+                FQuantizedState ServerValues;
+                FQuantizedState ClientValues;
+                QuantizeState(Server, ServerValues);
+                QuantizeState(Client, ClientValues);
+                if (ServerValues != ClientValues || Client.CurrentThought != Server.CurrentThought)
+                {
+                    Report.NumMismatches++;
+                }
+            }
+        }
+
+        const double AgentSeconds = static_cast<double>(NumAgents) * NumUpdates * DeltaTime;
+        Report.ReflectedBytesPerAgentSecond = ReflectedBits / 8.0 / AgentSeconds;
+        Report.SnapshotBytesPerAgentSecond = SnapshotBits / 8.0 / AgentSeconds;
+        Report.DeltaBytesPerAgentSecond = DeltaBits / 8.0 / AgentSeconds;
+        return Report;
+    }
+}
+
+namespace
+{
+    FAutoConsoleCommand GHexademicNetBandwidthCommand(
+        TEXT("hexademic.Net.BandwidthTest"),
+        TEXT("Measures consciousness replication bytes per agent per second. Usage: hexademic.Net.BandwidthTest [Agents] [Seconds] [UpdateHz]"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            const int32 NumAgents = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 100;
+            const float Seconds = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 10.0f;
+            const float UpdateHz = Args.Num() > 2 ? FCString::Atof(*Args[2]) : 10.0f;
+
+            const HexademicNet::FBandwidthReport Report = HexademicNet::MeasureConsciousnessBandwidth(NumAgents, Seconds, UpdateHz);
+            UE_LOG(LogTemp, Display, TEXT("[NetBandwidth] %d agents, %.1f s at %.1f Hz: reflected %.1f B/agent/s, quantized snapshot %.1f B/agent/s, delta %.1f B/agent/s (%.1f KB/s for all agents), %d mismatches"),
+                NumAgents, Seconds, UpdateHz,
+                Report.ReflectedBytesPerAgentSecond, Report.SnapshotBytesPerAgentSecond, Report.DeltaBytesPerAgentSecond,
+                Report.DeltaBytesPerAgentSecond * NumAgents / 1024.0, Report.NumMismatches);
+        }));
+}
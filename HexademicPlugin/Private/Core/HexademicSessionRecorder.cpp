@@ -0,0 +1,271 @@
+#include "Core/HexademicSessionRecorder.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+#include "Core/HexademicMetrics.h"
+
+namespace
+{
+    FAutoConsoleCommand GHexademicRecordStartCommand(
+        TEXT("hexademic.Record.Start"),
+        TEXT("Starts recording consciousness inputs. Usage: hexademic.Record.Start [FileName]"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            const FString FileName = Args.Num() > 0 ? Args[0] : FString::Printf(TEXT("Session_%s.hxrec"), *FDateTime::Now().ToString());
+            FHexademicSessionRecorder::Get().StartRecording(FileName);
+        }));
+
+    FAutoConsoleCommand GHexademicRecordStopCommand(
+        TEXT("hexademic.Record.Stop"),
+        TEXT("Stops the current consciousness recording and flushes it to disk."),
+        FConsoleCommandDelegate::CreateLambda([]() { FHexademicSessionRecorder::Get().StopRecording(); }));
+}
+
+FArchive& operator<<(FArchive& Ar, FHexademicRecordedEvent& Event)
+{
+    uint8 RawType = (uint8)Event.Type;
+    Ar << RawType;
+    Event.Type = (EHexademicRecordedEventType)RawType;
+    Ar << Event.SourceIndex;
+
+    auto SerializeValues = [&](int32 Count)
+    {
+        for (int32 i = 0; i < Count; i++)
+        {
+            Ar << Event.Values[i];
+        }
+    };
+
+    switch (Event.Type)
+    {
+    case EHexademicRecordedEventType::DeclareSource:
+    case EHexademicRecordedEventType::PhenomFile:
+        Ar << Event.Text;
+        break;
+    case EHexademicRecordedEventType::FrameBegin:
+        Ar << Event.DeltaTime;
+        Ar << Event.TimeSeconds;
+        Ar << Event.Seed;
+        break;
+    case EHexademicRecordedEventType::EnvironmentalStartle:
+        SerializeValues(1);
+        Ar << Event.Vector;
+        break;
+    case EHexademicRecordedEventType::EmotionalStimulus:
+        SerializeValues(3);
+        break;
+    case EHexademicRecordedEventType::Perception:
+        SerializeValues(4);
+        Ar << Event.Vector;
+        Ar << Event.Text;
+        break;
+    case EHexademicRecordedEventType::HapticPacket:
+    case EHexademicRecordedEventType::HapticFeedback:
+        SerializeValues(2);
+        Ar << Event.Vector;
+        Ar << Event.Text;
+        break;
+    case EHexademicRecordedEventType::StateDigest:
+        SerializeValues(FHexademicStateDigest::NumValues);
+        break;
+    default:
+        Ar.SetError();
+        break;
+    }
+    return Ar;
+}
+
+FHexademicSessionRecorder& FHexademicSessionRecorder::Get()
+{
+    static FHexademicSessionRecorder Recorder;
+    return Recorder;
+}
+
+FString FHexademicSessionRecorder::ResolveRecordingPath(const FString& Filename)
+{
+    if (FPaths::IsRelative(Filename))
+    {
+        return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Hexademic"), TEXT("Recordings"), Filename);
+    }
+    return Filename;
+}
+
+bool FHexademicSessionRecorder::StartRecording(const FString& Filename)
+{
+    check(IsInGameThread());
+    StopRecording();
+
+    RecordingPath = ResolveRecordingPath(Filename);
+    IFileManager::Get().MakeDirectory(*FPaths::GetPath(RecordingPath), true);
+    Writer.Reset(IFileManager::Get().CreateFileWriter(*RecordingPath));
+    if (!Writer.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("[SessionRecorder] Could not open '%s' for writing."), *RecordingPath);
+        return false;
+    }
+
+    uint32 Magic = StreamMagic;
+    uint32 Version = StreamVersion;
+    *Writer << Magic;
+    *Writer << Version;
+
+    SourceIndices.Reset();
+    EventsWritten = 0;
+    UE_LOG(LogTemp, Log, TEXT("[SessionRecorder] Recording consciousness inputs to '%s'."), *RecordingPath);
+    return true;
+}
+
+void FHexademicSessionRecorder::StopRecording()
+{
+    check(IsInGameThread());
+    if (!Writer.IsValid()) return;
+
+    const int64 TotalBytes = Writer->Tell();
+    Writer->Close();
+    Writer.Reset();
+    UE_LOG(LogTemp, Log, TEXT("[SessionRecorder] Stopped recording: %lld events, %lld bytes, %d sources -> '%s'."),
+        EventsWritten, TotalBytes, SourceIndices.Num(), *RecordingPath);
+}
+
+void FHexademicSessionRecorder::BeginFrame(const UObject* Source, float DeltaTime, double TimeSeconds, int32 Seed)
+{
+    if (!IsRecording()) return;
+
+    FHexademicRecordedEvent Event;
+    Event.Type = EHexademicRecordedEventType::FrameBegin;
+    Event.SourceIndex = ResolveSource(Source);
+    Event.DeltaTime = DeltaTime;
+    Event.TimeSeconds = TimeSeconds;
+    Event.Seed = Seed;
+    WriteEvent(Event);
+}
+
+void FHexademicSessionRecorder::RecordEnvironmentalStartle(const UObject* Source, float Intensity, const FVector& Location)
+{
+    if (!IsRecording()) return;
+
+    FHexademicRecordedEvent Event;
+    Event.Type = EHexademicRecordedEventType::EnvironmentalStartle;
+    Event.SourceIndex = ResolveSource(Source);
+    Event.Values[0] = Intensity;
+    Event.Vector = Location;
+    WriteEvent(Event);
+}
+
+void FHexademicSessionRecorder::RecordEmotionalStimulus(const UObject* Source, float Valence, float Arousal, float Intensity)
+{
+    if (!IsRecording()) return;
+
+    FHexademicRecordedEvent Event;
+    Event.Type = EHexademicRecordedEventType::EmotionalStimulus;
+    Event.SourceIndex = ResolveSource(Source);
+    Event.Values[0] = Valence;
+    Event.Values[1] = Arousal;
+    Event.Values[2] = Intensity;
+    WriteEvent(Event);
+}
+
+void FHexademicSessionRecorder::RecordPerception(const UObject* Source, float Strength, const FVector& Location, FName SenseName, float Valence, float Arousal, float Intensity)
+{
+    if (!IsRecording()) return;
+
+    FHexademicRecordedEvent Event;
+    Event.Type = EHexademicRecordedEventType::Perception;
+    Event.SourceIndex = ResolveSource(Source);
+    Event.Values[0] = Strength;
+    Event.Values[1] = Valence;
+    Event.Values[2] = Arousal;
+    Event.Values[3] = Intensity;
+    Event.Vector = Location;
+    Event.Text = SenseName.ToString();
+    WriteEvent(Event);
+}
+
+void FHexademicSessionRecorder::RecordHapticPacket(const UObject* Source, const FAetherTouchPacket& Packet)
+{
+    if (!IsRecording()) return;
+
+    FHexademicRecordedEvent Event;
+    Event.Type = EHexademicRecordedEventType::HapticPacket;
+    Event.SourceIndex = ResolveSource(Source);
+    Event.Values[0] = Packet.Intensity;
+    Event.Values[1] = Packet.Duration;
+    Event.Vector = Packet.Location;
+    Event.Text = Packet.RegionTag;
+    WriteEvent(Event);
+}
+
+void FHexademicSessionRecorder::RecordHapticFeedback(const UObject* Source, const FAetherTouchPacket& Packet)
+{
+    if (!IsRecording()) return;
+
+    FHexademicRecordedEvent Event;
+    Event.Type = EHexademicRecordedEventType::HapticFeedback;
+    Event.SourceIndex = ResolveSource(Source);
+    Event.Values[0] = Packet.Intensity;
+    Event.Values[1] = Packet.Duration;
+    Event.Vector = Packet.Location;
+    Event.Text = Packet.RegionTag;
+    WriteEvent(Event);
+}
+
+void FHexademicSessionRecorder::RecordPhenomFile(const UObject* Source, const FString& JsonString)
+{
+    if (!IsRecording()) return;
+
+    FHexademicRecordedEvent Event;
+    Event.Type = EHexademicRecordedEventType::PhenomFile;
+    Event.SourceIndex = ResolveSource(Source);
+    Event.Text = JsonString;
+    WriteEvent(Event);
+}
+
+void FHexademicSessionRecorder::RecordStateDigest(const UObject* Source, const FHexademicStateDigest& Digest)
+{
+    if (!IsRecording()) return;
+
+    FHexademicRecordedEvent Event;
+    Event.Type = EHexademicRecordedEventType::StateDigest;
+    Event.SourceIndex = ResolveSource(Source);
+    FMemory::Memcpy(Event.Values, Digest.Data(), sizeof(float) * FHexademicStateDigest::NumValues);
+    WriteEvent(Event);
+}
+
+uint16 FHexademicSessionRecorder::ResolveSource(const UObject* Source)
+{
+    // Components on the same actor share one source so the replayer can rebuild them as one headless consciousness
+    FString SourceName = TEXT("None");
+    if (const UActorComponent* Component = Cast<UActorComponent>(Source))
+    {
+        SourceName = Component->GetOwner() ? Component->GetOwner()->GetName() : Component->GetName();
+    }
+    else if (Source)
+    {
+        SourceName = Source->GetName();
+    }
+
+    if (const uint16* ExistingIndex = SourceIndices.Find(SourceName))
+    {
+        return *ExistingIndex;
+    }
+
+    const uint16 NewIndex = (uint16)SourceIndices.Num();
+    SourceIndices.Add(SourceName, NewIndex);
+
+    FHexademicRecordedEvent Declaration;
+    Declaration.Type = EHexademicRecordedEventType::DeclareSource;
+    Declaration.SourceIndex = NewIndex;
+    Declaration.Text = SourceName;
+    WriteEvent(Declaration);
+    return NewIndex;
+}
+
+void FHexademicSessionRecorder::WriteEvent(FHexademicRecordedEvent& Event)
+{
+    const int64 StartOffset = Writer->Tell();
+    *Writer << Event;
+    EventsWritten++;
+    HEXADEMIC_COUNTER_ADD("Recorder.BytesWritten", Writer->Tell() - StartOffset);
+}
@@ -0,0 +1,53 @@
+#include "Core/HexademicStateHistory.h"
+
+namespace HexademicStateHistory
+{
+    void ExtractChannels(const FUnifiedConsciousnessState& State, float* OutValues)
+    {
+        OutValues[(int32)EHexademicStateChannel::Valence] = State.CurrentResonance.Valence;
+        OutValues[(int32)EHexademicStateChannel::Arousal] = State.CurrentResonance.Arousal;
+        OutValues[(int32)EHexademicStateChannel::Intensity] = State.CurrentResonance.Intensity;
+        OutValues[(int32)EHexademicStateChannel::HeartRate] = State.HeartRate;
+        OutValues[(int32)EHexademicStateChannel::BreathingRate] = State.BreathingRate;
+        OutValues[(int32)EHexademicStateChannel::Cortisol] = State.CortisolLevel;
+        OutValues[(int32)EHexademicStateChannel::Dopamine] = State.DopamineLevel;
+        OutValues[(int32)EHexademicStateChannel::Serotonin] = State.SerotoninLevel;
+        OutValues[(int32)EHexademicStateChannel::Adrenaline] = State.AdrenalineLevel;
+        OutValues[(int32)EHexademicStateChannel::Oxytocin] = State.OxytocinLevel;
+        OutValues[(int32)EHexademicStateChannel::Melatonin] = State.MelatoninLevel;
+        OutValues[(int32)EHexademicStateChannel::CognitiveLoad] = State.CognitiveLoad;
+        OutValues[(int32)EHexademicStateChannel::AttentionFocus] = State.AttentionFocus;
+        OutValues[(int32)EHexademicStateChannel::CreativeState] = State.CreativeState;
+        OutValues[(int32)EHexademicStateChannel::SystemCoherence] = State.SystemCoherence;
+        OutValues[(int32)EHexademicStateChannel::SelfAwareness] = State.SelfAwareness;
+        OutValues[(int32)EHexademicStateChannel::EnvironmentalAwareness] = State.EnvironmentalAwareness;
+        OutValues[(int32)EHexademicStateChannel::TemporalAwareness] = State.TemporalAwareness;
+        OutValues[(int32)EHexademicStateChannel::Hunger] = State.HungerLevel;
+        OutValues[(int32)EHexademicStateChannel::Thirst] = State.ThirstLevel;
+        OutValues[(int32)EHexademicStateChannel::Fatigue] = State.FatigueLevel;
+    }
+
+    const float* GetQuantizationSteps()
+    {
+        struct FSteps
+        {
+            float Values[HexademicStateChannelCount];
+            FSteps()
+            {
+                for (float& Step : Values) { Step = 1.0f / 1024.0f; }
+                // Rates swing across tens of BPM; 1/16 BPM is well below anything the visuals or AI react to
+                Values[(int32)EHexademicStateChannel::HeartRate] = 1.0f / 16.0f;
+                Values[(int32)EHexademicStateChannel::BreathingRate] = 1.0f / 16.0f;
+            }
+        };
+        static const FSteps Steps;
+        return Steps.Values;
+    }
+
+    void Configure(FHexademicStateHistory& History, float HistorySeconds, float UpdateRateHz)
+    {
+        const int32 FramesPerKeyframe = FMath::Max(FMath::RoundToInt(UpdateRateHz), 1);
+        const int32 NumSegments = FMath::CeilToInt(FMath::Max(HistorySeconds, 1.0f) * UpdateRateHz / FramesPerKeyframe) + 1;
+        History.Configure(FramesPerKeyframe, NumSegments, GetQuantizationSteps());
+    }
+}
@@ -0,0 +1,251 @@
+#include "Core/HexademicTagIndex.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "Algo/Unique.h"
+
+namespace
+{
+    /** Inserts Row keeping Rows sorted; appending when rows arrive in order. */
+    void InsertSorted(TArray<int32>& Rows, int32 Row)
+    {
+        if (Rows.Num() == 0 || Rows.Last() < Row)
+        {
+            Rows.Add(Row);
+            return;
+        }
+        const int32 Index = Algo::LowerBound(Rows, Row);
+        if (Rows[Index] != Row)
+        {
+            Rows.Insert(Row, Index);
+        }
+    }
+}
+
+void FHexademicTagIndex::AddRow(int32 Row, FStringView Text)
+{
+    check(Row >= 0);
+    if (RowTokens.Num() <= Row)
+    {
+        RowTokens.SetNum(Row + 1);
+    }
+
+    ForEachToken(Text, [this, Row](FStringView Token)
+    {
+        const int32 Node = FindOrAddNode(Token);
+        if (!RowTokens[Row].Contains(Node))
+        {
+            RowTokens[Row].Add(Node);
+            InsertSorted(Nodes[Node].Rows, Row);
+        }
+    });
+}
+
+void FHexademicTagIndex::RemoveRow(int32 Row)
+{
+    if (!RowTokens.IsValidIndex(Row)) return;
+
+    for (const int32 Node : RowTokens[Row])
+    {
+        TArray<int32>& Rows = Nodes[Node].Rows;
+        const int32 Index = Algo::BinarySearch(Rows, Row);
+        if (Index != INDEX_NONE)
+        {
+            Rows.RemoveAt(Index);
+        }
+    }
+    RowTokens[Row].Reset();
+}
+
+void FHexademicTagIndex::Empty()
+{
+    Nodes.Reset();
+    Nodes.AddDefaulted();
+    RowTokens.Reset();
+}
+
+int32 FHexademicTagIndex::FindNode(FStringView Key) const
+{
+    int32 Node = 0;
+    for (const TCHAR Char : Key)
+    {
+        const TCHAR Lower = FChar::ToLower(Char);
+        const TPair<TCHAR, int32>* Child = Nodes[Node].Children.FindByPredicate([Lower](const TPair<TCHAR, int32>& Edge) { return Edge.Key == Lower; });
+        if (!Child) return INDEX_NONE;
+        Node = Child->Value;
+    }
+    return Node;
+}
+
+int32 FHexademicTagIndex::FindOrAddNode(FStringView Key)
+{
+    int32 Node = 0;
+    for (const TCHAR Char : Key)
+    {
+        const TCHAR Lower = FChar::ToLower(Char);
+        const TPair<TCHAR, int32>* Child = Nodes[Node].Children.FindByPredicate([Lower](const TPair<TCHAR, int32>& Edge) { return Edge.Key == Lower; });
+        if (Child)
+        {
+            Node = Child->Value;
+            continue;
+        }
+        const int32 NewNode = Nodes.AddDefaulted();
+        Nodes[Node].Children.Emplace(Lower, NewNode);
+        Node = NewNode;
+    }
+    return Node;
+}
+
+bool FHexademicTagIndex::ResolveTokens(FStringView Text, TArray<int32, TInlineAllocator<8>>& OutNodes) const
+{
+    const int32 FirstOut = OutNodes.Num();
+    bool bAllIndexed = true;
+    ForEachToken(Text, [this, &OutNodes, &bAllIndexed](FStringView Token)
+    {
+        const int32 Node = bAllIndexed ? FindNode(Token) : INDEX_NONE;
+        if (Node == INDEX_NONE || Nodes[Node].Rows.Num() == 0)
+        {
+            bAllIndexed = false;
+            return;
+        }
+        OutNodes.AddUnique(Node);
+    });
+    if (!bAllIndexed)
+    {
+        OutNodes.SetNum(FirstOut); // No row carries all of Text, so none of its tokens may match on their own
+    }
+    return bAllIndexed;
+}
+
+void FHexademicTagIndex::Intersect(TConstArrayView<int32> NodeIndices, TArray<int32>& OutRows) const
+{
+    if (NodeIndices.Num() == 0) return;
+
+    // Walk the shortest posting and look each row up in the others
+    int32 Shortest = NodeIndices[0];
+    for (const int32 Node : NodeIndices)
+    {
+        if (Nodes[Node].Rows.Num() < Nodes[Shortest].Rows.Num()) Shortest = Node;
+    }
+
+    for (const int32 Row : Nodes[Shortest].Rows)
+    {
+        bool bInAll = true;
+        for (const int32 Node : NodeIndices)
+        {
+            if (Node != Shortest && Algo::BinarySearch(Nodes[Node].Rows, Row) == INDEX_NONE)
+            {
+                bInAll = false;
+                break;
+            }
+        }
+        if (bInAll) OutRows.Add(Row);
+    }
+}
+
+void FHexademicTagIndex::Union(TConstArrayView<int32> NodeIndices, TArray<int32>& OutRows) const
+{
+    const int32 FirstOut = OutRows.Num();
+    for (const int32 Node : NodeIndices)
+    {
+        OutRows.Append(Nodes[Node].Rows);
+    }
+    if (NodeIndices.Num() > 1)
+    {
+        TArrayView<int32> Added = TArrayView<int32>(OutRows).Slice(FirstOut, OutRows.Num() - FirstOut);
+        Algo::Sort(Added);
+        const int32 NumUnique = Algo::Unique(Added);
+        OutRows.SetNum(FirstOut + NumUnique);
+    }
+}
+
+void FHexademicTagIndex::FindExact(FStringView Tag, TArray<int32>& OutRows) const
+{
+    TArray<int32, TInlineAllocator<8>> TagNodes;
+    if (ResolveTokens(Tag, TagNodes))
+    {
+        Intersect(TagNodes, OutRows);
+    }
+}
+
+void FHexademicTagIndex::FindPrefix(FStringView Prefix, TArray<int32>& OutRows) const
+{
+    const int32 Root = FindNode(Prefix);
+    if (Root == INDEX_NONE) return;
+
+    TArray<int32, TInlineAllocator<16>> TokenNodes;
+    TArray<int32, TInlineAllocator<16>> Stack = { Root };
+    while (Stack.Num() > 0)
+    {
+        const int32 Node = Stack.Pop();
+        if (Nodes[Node].Rows.Num() > 0) TokenNodes.Add(Node);
+        for (const TPair<TCHAR, int32>& Edge : Nodes[Node].Children)
+        {
+            Stack.Add(Edge.Value);
+        }
+    }
+    Union(TokenNodes, OutRows);
+}
+
+void FHexademicTagIndex::FindTags(TConstArrayView<FString> Tags, bool bMatchAll, TArray<int32>& OutRows) const
+{
+    TArray<int32, TInlineAllocator<8>> TagNodes;
+    if (bMatchAll)
+    {
+        for (const FString& Tag : Tags)
+        {
+            // A tag nothing carries empties an AND
+            if (!ResolveTokens(Tag, TagNodes)) return;
+        }
+        Intersect(TagNodes, OutRows);
+        return;
+    }
+
+    // OR is over whole tags: each tag is the AND of its own tokens, so "LeftHand" does not match "RightHand"
+    const int32 FirstOut = OutRows.Num();
+    int32 NumMatchedTags = 0;
+    for (const FString& Tag : Tags)
+    {
+        TagNodes.Reset();
+        if (ResolveTokens(Tag, TagNodes) && TagNodes.Num() > 0)
+        {
+            Intersect(TagNodes, OutRows);
+            NumMatchedTags++;
+        }
+    }
+    if (NumMatchedTags > 1)
+    {
+        TArrayView<int32> Added = TArrayView<int32>(OutRows).Slice(FirstOut, OutRows.Num() - FirstOut);
+        Algo::Sort(Added);
+        OutRows.SetNum(FirstOut + Algo::Unique(Added));
+    }
+}
+
+void FHexademicTagIndex::FindContainedIn(FStringView Text, TArray<int32>& OutRows) const
+{
+    // Tokens of Text no row carries are simply skipped
+    TArray<int32, TInlineAllocator<8>> TextNodes;
+    ForEachToken(Text, [this, &TextNodes](FStringView Token)
+    {
+        const int32 Node = FindNode(Token);
+        if (Node != INDEX_NONE && Nodes[Node].Rows.Num() > 0) TextNodes.AddUnique(Node);
+    });
+
+    // A row qualifies when every one of its tokens is among Text's: count its hits across the postings
+    TArray<int32, TInlineAllocator<64>> Hits;
+    for (const int32 Node : TextNodes)
+    {
+        Hits.Append(Nodes[Node].Rows);
+    }
+    Algo::Sort(Hits);
+
+    for (int32 Start = 0; Start < Hits.Num();)
+    {
+        int32 End = Start + 1;
+        while (End < Hits.Num() && Hits[End] == Hits[Start]) End++;
+        if (End - Start == RowTokens[Hits[Start]].Num())
+        {
+            OutRows.Add(Hits[Start]);
+        }
+        Start = End;
+    }
+}
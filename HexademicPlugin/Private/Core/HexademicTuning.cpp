@@ -0,0 +1,355 @@
+#include "Core/HexademicTuning.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Paths.h"
+#include "Core/HexademicMetrics.h"
+
+#define HEXADEMIC_TUNING_PARAM(Section, Member, Key, Type) \
+    { TEXT(Section), TEXT(#Key), EParameterType::Type, STRUCT_OFFSET(FHexademicTuningTable, Member) + STRUCT_OFFSET(decltype(FHexademicTuningTable::Member), Key) }
+
+namespace
+{
+    FAutoConsoleCommand GHexademicTuningReloadCommand(
+        TEXT("hexademic.Tuning.Reload"),
+        TEXT("Re-reads DefaultConsciousness.ini and publishes any changed tuning values."),
+        FConsoleCommandDelegate::CreateLambda([]() { FHexademicTuningService::Get().Reload(); }));
+
+    FAutoConsoleCommand GHexademicTuningSetCommand(
+        TEXT("hexademic.Tuning.Set"),
+        TEXT("Overrides a tuning value live. Usage: hexademic.Tuning.Set <Section.Key> <Value> [Reason...]"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            if (Args.Num() < 2)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("[HexademicTuning] Usage: hexademic.Tuning.Set <Section.Key> <Value> [Reason...]"));
+                return;
+            }
+            const FString Reason = Args.Num() > 2 ? FString::Join(TArrayView<const FString>(Args).RightChop(2), TEXT(" ")) : TEXT("console");
+            FHexademicTuningService::Get().SetOverride(Args[0], Args[1], Reason);
+        }));
+
+    FAutoConsoleCommand GHexademicTuningClearCommand(
+        TEXT("hexademic.Tuning.ClearOverrides"),
+        TEXT("Removes every live tuning override and falls back to the ini values."),
+        FConsoleCommandDelegate::CreateLambda([]() { FHexademicTuningService::Get().ClearOverrides(); }));
+
+    FAutoConsoleCommand GHexademicTuningDumpCommand(
+        TEXT("hexademic.Tuning.Dump"),
+        TEXT("Logs every parameter of the current tuning table."),
+        FConsoleCommandDelegate::CreateLambda([]() { FHexademicTuningService::Get().DumpToLog(); }));
+
+    FAutoConsoleCommand GHexademicTuningAuditCommand(
+        TEXT("hexademic.Tuning.Audit"),
+        TEXT("Logs every tuning change with its version, old/new value and origin."),
+        FConsoleCommandDelegate::CreateLambda([]()
+        {
+            const TArray<FHexademicTuningAuditEntry> AuditLog = FHexademicTuningService::Get().GetAuditLog();
+            UE_LOG(LogTemp, Log, TEXT("--- Hexademic Tuning Audit (%d) ---"), AuditLog.Num());
+            for (const FHexademicTuningAuditEntry& Entry : AuditLog)
+            {
+                UE_LOG(LogTemp, Log, TEXT("v%u %s %-50s %s -> %s (%s)"), Entry.Version, *Entry.Timestamp.ToString(),
+                    *Entry.Parameter, *Entry.OldValue, *Entry.NewValue, *Entry.Origin);
+            }
+        }));
+}
+
+FHexademicTuningService& FHexademicTuningService::Get()
+{
+    static FHexademicTuningService Service;
+    return Service;
+}
+
+FHexademicTuningService::FHexademicTuningService()
+    : CurrentTable(MakeShared<const FHexademicTuningTable, ESPMode::ThreadSafe>())
+{
+    SourcePath = FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectDir(), TEXT("DefaultConsciousness.ini")));
+    if (IsInGameThread())
+    {
+        Reload();
+    }
+    else
+    {
+        // Readers get the defaults until the file is read where publication is allowed
+        AsyncTask(ENamedThreads::GameThread, []() { FHexademicTuningService::Get().Reload(); });
+    }
+    // The core ticker finishes constructing before this service does, so it is destroyed after it
+    PollHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FHexademicTuningService::PollSourceFile), PollIntervalSeconds);
+}
+
+FHexademicTuningService::~FHexademicTuningService()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(PollHandle);
+}
+
+const TArray<FHexademicTuningService::FParameterDesc>& FHexademicTuningService::GetParameters()
+{
+    static const TArray<FParameterDesc> Parameters =
+    {
+        HEXADEMIC_TUNING_PARAM("ConsciousnessSettings", Consciousness, DefaultConsciousnessLOD, Name),
+        HEXADEMIC_TUNING_PARAM("ConsciousnessSettings", Consciousness, MaxConsciousEntities, Int),
+        HEXADEMIC_TUNING_PARAM("ConsciousnessSettings", Consciousness, EmotionalDecayRate, Float),
+        HEXADEMIC_TUNING_PARAM("ConsciousnessSettings", Consciousness, MemoryThreadLimit, Int),
+
+        HEXADEMIC_TUNING_PARAM("EmotionalSettings", Emotional, EmotionalContagionRadius, Float),
+        HEXADEMIC_TUNING_PARAM("EmotionalSettings", Emotional, EmotionalIntensityMultiplier, Float),
+        HEXADEMIC_TUNING_PARAM("EmotionalSettings", Emotional, CrossConsciousnessBleedthrough, Float),
+        HEXADEMIC_TUNING_PARAM("EmotionalSettings", Emotional, EcosystemUpdateFrequency, Float),
+        HEXADEMIC_TUNING_PARAM("EmotionalSettings", Emotional, ValenceResonanceFactor, Float),
+        HEXADEMIC_TUNING_PARAM("EmotionalSettings", Emotional, ArousalResonanceFactor, Float),
+        HEXADEMIC_TUNING_PARAM("EmotionalSettings", Emotional, IntensityResonanceFactor, Float),
+
+        HEXADEMIC_TUNING_PARAM("BodySettings", Body, HormoneDecayRate, Float),
+        HEXADEMIC_TUNING_PARAM("BodySettings", Body, StartleThreshold, Float),
+        HEXADEMIC_TUNING_PARAM("BodySettings", Body, ReflexEmotionalImpactScale, Float),
+
+        HEXADEMIC_TUNING_PARAM("PersonalitySettings", Personality, TraitDecayRate, Float),
+
+        HEXADEMIC_TUNING_PARAM("FractalSettings", Fractal, FrameBudgetMs, Float),
+        HEXADEMIC_TUNING_PARAM("FractalSettings", Fractal, TargetUtilization, Float),
+        HEXADEMIC_TUNING_PARAM("FractalSettings", Fractal, ImportanceCutoffGain, Float),
+    };
+    return Parameters;
+}
+
+FString FHexademicTuningService::ReadValue(const FHexademicTuningTable& Table, const FParameterDesc& Desc)
+{
+    const uint8* Field = reinterpret_cast<const uint8*>(&Table) + Desc.Offset;
+    switch (Desc.Type)
+    {
+    case EParameterType::Float: return FString::SanitizeFloat(*reinterpret_cast<const float*>(Field));
+    case EParameterType::Int:   return FString::FromInt(*reinterpret_cast<const int32*>(Field));
+    case EParameterType::Name:  return reinterpret_cast<const FName*>(Field)->ToString();
+    }
+    return FString();
+}
+
+bool FHexademicTuningService::WriteValue(FHexademicTuningTable& Table, const FParameterDesc& Desc, const FString& Value)
+{
+    uint8* Field = reinterpret_cast<uint8*>(&Table) + Desc.Offset;
+    const FString Trimmed = Value.TrimStartAndEnd();
+    switch (Desc.Type)
+    {
+    case EParameterType::Float:
+        if (!Trimmed.IsNumeric()) return false;
+        *reinterpret_cast<float*>(Field) = FCString::Atof(*Trimmed);
+        return true;
+    case EParameterType::Int:
+        if (!Trimmed.IsNumeric()) return false;
+        *reinterpret_cast<int32*>(Field) = FCString::Atoi(*Trimmed);
+        return true;
+    case EParameterType::Name:
+        if (Trimmed.IsEmpty()) return false;
+        *reinterpret_cast<FName*>(Field) = FName(*Trimmed);
+        return true;
+    }
+    return false;
+}
+
+const FHexademicTuningService::FParameterDesc* FHexademicTuningService::FindParameter(const FString& Parameter)
+{
+    FString Section, Key;
+    if (!Parameter.Split(TEXT("."), &Section, &Key)) return nullptr;
+
+    return GetParameters().FindByPredicate([&](const FParameterDesc& Desc)
+    {
+        return Section.Equals(Desc.Section, ESearchCase::IgnoreCase) && Key.Equals(Desc.Key, ESearchCase::IgnoreCase);
+    });
+}
+
+FHexademicTuningTableRef FHexademicTuningService::GetTable() const
+{
+    FReadScopeLock ReadLock(TableLock);
+    return CurrentTable;
+}
+
+bool FHexademicTuningService::Reload()
+{
+    check(IsInGameThread());
+
+    FConfigFile ConfigFile;
+    const bool bHasFile = IFileManager::Get().FileExists(*SourcePath);
+    if (bHasFile)
+    {
+        ConfigFile.Read(SourcePath);
+        SourceTimestamp = IFileManager::Get().GetTimeStamp(*SourcePath);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[HexademicTuning] '%s' not found; using built-in defaults."), *SourcePath);
+    }
+
+    const FHexademicTuningTableRef OldTable = GetTable();
+    FHexademicTuningTable NewTable; // Start from defaults so a key removed from the file reverts
+    TArray<FHexademicTuningAuditEntry> Changes;
+
+    for (const FParameterDesc& Desc : GetParameters())
+    {
+        const FString Parameter = FString::Printf(TEXT("%s.%s"), Desc.Section, Desc.Key);
+        FString Origin = TEXT("File");
+
+        FString FileValue;
+        if (bHasFile && ConfigFile.GetString(Desc.Section, Desc.Key, FileValue) && !WriteValue(NewTable, Desc, FileValue))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[HexademicTuning] Ignoring invalid value '%s' for %s."), *FileValue, *Parameter);
+        }
+        if (const FString* OverrideValue = Overrides.Find(Parameter))
+        {
+            WriteValue(NewTable, Desc, *OverrideValue);
+            Origin = FString::Printf(TEXT("Override: %s"), *OverrideReasons.FindRef(Parameter));
+        }
+
+        const FString OldValue = ReadValue(*OldTable, Desc);
+        const FString NewValue = ReadValue(NewTable, Desc);
+        if (OldValue != NewValue)
+        {
+            FHexademicTuningAuditEntry& Entry = Changes.AddDefaulted_GetRef();
+            Entry.Parameter = Parameter;
+            Entry.OldValue = OldValue;
+            Entry.NewValue = NewValue;
+            Entry.Origin = Origin;
+        }
+    }
+
+    if (Changes.Num() == 0)
+    {
+        return false;
+    }
+    Publish(MoveTemp(NewTable), MoveTemp(Changes));
+    return true;
+}
+
+bool FHexademicTuningService::SetOverride(const FString& Parameter, const FString& Value, const FString& Reason)
+{
+    const FParameterDesc* Desc = FindParameter(Parameter);
+    FHexademicTuningTable Probe;
+    if (!Desc || !WriteValue(Probe, *Desc, Value))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[HexademicTuning] Cannot override '%s' with '%s' (unknown parameter or invalid value)."), *Parameter, *Value);
+        return false;
+    }
+
+    const FString CanonicalName = FString::Printf(TEXT("%s.%s"), Desc->Section, Desc->Key);
+    Overrides.Add(CanonicalName, Value);
+    OverrideReasons.Add(CanonicalName, Reason);
+    Reload();
+    return true;
+}
+
+void FHexademicTuningService::ClearOverrides()
+{
+    if (Overrides.Num() == 0) return;
+
+    Overrides.Reset();
+    OverrideReasons.Reset();
+    if (Reload())
+    {
+        // Values that fell back to the file are logged with origin "File"; mark them as the result of clearing
+        FWriteScopeLock WriteLock(TableLock);
+        const uint32 Version = CurrentTable->Version;
+        for (int32 i = AuditLog.Num() - 1; i >= 0 && AuditLog[i].Version == Version; i--)
+        {
+            AuditLog[i].Origin = TEXT("Override cleared");
+        }
+    }
+}
+
+TArray<FHexademicTuningAuditEntry> FHexademicTuningService::GetAuditLog() const
+{
+    FReadScopeLock ReadLock(TableLock);
+    return AuditLog;
+}
+
+void FHexademicTuningService::DumpToLog() const
+{
+    const FHexademicTuningTableRef Table = GetTable();
+    UE_LOG(LogTemp, Log, TEXT("--- Hexademic Tuning v%u (%s) ---"), Table->Version, *SourcePath);
+    for (const FParameterDesc& Desc : GetParameters())
+    {
+        const FString Parameter = FString::Printf(TEXT("%s.%s"), Desc.Section, Desc.Key);
+        UE_LOG(LogTemp, Log, TEXT("%-50s %s%s"), *Parameter, *ReadValue(*Table, Desc),
+            Overrides.Contains(Parameter) ? TEXT("  [override]") : TEXT(""));
+    }
+}
+
+bool FHexademicTuningService::PollSourceFile(float DeltaTime)
+{
+    const FDateTime Timestamp = IFileManager::Get().GetTimeStamp(*SourcePath);
+    if (Timestamp != FDateTime::MinValue() && Timestamp != SourceTimestamp)
+    {
+        UE_LOG(LogTemp, Log, TEXT("[HexademicTuning] '%s' changed on disk, reloading."), *SourcePath);
+        Reload();
+    }
+    return true; // Keep polling
+}
+
+void FHexademicTuningService::Publish(FHexademicTuningTable&& NewTable, TArray<FHexademicTuningAuditEntry>&& Changes)
+{
+    {
+        FWriteScopeLock WriteLock(TableLock);
+        NewTable.Version = CurrentTable->Version + 1;
+        NewTable.PublishedAt = FDateTime::UtcNow();
+
+        for (FHexademicTuningAuditEntry& Entry : Changes)
+        {
+            Entry.Version = NewTable.Version;
+            Entry.Timestamp = NewTable.PublishedAt;
+        }
+        AuditLog.Append(MoveTemp(Changes));
+        if (AuditLog.Num() > MaxAuditEntries)
+        {
+            AuditLog.RemoveAt(0, AuditLog.Num() - MaxAuditEntries);
+        }
+
+        CurrentTable = MakeShared<const FHexademicTuningTable, ESPMode::ThreadSafe>(MoveTemp(NewTable));
+    }
+
+    const FHexademicTuningTableRef Published = GetTable();
+    HEXADEMIC_GAUGE_SET("Tuning.Version", Published->Version);
+    UE_LOG(LogTemp, Log, TEXT("[HexademicTuning] Published tuning v%u."), Published->Version);
+    OnTuningChanged.Broadcast(*Published);
+}
+
+void FHexademicTuningBinding::Bind(UObject* InOwner, FApplyFunction&& InApply)
+{
+    Unbind();
+    check(InOwner);
+
+    UClass* NativeClass = InOwner->GetClass();
+    while (!NativeClass->HasAnyClassFlags(CLASS_Native))
+    {
+        NativeClass = NativeClass->GetSuperClass();
+    }
+    Owner = InOwner;
+    NativeDefaults = NativeClass->GetDefaultObject();
+    ApplyFunction = MoveTemp(InApply);
+
+    FHexademicTuningService& Service = FHexademicTuningService::Get();
+    ApplyFunction(*Service.GetTable(), *this);
+    Handle = Service.OnTuningChanged.AddWeakLambda(InOwner, [this](const FHexademicTuningTable& Table) { ApplyFunction(Table, *this); });
+}
+
+void FHexademicTuningBinding::Unbind()
+{
+    if (Handle.IsValid())
+    {
+        FHexademicTuningService::Get().OnTuningChanged.Remove(Handle);
+        Handle.Reset();
+    }
+    Owner = nullptr;
+    NativeDefaults = nullptr;
+    ApplyFunction = nullptr;
+    OverriddenByOffset.Reset();
+}
+
+bool FHexademicTuningBinding::IsOverridden(SIZE_T Offset, TFunctionRef<bool()> DiffersFromDefault)
+{
+    if (const bool* bOverridden = OverriddenByOffset.Find(Offset))
+    {
+        return *bOverridden;
+    }
+    return OverriddenByOffset.Add(Offset, DiffersFromDefault());
+}
+
+#undef HEXADEMIC_TUNING_PARAM
@@ -0,0 +1,69 @@
+#include "Fractal/HexademicDecayedAccumulators.h"
+
+void FHexademicDecayedAccumulators::Configure(TConstArrayView<float> HalfLivesSeconds)
+{
+    Channels.Reset();
+    Channels.AddDefaulted(HalfLivesSeconds.Num());
+    for (int32 i = 0; i < HalfLivesSeconds.Num(); i++)
+    {
+        Channels[i].DecayRate = HalfLivesSeconds[i] > 0.0f ? UE_LN2 / HalfLivesSeconds[i] : 0.0;
+    }
+}
+
+void FHexademicDecayedAccumulators::Reset()
+{
+    for (FChannel& Channel : Channels)
+    {
+        const double DecayRate = Channel.DecayRate;
+        Channel = FChannel();
+        Channel.DecayRate = DecayRate;
+    }
+}
+
+float FHexademicDecayedAccumulators::DecayFactor(const FChannel& Channel, double NowSeconds)
+{
+    const double Elapsed = NowSeconds - Channel.LastTime;
+    if (Elapsed <= 0.0) return 1.0f; // Same instant, or a caller whose clock stepped back
+    return Channel.DecayRate > 0.0 ? static_cast<float>(FMath::Exp(-Channel.DecayRate * Elapsed)) : 0.0f;
+}
+
+void FHexademicDecayedAccumulators::Add(int32 Channel, float Value, double NowSeconds)
+{
+    if (!Channels.IsValidIndex(Channel)) return;
+
+    FChannel& Target = Channels[Channel];
+    const float Decay = DecayFactor(Target, NowSeconds);
+    Target.Sum = Target.Sum * Decay + Value;
+    Target.Count = Target.Count * Decay + 1.0f;
+    Target.LastValue = Value;
+    Target.LastTime = FMath::Max(Target.LastTime, NowSeconds);
+}
+
+float FHexademicDecayedAccumulators::GetSum(int32 Channel, double NowSeconds) const
+{
+    if (!Channels.IsValidIndex(Channel)) return 0.0f;
+    return Channels[Channel].Sum * DecayFactor(Channels[Channel], NowSeconds);
+}
+
+float FHexademicDecayedAccumulators::GetMean(int32 Channel, double NowSeconds) const
+{
+    // Sum and count decay by the same factor, so the mean does not change while a channel is idle
+    if (!Channels.IsValidIndex(Channel) || Channels[Channel].Count <= KINDA_SMALL_NUMBER) return 0.0f;
+    return DecayFactor(Channels[Channel], NowSeconds) > 0.0f ? Channels[Channel].Sum / Channels[Channel].Count : 0.0f;
+}
+
+int32 FHexademicDecayedAccumulators::GetDominantChannel(double NowSeconds) const
+{
+    int32 Dominant = INDEX_NONE;
+    float Best = 0.0f;
+    for (int32 i = 0; i < Channels.Num(); i++)
+    {
+        const float Sum = GetSum(i, NowSeconds);
+        if (Sum > Best)
+        {
+            Best = Sum;
+            Dominant = i;
+        }
+    }
+    return Dominant;
+}
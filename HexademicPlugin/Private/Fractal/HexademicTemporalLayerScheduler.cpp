@@ -0,0 +1,76 @@
+#include "Fractal/HexademicTemporalLayerScheduler.h"
+
+void FHexademicTemporalLayerScheduler::Configure(TConstArrayView<float> UpdateFrequencies, uint32 StaggerSeed, double NowSeconds)
+{
+    Slots.Reset();
+    Slots.AddDefaulted(UpdateFrequencies.Num());
+
+    for (int32 i = 0; i < UpdateFrequencies.Num(); i++)
+    {
+        FLayerSlot& Slot = Slots[i];
+        Slot.Period = UpdateFrequencies[i] > 0.0f ? 1.0 / UpdateFrequencies[i] : 0.0;
+        // Fraction of a period by which this agent's layer is shifted, so equal layers on different agents fall on different frames
+        Slot.Phase = Slot.Period * (static_cast<double>(HashCombine(StaggerSeed, GetTypeHash(i))) / static_cast<double>(MAX_uint32));
+        Slot.NextDueTime = NowSeconds;
+        Slot.LastRunTime = NowSeconds;
+        Slot.bHasRun = false;
+    }
+    EarliestDueTime = NowSeconds;
+}
+
+void FHexademicTemporalLayerScheduler::Reset()
+{
+    Slots.Reset();
+    EarliestDueTime = TNumericLimits<double>::Max();
+}
+
+bool FHexademicTemporalLayerScheduler::CollectDueLayers(double NowSeconds, FDueLayers& OutDue) const
+{
+    if (NowSeconds < EarliestDueTime)
+    {
+        return false;
+    }
+
+    const int32 NumBefore = OutDue.Num();
+    for (int32 i = 0; i < Slots.Num(); i++)
+    {
+        const FLayerSlot& Slot = Slots[i];
+        if (Slot.NextDueTime <= NowSeconds)
+        {
+            OutDue.Add({ i, static_cast<float>(NowSeconds - Slot.LastRunTime) });
+        }
+    }
+    return OutDue.Num() > NumBefore;
+}
+
+void FHexademicTemporalLayerScheduler::CommitLayer(int32 LayerIndex, double NowSeconds, bool bRan)
+{
+    if (!Slots.IsValidIndex(LayerIndex)) return;
+
+    FLayerSlot& Slot = Slots[LayerIndex];
+    if (!Slot.bHasRun)
+    {
+        // Every layer is due on the first collect; the stagger takes effect from the next slot on
+        Slot.NextDueTime = NowSeconds + Slot.Period - Slot.Phase;
+    }
+    else
+    {
+        // Advance from the due time so the cadence holds on average, but never queue a burst of catch-up runs
+        Slot.NextDueTime += Slot.Period;
+    }
+    if (Slot.NextDueTime <= NowSeconds)
+    {
+        Slot.NextDueTime = NowSeconds + Slot.Period;
+    }
+    if (bRan)
+    {
+        Slot.LastRunTime = NowSeconds;
+        Slot.bHasRun = true;
+    }
+
+    EarliestDueTime = TNumericLimits<double>::Max();
+    for (const FLayerSlot& Other : Slots)
+    {
+        EarliestDueTime = FMath::Min(EarliestDueTime, Other.NextDueTime);
+    }
+}
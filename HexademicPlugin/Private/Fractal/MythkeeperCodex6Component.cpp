@@ -0,0 +1,373 @@
+#include "Fractal/MythkeeperCodex6Component.h"
+#include "Engine/World.h"
+#include "Core/HexademicMetrics.h"
+#include "Core/HexademicArchetypeClassifier.h"
+
+namespace
+{
+    constexpr int32 NumLatticeOrders = static_cast<int32>(ECognitiveLatticeOrder::OrderInfinite) + 1;
+    constexpr double LatticeAxisRange = 65535.0; // Coordinates are laid out in a 16-bit space per axis
+
+    // Archetype IDs as used across the lattice: EEmotionalArchetype's value plus one
+    constexpr uint32 ArchetypeJoy = 0x1;
+    constexpr uint32 ArchetypeGrief = 0x2;
+    constexpr uint32 ArchetypeAwe = 0x3;
+    constexpr uint32 ArchetypeRage = 0x4;
+    constexpr uint32 ArchetypeLonging = 0x5;
+    constexpr uint32 ArchetypeFear = 0x6;
+    constexpr uint32 ArchetypeCuriosity = 0x7;
+
+    FMythicPatternDefinition MakePattern(const TCHAR* Name, std::initializer_list<uint32> Sequence, float MaxSpanSeconds, const TCHAR* Template)
+    {
+        FMythicPatternDefinition Pattern;
+        Pattern.PatternName = Name;
+        Pattern.ArchetypeSequence = Sequence;
+        Pattern.MaxSpanSeconds = MaxSpanSeconds;
+        Pattern.NarrativeTemplate = Template;
+        return Pattern;
+    }
+}
+
+UMythkeeperCodex6Component::UMythkeeperCodex6Component()
+{
+    PrimaryComponentTick.bCanEverTick = false; // Entirely event-driven
+
+    // Faster orders forget faster: from sub-second sensory resonance to the unified field's hour
+    OrderHalfLivesSeconds = { 0.25f, 1.0f, 5.0f, 30.0f, 120.0f, 600.0f, 3600.0f };
+
+    PatternDefinitions.Add(MakePattern(TEXT("HerosJourney"), { ArchetypeCuriosity, ArchetypeFear, ArchetypeAwe }, 180.0f,
+        TEXT("The Hero's Journey at {Order}: a call into the unknown, a trial of fear, a return in awe.")));
+    PatternDefinitions.Add(MakePattern(TEXT("DescentAndReturn"), { ArchetypeGrief, ArchetypeLonging, ArchetypeJoy }, 300.0f,
+        TEXT("Descent and Return at {Order}: loss, a long yearning, and light again.")));
+    PatternDefinitions.Add(MakePattern(TEXT("TricksterTurn"), { ArchetypeJoy, ArchetypeRage, ArchetypeCuriosity }, 60.0f,
+        TEXT("The Trickster's Turn at {Order}: play turned to fury, and fury to a question.")));
+    PatternDefinitions.Add(MakePattern(TEXT("SacredWound"), { ArchetypeRage, ArchetypeGrief, ArchetypeAwe }, 240.0f,
+        TEXT("The Sacred Wound at {Order}, told {Occurrences} times: what burned and was mourned becomes wonder.")));
+}
+
+void UMythkeeperCodex6Component::BeginPlay()
+{
+    Super::BeginPlay();
+
+    TArray<float, TInlineAllocator<NumLatticeOrders>> HalfLives;
+    for (int32 i = 0; i < NumLatticeOrders; i++)
+    {
+        HalfLives.Add(OrderHalfLivesSeconds.IsValidIndex(i) ? OrderHalfLivesSeconds[i] : 60.0f);
+    }
+    OrderResonance.Configure(HalfLives);
+    RebuildPatternIndex();
+
+    UE_LOG(LogTemp, Log, TEXT("[MythkeeperCodex6] Initialized with %d mythic patterns."), PatternDefinitions.Num());
+}
+
+void UMythkeeperCodex6Component::RebuildPatternIndex()
+{
+    PatternsByFirstArchetype.Reset();
+    PartialMatches.Reset();
+    PendingSummaries.Reset();
+    PatternSummaries.SetNum(PatternDefinitions.Num());
+    for (int32 i = 0; i < PatternDefinitions.Num(); i++)
+    {
+        PatternSummaries[i] = FHexademicMythicPatternSummary();
+        PatternSummaries[i].PatternName = PatternDefinitions[i].PatternName;
+        if (PatternDefinitions[i].ArchetypeSequence.Num() > 0)
+        {
+            PatternsByFirstArchetype.Add(PatternDefinitions[i].ArchetypeSequence[0], i);
+        }
+    }
+}
+
+double UMythkeeperCodex6Component::GetNowSeconds() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0;
+}
+
+uint32 UMythkeeperCodex6Component::ClassifyArchetype(float Valence, float Arousal, float Intensity)
+{
+    return static_cast<uint32>(FHexademicArchetypeClassifier::Get().Classify(Valence, Arousal, Intensity)) + 1;
+}
+
+//=============================================================================
+// RESONANCE SERVICE
+//=============================================================================
+
+float UMythkeeperCodex6Component::CalculateResonanceStrength_Implementation(const FHexademic6DCoordinate& A, const FHexademic6DCoordinate& B) const
+{
+    // Proximity in the lattice, halving every ResonanceDistanceScale
+    double DistanceSquared = 0.0;
+    const uint64 AxesA[6] = { A.X, A.Y, A.Z, A.W, A.U, A.V };
+    const uint64 AxesB[6] = { B.X, B.Y, B.Z, B.W, B.U, B.V };
+    for (int32 Axis = 0; Axis < 6; Axis++)
+    {
+        const double Delta = static_cast<double>(AxesA[Axis]) - static_cast<double>(AxesB[Axis]);
+        DistanceSquared += Delta * Delta;
+    }
+    const float Proximity = FMath::Exp2(-FMath::Sqrt(DistanceSquared) / ResonanceDistanceScale);
+
+    // Nearby orders resonate more readily than distant ones
+    const float OrderAffinity = 1.0f / (FMath::Abs(static_cast<int32>(A.LatticeOrder) - static_cast<int32>(B.LatticeOrder)) + 1.0f);
+
+    // Orders that have been resonating recently amplify it, saturating at double
+    const float Recent = 0.5f * (GetOrderResonance(A.LatticeOrder) + GetOrderResonance(B.LatticeOrder));
+    const float Amplification = 1.0f + Recent / (1.0f + Recent);
+
+    return FMath::Clamp(0.5f * Proximity * OrderAffinity * Amplification, 0.0f, 1.0f);
+}
+
+void UMythkeeperCodex6Component::TriggerResonancePattern_Implementation(const FHexademic6DCoordinate& Center, ECognitiveLatticeOrder Order, float Intensity)
+{
+    const double Now = GetNowSeconds();
+    OrderResonance.Add(static_cast<int32>(Order), Intensity, Now);
+    HEXADEMIC_COUNTER_ADD("Mythkeeper.ResonanceEvents", 1);
+
+    // Announce transcendence when the unified field's resonance first crosses the threshold, and re-arm once it falls back
+    const float Unified = GetOrderResonance(ECognitiveLatticeOrder::OrderInfinite);
+    if (!bTranscendent && Unified >= TranscendenceThreshold)
+    {
+        bTranscendent = true;
+        OnTranscendentExperience.Broadcast(Center);
+        UE_LOG(LogTemp, Log, TEXT("[MythkeeperCodex6] Transcendent experience: unified field resonance %.2f."), Unified);
+    }
+    else if (bTranscendent && Unified < TranscendenceThreshold * 0.5f)
+    {
+        bTranscendent = false;
+    }
+}
+
+ECognitiveLatticeOrder UMythkeeperCodex6Component::IdentifyDominantOrder_Implementation(const TArray<FHexademic6DCoordinate>& Coordinates) const
+{
+    if (Coordinates.Num() == 0)
+    {
+        return GetDominantOrder();
+    }
+
+    // Each coordinate votes for its order, weighted by how strongly that order is resonating
+    const double Now = GetNowSeconds();
+    float Votes[NumLatticeOrders] = {};
+    for (const FHexademic6DCoordinate& Coordinate : Coordinates)
+    {
+        const int32 Order = static_cast<int32>(Coordinate.LatticeOrder);
+        if (Order < NumLatticeOrders)
+        {
+            Votes[Order] += 1.0f + OrderResonance.GetSum(Order, Now);
+        }
+    }
+
+    int32 Dominant = static_cast<int32>(ECognitiveLatticeOrder::Order12);
+    for (int32 Order = 0; Order < NumLatticeOrders; Order++)
+    {
+        if (Votes[Order] > Votes[Dominant]) Dominant = Order;
+    }
+    return static_cast<ECognitiveLatticeOrder>(Dominant);
+}
+
+float UMythkeeperCodex6Component::GetOrderResonance(ECognitiveLatticeOrder Order) const
+{
+    return OrderResonance.GetSum(static_cast<int32>(Order), GetNowSeconds());
+}
+
+ECognitiveLatticeOrder UMythkeeperCodex6Component::GetDominantOrder() const
+{
+    const int32 Dominant = OrderResonance.GetDominantChannel(GetNowSeconds());
+    return Dominant != INDEX_NONE ? static_cast<ECognitiveLatticeOrder>(Dominant) : ECognitiveLatticeOrder::Order12;
+}
+
+//=============================================================================
+// MYTHIC SERVICE
+//=============================================================================
+
+void UMythkeeperCodex6Component::ProcessEmergentMythicPattern_Implementation(const TArray<FHexademicMemoryNode>& AssociatedMemories, float Coherence)
+{
+    CurrentCoherence = FMath::Clamp(Coherence, 0.0f, 1.0f);
+
+    // Memories arrive oldest first; each one is a single activation of the archetype its emotion falls in
+    const double Now = GetNowSeconds();
+    for (const FHexademicMemoryNode& Memory : AssociatedMemories)
+    {
+        const FEmotionalState& Emotion = Memory.EmotionalContext;
+        RecordArchetypeActivation(ClassifyArchetype(Emotion.Valence, Emotion.Arousal, Emotion.Intensity), FMath::Max(Emotion.Intensity, 0.1f), Now);
+    }
+}
+
+FString UMythkeeperCodex6Component::GenerateNarrativeThread_Implementation(const TArray<FHexademicMemoryNode>& CoreMemories, ECognitiveLatticeOrder Order) const
+{
+    // Prefer patterns that completed while Order was dominant; otherwise weave from everything seen. Either way only
+    // completed patterns with a composed narrative can contribute a thread
+    TArray<FHexademicMythicPatternSummary, TInlineAllocator<8>> InOrder;
+    TArray<FHexademicMythicPatternSummary, TInlineAllocator<8>> Completed;
+    for (const FHexademicMythicPatternSummary& Summary : PatternSummaries)
+    {
+        if (Summary.Occurrences <= 0 || Summary.Narrative.IsEmpty()) continue;
+        Completed.Add(Summary);
+        if (Summary.DominantOrder == Order) InOrder.Add(Summary);
+    }
+
+    FString Narrative = Hexademic6FractalUtils::GenerateNarrativeFromPatternSummaries(InOrder.Num() > 0 ? InOrder : Completed);
+    if (Narrative.IsEmpty())
+    {
+        Narrative = CoreMemories.Num() > 0
+            ? FString::Printf(TEXT("%d memories wait for a story to gather them."), CoreMemories.Num())
+            : TEXT("A subtle shift in the fabric of being.");
+    }
+    return Narrative;
+}
+
+void UMythkeeperCodex6Component::ActivateArchetype_Implementation(uint32 ArchetypeID, float ActivationLevel)
+{
+    RecordArchetypeActivation(ArchetypeID, ActivationLevel, GetNowSeconds());
+}
+
+void UMythkeeperCodex6Component::ActivateMythicPattern(const FHexademic6DCoordinate& Coordinate, float Intensity)
+{
+    const double Now = GetNowSeconds();
+    OrderResonance.Add(static_cast<int32>(Coordinate.LatticeOrder), Intensity, Now);
+
+    // U and V carry valence and arousal, as laid out by Hexademic6FractalUtils::StateToLatticeCoordinate
+    const float Valence = static_cast<float>(Coordinate.U / LatticeAxisRange) * 2.0f - 1.0f;
+    const float Arousal = static_cast<float>(Coordinate.V / LatticeAxisRange);
+    RecordArchetypeActivation(ClassifyArchetype(Valence, Arousal, (FMath::Abs(Valence) + Arousal) / 2.0f), Intensity, Now);
+}
+
+TArray<uint32> UMythkeeperCodex6Component::GetActiveArchetypalPatterns(const FHexademic6DCoordinate& Coordinate, float Coherence) const
+{
+    // Coordinate is part of the query contract; activation is already tracked per archetype rather than per place
+    const double Now = GetNowSeconds();
+    TArray<uint32> Active;
+    for (const TPair<uint32, FArchetypeTrace>& Trace : ArchetypeTraces)
+    {
+        if (GetArchetypeActivation(Trace.Key, Now) * Coherence >= ActiveArchetypeThreshold)
+        {
+            Active.Add(Trace.Key);
+        }
+    }
+    return Active;
+}
+
+TArray<FString> UMythkeeperCodex6Component::GetEmergentNarrativeThreads(float Threshold)
+{
+    TArray<FString> Narratives;
+    for (const FHexademicMythicPatternSummary& Summary : PendingSummaries)
+    {
+        if (Summary.Strength >= Threshold) Narratives.Add(Summary.Narrative);
+    }
+    PendingSummaries.Reset();
+    return Narratives;
+}
+
+//=============================================================================
+// STREAMING PATTERN MATCHER
+//=============================================================================
+
+float UMythkeeperCodex6Component::GetArchetypeActivation(uint32 ArchetypeID, double NowSeconds) const
+{
+    const FArchetypeTrace* Trace = ArchetypeTraces.Find(ArchetypeID);
+    if (!Trace) return 0.0f;
+    const double Elapsed = FMath::Max(NowSeconds - Trace->LastTime, 0.0);
+    return Trace->Activation * FMath::Exp2(static_cast<float>(-Elapsed / ArchetypeHalfLifeSeconds));
+}
+
+void UMythkeeperCodex6Component::RecordArchetypeActivation(uint32 ArchetypeID, float Activation, double NowSeconds)
+{
+    FArchetypeTrace& Trace = ArchetypeTraces.FindOrAdd(ArchetypeID);
+    Trace.Activation = GetArchetypeActivation(ArchetypeID, NowSeconds) + Activation;
+    Trace.LastTime = NowSeconds;
+    OnArchetypeActivation.Broadcast(ArchetypeID, Trace.Activation);
+
+    if (ArchetypeID != LastMatchedArchetype)
+    {
+        LastMatchedArchetype = ArchetypeID;
+        AdvancePatternMatches(ArchetypeID, Activation, NowSeconds);
+    }
+}
+
+void UMythkeeperCodex6Component::AdvancePatternMatches(uint32 ArchetypeID, float Activation, double NowSeconds)
+{
+    HEXADEMIC_COUNTER_ADD("Mythkeeper.MatcherEvents", 1);
+
+    // Expire matches that ran past their span, then advance those waiting for this archetype
+    for (int32 i = PartialMatches.Num() - 1; i >= 0; i--)
+    {
+        FPartialMatch& Match = PartialMatches[i];
+        const FMythicPatternDefinition& Pattern = PatternDefinitions[Match.PatternIndex];
+        if (NowSeconds - Match.StartTime > Pattern.MaxSpanSeconds)
+        {
+            PartialMatches.RemoveAtSwap(i);
+            continue;
+        }
+        if (Pattern.ArchetypeSequence[Match.NextStep] == ArchetypeID)
+        {
+            Match.NextStep++;
+            Match.ActivationSum += Activation;
+            if (Match.NextStep == Pattern.ArchetypeSequence.Num())
+            {
+                CompletePattern(Match, NowSeconds);
+                PartialMatches.RemoveAtSwap(i);
+            }
+        }
+    }
+
+    // Start new matches for the patterns this archetype opens
+    for (auto It = PatternsByFirstArchetype.CreateConstKeyIterator(ArchetypeID); It; ++It)
+    {
+        const int32 PatternIndex = It.Value();
+        FPartialMatch Started;
+        Started.PatternIndex = PatternIndex;
+        Started.NextStep = 1;
+        Started.StartTime = NowSeconds;
+        Started.ActivationSum = Activation;
+
+        if (PatternDefinitions[PatternIndex].ArchetypeSequence.Num() == 1)
+        {
+            CompletePattern(Started, NowSeconds);
+            continue;
+        }
+
+        // A match still waiting on its second step is superseded by the fresher opening
+        FPartialMatch* Waiting = PartialMatches.FindByPredicate([PatternIndex](const FPartialMatch& Match)
+        {
+            return Match.PatternIndex == PatternIndex && Match.NextStep == 1;
+        });
+        if (Waiting)
+        {
+            *Waiting = Started;
+        }
+        else if (PartialMatches.Num() < MaxPartialMatches)
+        {
+            PartialMatches.Add(Started);
+        }
+        else
+        {
+            HEXADEMIC_COUNTER_ADD("Mythkeeper.PartialMatchesDropped", 1);
+        }
+    }
+}
+
+void UMythkeeperCodex6Component::CompletePattern(const FPartialMatch& Match, double NowSeconds)
+{
+    const FMythicPatternDefinition& Pattern = PatternDefinitions[Match.PatternIndex];
+    FHexademicMythicPatternSummary& Summary = PatternSummaries[Match.PatternIndex];
+
+    Summary.PatternName = Pattern.PatternName;
+    Summary.DominantOrder = GetDominantOrder();
+    Summary.Strength = Match.ActivationSum / Pattern.ArchetypeSequence.Num() * CurrentCoherence;
+    Summary.SpanSeconds = static_cast<float>(NowSeconds - Match.StartTime);
+    Summary.Occurrences++;
+    Summary.CompletedAtSeconds = NowSeconds;
+
+    FStringFormatNamedArguments Arguments;
+    Arguments.Add(TEXT("Order"), StaticEnum<ECognitiveLatticeOrder>()->GetDisplayNameTextByValue(static_cast<int64>(Summary.DominantOrder)).ToString());
+    Arguments.Add(TEXT("Occurrences"), Summary.Occurrences);
+    Summary.Narrative = FString::Format(*Pattern.NarrativeTemplate, Arguments);
+
+    if (PendingSummaries.Num() >= MaxPendingSummaries)
+    {
+        PendingSummaries.RemoveAt(0);
+    }
+    PendingSummaries.Add(Summary);
+    HEXADEMIC_COUNTER_ADD("Mythkeeper.PatternsCompleted", 1);
+
+    UE_LOG(LogTemp, Log, TEXT("[MythkeeperCodex6] Pattern '%s' completed (strength %.2f, %.1fs): %s"),
+        *Pattern.PatternName.ToString(), Summary.Strength, Summary.SpanSeconds, *Summary.Narrative);
+    OnMythicEmergence.Broadcast(Summary.Narrative);
+}
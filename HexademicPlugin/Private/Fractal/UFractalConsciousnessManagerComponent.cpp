@@ -6,7 +6,7 @@
 // Include Hexademic⁶ components
 #include "HexademicSixLattice.h"        // For FHexademic6DCoordinate, ECognitiveLatticeOrder, FHexademicMemoryNode
 #include "HexademicSixCompute.h"        // For UHexademic6ComputeComponent (assuming this contains compute services)
-#include "MythkeeperCodex6Component.h"   // For UMythkeeperCodex6Component (mythic service)
+#include "Fractal/MythkeeperCodex6Component.h" // For UMythkeeperCodex6Component (mythic and resonance services)
 
 // Include existing component headers
 #include "Mind/EmotionCognitionComponent.h"
@@ -22,6 +22,17 @@
 #include "Living/IncrementalPersister.h"
 #include "Living/EnvironmentalResonator.h"
 #include "Body/ReflexResponseComponent.h"
+#include "Core/HexademicMetrics.h"
+#include "Subsystems/HexademicComponentRegistrySubsystem.h"
+#include "Subsystems/FractalComputeGovernorSubsystem.h"
+
+DECLARE_CYCLE_STAT(TEXT("Fractal Update"), STAT_Hexademic_FractalConsciousnessUpdate, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Fractal Temporal Layer"), STAT_Hexademic_FractalTemporalLayer, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Fractal Temporal Layer Integrate"), STAT_Hexademic_FractalTemporalLayerIntegrate, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Fractal Spatial Zones"), STAT_Hexademic_FractalSpatialZones, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Fractal Lattice Sync"), STAT_Hexademic_FractalLatticeSync, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Fractal Lattice Evolution"), STAT_Hexademic_FractalLatticeEvolution, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("Fractal Mythic Patterns"), STAT_Hexademic_FractalMythicPatterns, STATGROUP_Hexademic);
 
 
 //=============================================================================
@@ -51,13 +62,13 @@ void FTemporalFractalLayer::UpdateLatticeMapping(const FUnifiedConsciousnessStat
         (int32)MappedLatticeOrder, *LayerCenterCoordinate.ToString());
 }
 
-void FTemporalFractalLayer::PropagateToLattice(IHexademic6CognitiveLatticeService& LatticeService)
+void FTemporalFractalLayer::PropagateToLattice(IHexademic6CognitiveLatticeService& LatticeService, FHexademicLatticeNodePool& NodePool)
 {
     // Propagate this layer's state and active memory nodes into the 6D cognitive lattice.
-    // This involves interacting with the LatticeService to add/update nodes.
+    // The state goes through the node pool: a state close to the one written last time is merged into that
+    // node, and only a genuinely new state costs a node.
 
     FHexademicMemoryNode NewNode;
-    NewNode.NodeID = FGuid::NewGuid(); // Generate a new ID for the propagated node
     NewNode.Coordinate = LayerCenterCoordinate;
     NewNode.EmotionalSignature.Valence = LayerState.CurrentEmotionalState.Valence;
     NewNode.EmotionalSignature.Arousal = LayerState.CurrentEmotionalState.Arousal;
@@ -65,8 +76,11 @@ void FTemporalFractalLayer::PropagateToLattice(IHexademic6CognitiveLatticeServic
     NewNode.Coherence = LayerState.CoherenceMetric; // Use layer's coherence
     NewNode.MemoryTag = FString::Printf(TEXT("TemporalLayer_%d_State"), (int33)MappedLatticeOrder); // Example tag
 
-    LatticeService.AddMemoryNode(NewNode); // Add or update this node in the lattice
-    UE_LOG(LogTemp, VeryVerbose, TEXT("FTemporalFractalLayer: Propagated to Lattice: %s"), *NewNode.MemoryTag);
+    bool bMerged = false;
+    LatticeStateNode = NodePool.Write(LatticeStateNode, NewNode, bMerged);
+    // A merge moved the node's running mean, so the lattice copy is refreshed either way; same NodeID, no new node
+    LatticeService.AddMemoryNode(*NodePool.Get(LatticeStateNode)); // Add or update this node in the lattice
+    UE_LOG(LogTemp, VeryVerbose, TEXT("FTemporalFractalLayer: %s to Lattice: %s"), bMerged ? TEXT("Merged") : TEXT("Propagated"), *NewNode.MemoryTag);
 
     // Propagate active memory nodes (FGuids) from this layer into the lattice if they aren't already there.
     // This is conceptual, as FHexademicMemoryNode needs a FGuid for NodeID.
@@ -106,6 +120,10 @@ void FTemporalFractalLayer::IntegrateFromLattice(const TArray<FHexademicMemoryNo
         // Add the memory node's ID to ActiveMemoryNodes if it's new to this layer
         if (!ActiveMemoryNodes.Contains(MemNode.NodeID))
         {
+            if (ActiveMemoryNodes.Num() >= MaxActiveMemoryNodes)
+            {
+                ActiveMemoryNodes.Reset(); // Roll over rather than grow for the whole session
+            }
             ActiveMemoryNodes.Add(MemNode.NodeID);
         }
     }
@@ -127,6 +145,134 @@ void FTemporalFractalLayer::IntegrateFromLattice(const TArray<FHexademicMemoryNo
 }
 
 
+//=============================================================================
+// FHexademicLatticeNodePool Implementation
+//=============================================================================
+
+void FHexademicLatticeNodePool::SetCapacity(int32 InCapacity)
+{
+    Capacity = FMath::Max(InCapacity, 1);
+    Reset();
+}
+
+void FHexademicLatticeNodePool::Reset()
+{
+    Slots.Reset();
+    Slots.Reserve(Capacity);
+    FreeSlots.Reset();
+    NumLive = 0;
+    WriteSerial = 0;
+    NumWrites = 0;
+    NumMerges = 0;
+    PoolGuid = FGuid::NewGuid();
+}
+
+FHexademicLatticeNodeHandle FHexademicLatticeNodePool::Write(FHexademicLatticeNodeHandle Previous, const FHexademicMemoryNode& Candidate, bool& bOutMerged)
+{
+    NumWrites++;
+    WriteSerial++;
+
+    if (Get(Previous) && IsWithinTolerance(Slots[Previous.Index].Node, Candidate))
+    {
+        // Fold into the existing node as a running mean, so it stays representative of every state merged into it
+        FSlot& Slot = Slots[Previous.Index];
+        Slot.MergeCount++;
+        const float Alpha = 1.0f / (Slot.MergeCount + 1);
+        Slot.Node.EmotionalSignature.Valence = FMath::Lerp(Slot.Node.EmotionalSignature.Valence, Candidate.EmotionalSignature.Valence, Alpha);
+        Slot.Node.EmotionalSignature.Arousal = FMath::Lerp(Slot.Node.EmotionalSignature.Arousal, Candidate.EmotionalSignature.Arousal, Alpha);
+        Slot.Node.EmotionalSignature.Intensity = FMath::Lerp(Slot.Node.EmotionalSignature.Intensity, Candidate.EmotionalSignature.Intensity, Alpha);
+        Slot.Node.Coherence = FMath::Lerp(Slot.Node.Coherence, Candidate.Coherence, Alpha);
+        Slot.LastWriteSerial = WriteSerial;
+
+        NumMerges++;
+        bOutMerged = true;
+        HEXADEMIC_COUNTER_ADD("Fractal.LatticeNodeMerges", 1);
+        return Previous;
+    }
+
+    const int32 Index = AllocateSlot();
+    FSlot& Slot = Slots[Index];
+    const FGuid NodeID = Slot.Node.NodeID;
+    Slot.Node = Candidate;
+    Slot.Node.NodeID = NodeID;
+    Slot.MergeCount = 0;
+    Slot.LastWriteSerial = WriteSerial;
+
+    bOutMerged = false;
+    HEXADEMIC_COUNTER_ADD("Fractal.LatticeNodeWrites", 1);
+    return FHexademicLatticeNodeHandle{ Index, Slot.Generation };
+}
+
+const FHexademicMemoryNode* FHexademicLatticeNodePool::Get(FHexademicLatticeNodeHandle Handle) const
+{
+    if (!Slots.IsValidIndex(Handle.Index)) return nullptr;
+    const FSlot& Slot = Slots[Handle.Index];
+    return (Slot.bLive && Slot.Generation == Handle.Generation) ? &Slot.Node : nullptr;
+}
+
+void FHexademicLatticeNodePool::Release(FHexademicLatticeNodeHandle Handle)
+{
+    if (!Get(Handle)) return;
+    FSlot& Slot = Slots[Handle.Index];
+    Slot.bLive = false;
+    Slot.Generation++;
+    FreeSlots.Add(Handle.Index);
+    NumLive--;
+}
+
+bool FHexademicLatticeNodePool::IsWithinTolerance(const FHexademicMemoryNode& Existing, const FHexademicMemoryNode& Candidate) const
+{
+    const FHexademic6DCoordinate& A = Existing.Coordinate;
+    const FHexademic6DCoordinate& B = Candidate.Coordinate;
+    auto AxisDelta = [](uint64 X, uint64 Y) { return X > Y ? X - Y : Y - X; };
+
+    return A.LatticeOrder == B.LatticeOrder
+        && AxisDelta(A.X, B.X) <= MergeTolerance.MaxCoordinateDelta
+        && AxisDelta(A.Y, B.Y) <= MergeTolerance.MaxCoordinateDelta
+        && AxisDelta(A.Z, B.Z) <= MergeTolerance.MaxCoordinateDelta
+        && AxisDelta(A.W, B.W) <= MergeTolerance.MaxCoordinateDelta
+        && AxisDelta(A.U, B.U) <= MergeTolerance.MaxCoordinateDelta
+        && AxisDelta(A.V, B.V) <= MergeTolerance.MaxCoordinateDelta
+        && FMath::Abs(Existing.EmotionalSignature.Valence - Candidate.EmotionalSignature.Valence) <= MergeTolerance.MaxEmotionDelta
+        && FMath::Abs(Existing.EmotionalSignature.Arousal - Candidate.EmotionalSignature.Arousal) <= MergeTolerance.MaxEmotionDelta
+        && FMath::Abs(Existing.EmotionalSignature.Intensity - Candidate.EmotionalSignature.Intensity) <= MergeTolerance.MaxEmotionDelta
+        && FMath::Abs(Existing.Coherence - Candidate.Coherence) <= MergeTolerance.MaxCoherenceDelta;
+}
+
+int32 FHexademicLatticeNodePool::AllocateSlot()
+{
+    int32 Index = INDEX_NONE;
+    if (FreeSlots.Num() > 0)
+    {
+        Index = FreeSlots.Pop();
+    }
+    else if (Slots.Num() < Capacity)
+    {
+        Index = Slots.AddDefaulted();
+        // Minted once per slot; the default node constructor's own NewGuid is overwritten here and never again
+        Slots[Index].Node.NodeID = FGuid(PoolGuid.A, PoolGuid.B, PoolGuid.C, PoolGuid.D ^ static_cast<uint32>(Index));
+    }
+    else
+    {
+        // Full: recycle the least recently written node. Its generation moves on, so old handles to it go stale.
+        Index = 0;
+        for (int32 i = 1; i < Slots.Num(); i++)
+        {
+            if (Slots[i].LastWriteSerial < Slots[Index].LastWriteSerial)
+            {
+                Index = i;
+            }
+        }
+        Slots[Index].Generation++;
+        NumLive--;
+    }
+
+    Slots[Index].bLive = true;
+    NumLive++;
+    return Index;
+}
+
+
 //=============================================================================
 // FRecursiveEmbodimentZone Implementation
 //=============================================================================
@@ -163,6 +309,116 @@ void FRecursiveEmbodimentZone::TriggerMythicActivation(IHexademic6MythicService&
 }
 
 
+//=============================================================================
+// FFlatEmbodimentZoneTree Implementation
+//=============================================================================
+
+void FFlatEmbodimentZoneTree::Reset()
+{
+    Parent.Reset();
+    FirstChild.Reset();
+    NumChildren.Reset();
+    LevelStart.Reset();
+    ZoneName.Reset();
+    LatticePosition.Reset();
+    SensitivityAmplification.Reset();
+    EffectiveSensitivity.Reset();
+    MythicDepth.Reset();
+    SubtreeMythicDepth.Reset();
+    ArchetypeStart.Reset();
+    ArchetypeCount.Reset();
+    Archetypes.Reset();
+    MaxDepth = INDEX_NONE;
+    SourceHash = 0;
+}
+
+void FFlatEmbodimentZoneTree::Build(const FRecursiveEmbodimentZone& Root, int32 InMaxDepth)
+{
+    Reset();
+    MaxDepth = InMaxDepth;
+    SourceHash = ComputeSourceHash(Root, InMaxDepth);
+
+    // Breadth-first: a zone's children are all appended when the zone is visited, so siblings are contiguous
+    // and every level is one index range
+    TArray<const FRecursiveEmbodimentZone*> Sources;
+    TArray<int32> Depths;
+    Sources.Add(&Root);
+    Depths.Add(0);
+    Parent.Add(INDEX_NONE);
+    for (int32 i = 0; i < Sources.Num(); i++)
+    {
+        const FRecursiveEmbodimentZone& Zone = *Sources[i];
+        const int32 ChildCount = Depths[i] < MaxDepth ? Zone.SubZones.Num() : 0;
+        FirstChild.Add(Sources.Num());
+        NumChildren.Add(ChildCount);
+        for (int32 c = 0; c < ChildCount; c++)
+        {
+            Sources.Add(&Zone.SubZones[c]);
+            Depths.Add(Depths[i] + 1);
+            Parent.Add(i);
+        }
+
+        ZoneName.Add(Zone.ZoneName);
+        LatticePosition.Add(Zone.LatticePosition);
+        SensitivityAmplification.Add(Zone.SensitivityAmplification);
+    }
+
+    for (int32 i = 0; i < Depths.Num(); i++)
+    {
+        while (LevelStart.Num() <= Depths[i])
+        {
+            LevelStart.Add(i);
+        }
+    }
+    LevelStart.Add(Depths.Num());
+
+    const int32 NumZones = Sources.Num();
+    EffectiveSensitivity.SetNumZeroed(NumZones);
+    MythicDepth.SetNumZeroed(NumZones);
+    SubtreeMythicDepth.SetNumZeroed(NumZones);
+    ArchetypeStart.SetNumZeroed(NumZones);
+    ArchetypeCount.SetNumZeroed(NumZones);
+
+    // Start from whatever the authored zones carry, until the first lattice update replaces it
+    for (int32 i = 0; i < NumZones; i++)
+    {
+        MythicDepth[i] = Sources[i]->MythicDepth;
+        ArchetypeStart[i] = Archetypes.Num();
+        ArchetypeCount[i] = Sources[i]->ResonantArchetypes.Num();
+        Archetypes.Append(Sources[i]->ResonantArchetypes);
+    }
+}
+
+uint32 FFlatEmbodimentZoneTree::ComputeSourceHash(const FRecursiveEmbodimentZone& Root, int32 MaxDepth)
+{
+    uint32 Hash = GetTypeHash(MaxDepth);
+    TArray<TPair<const FRecursiveEmbodimentZone*, int32>, TInlineAllocator<32>> Stack;
+    Stack.Emplace(&Root, 0);
+    while (Stack.Num() > 0)
+    {
+        const TPair<const FRecursiveEmbodimentZone*, int32> Entry = Stack.Pop();
+        const FRecursiveEmbodimentZone& Zone = *Entry.Key;
+        Hash = HashCombine(Hash, GetTypeHash(Zone.ZoneName));
+        Hash = HashCombine(Hash, GetTypeHash(Zone.LatticePosition));
+        Hash = HashCombine(Hash, GetTypeHash(Zone.SensitivityAmplification));
+        Hash = HashCombine(Hash, GetTypeHash(Zone.SubZones.Num()));
+        if (Entry.Value < MaxDepth)
+        {
+            for (const FRecursiveEmbodimentZone& SubZone : Zone.SubZones)
+            {
+                Stack.Emplace(&SubZone, Entry.Value + 1);
+            }
+        }
+    }
+    return Hash;
+}
+
+int32 FFlatEmbodimentZoneTree::FindZone(const FString& Name) const
+{
+    return ZoneName.IndexOfByKey(Name);
+}
+
+
 //=============================================================================
 // FFractalMemoryConstellation Implementation
 //=============================================================================
@@ -236,6 +492,8 @@ UFractalConsciousnessManagerComponent::UFractalConsciousnessManagerComponent()
     // Initialize fractal configuration
     MaxTemporalScales = 5;
     MaxSpatialRecursionDepth = 3;
+    LayerUpdatesPerTimeScale = 10.0f;
+    LatticeNodePoolCapacity = 64;
     
     // Initialize 6D consciousness position
     CurrentConsciousnessPosition = FHexademic6DCoordinate();
@@ -253,6 +511,16 @@ void UFractalConsciousnessManagerComponent::BeginPlay()
     Super::BeginPlay();
     
     InitializeFractalLayers();
+    ConsciousnessTrajectory.Configure(TrajectoryFramesPerKeyframe, TrajectoryKeyframes);
+    ConsciousnessTrajectory.SetChannelDownsampling(6, EHexademicHistoryDownsampling::Last); // LatticeOrder is an enum
+    FractalClockSeconds = 0.0;
+    ConfigureTemporalLayerScheduler();
+    ComputeGovernor = UFractalComputeGovernorSubsystem::GetFor(this);
+    LatticeNodePool.SetCapacity(LatticeNodePoolCapacity);
+    for (FTemporalFractalLayer& Layer : TemporalFractalLayers)
+    {
+        Layer.LatticeStateNode.Reset();
+    }
     
     // Initialize Hexademic⁶ lattice integration
     if (bEnableLatticeIntegration)
@@ -266,13 +534,27 @@ void UFractalConsciousnessManagerComponent::BeginPlay()
 void UFractalConsciousnessManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     UE_LOG(LogTemp, Log, TEXT("[FractalConsciousness⁶] Fractal consciousness manager shutting down"));
+    if (MythkeeperCodex)
+    {
+        MythkeeperCodex->OnMythicEmergence.RemoveAll(this);
+        MythkeeperCodex->OnArchetypeActivation.RemoveAll(this);
+        MythkeeperCodex->OnTranscendentExperience.RemoveAll(this);
+    }
+    if (UFractalComputeGovernorSubsystem* Governor = ComputeGovernor.Get())
+    {
+        Governor->ForgetAgent(this);
+    }
     Super::EndPlay(EndPlayReason);
 }
 
 void UFractalConsciousnessManagerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-    
+    AdvanceFractalTime(DeltaTime);
+}
+
+void UFractalConsciousnessManagerComponent::AdvanceFractalTime(float DeltaTime)
+{
     // Allocate processing resources for adaptive scaling
     AllocateProcessingResources(DeltaTime);
     
@@ -280,9 +562,21 @@ void UFractalConsciousnessManagerComponent::TickComponent(float DeltaTime, ELeve
     AccumulatedLatticeTime += DeltaTime;
     if (bEnableLatticeIntegration && AccumulatedLatticeTime >= (1.0f / LatticeUpdateFrequency))
     {
-        SynchronizeWithHexademic6Lattice(AccumulatedLatticeTime);
-        AccumulatedLatticeTime = 0.0f;
-        LatticeUpdateCounter++;
+        // A deferred sync keeps its accumulated time and asks again next frame
+        FFractalComputeScope Budget(ProcessingManager.bAdaptiveScaling ? ComputeGovernor.Get() : nullptr, this, EFractalComputeStage::LatticeSync, ProcessingManager.AgentImportance);
+        if (Budget.IsDegraded())
+        {
+            ProcessLatticeMemoryMigration(); // Skip the compute dispatch and cross-order resonance
+        }
+        else if (Budget.ShouldRun())
+        {
+            SynchronizeWithHexademic6Lattice(AccumulatedLatticeTime);
+        }
+        if (Budget.ShouldRun())
+        {
+            AccumulatedLatticeTime = 0.0f;
+            LatticeUpdateCounter++;
+        }
     }
 
     // Process mythic emergence (can be continuous or event-driven)
@@ -294,6 +588,17 @@ void UFractalConsciousnessManagerComponent::TickComponent(float DeltaTime, ELeve
     // FractalConsciousnessUpdate(DeltaTime, CurrentUnifiedState); // Requires CurrentUnifiedState as a member or passed
 }
 
+void UFractalConsciousnessManagerComponent::AllocateProcessingResources(float DeltaTime)
+{
+    // Report what this agent actually cost last frame, as a share of the world's fractal frame budget
+    const UFractalComputeGovernorSubsystem* Governor = ComputeGovernor.Get();
+    if (Governor && Governor->GetFrameBudgetMs() > 0.0f)
+    {
+        const double AgentMs = Governor->GetAgentLastFrameMicros(this) / 1000.0;
+        ProcessingManager.CurrentProcessingLoad = static_cast<float>(100.0 * AgentMs / Governor->GetFrameBudgetMs());
+    }
+}
+
 void UFractalConsciousnessManagerComponent::InitializeFractalLayers()
 {
     SetupDefaultTemporalLayers();
@@ -316,12 +621,12 @@ void UFractalConsciousnessManagerComponent::InitializeLatticeIntegration()
     // Auto-discover these if not set in editor
     if (!LatticeComputeComponent)
     {
-        LatticeComputeComponent = GetOwner()->FindComponentByClass<UHexademic6ComputeComponent>();
+        LatticeComputeComponent = UHexademicComponentRegistrySubsystem::FindComponent<UHexademic6ComputeComponent>(GetOwner());
         if (!LatticeComputeComponent) UE_LOG(LogTemp, Warning, TEXT("[FractalConsciousness⁶] LatticeComputeComponent not found."));
     }
     if (!MythkeeperCodex)
     {
-        MythkeeperCodex = GetOwner()->FindComponentByClass<UMythkeeperCodex6Component>();
+        MythkeeperCodex = UHexademicComponentRegistrySubsystem::FindComponent<UMythkeeperCodex6Component>(GetOwner());
         if (!MythkeeperCodex) UE_LOG(LogTemp, Warning, TEXT("[FractalConsciousness⁶] MythkeeperCodex6Component not found."));
     }
 
@@ -344,19 +649,12 @@ void UFractalConsciousnessManagerComponent::InitializeLatticeIntegration()
     CurrentConsciousnessPosition.V = 0; // Start with no mythic depth
     CurrentConsciousnessPosition.LatticeOrder = ECognitiveLatticeOrder::Order12;
     
-    // Initialize order resonance history
-    OrderResonanceHistory.Empty();
-    for (int32 i = 0; i <= (int32)ECognitiveLatticeOrder::OrderInfinite; i++)
-    {
-        OrderResonanceHistory.Add((ECognitiveLatticeOrder)i, 0.0f);
-    }
-    
-    // Bind to mythic events if MythkeeperCodex is available
+    // Bind to mythic events if MythkeeperCodex is available; it also keeps the per-order resonance
     if (MythkeeperCodex)
     {
-        // MythkeeperCodex->OnMythicEmergence.AddDynamic(this, &UFractalConsciousnessManagerComponent::HandleMythicEmergence); // These need to be defined as UFUNCTIONs
-        // MythkeeperCodex->OnArchetypeActivation.AddDynamic(this, &UFractalConsciousnessManagerComponent::HandleArchetypeActivation);
-        // MythkeeperCodex->OnTranscendentExperience.AddDynamic(this, &UFractalConsciousnessManagerComponent::HandleTranscendentExperience);
+        MythkeeperCodex->OnMythicEmergence.AddDynamic(this, &UFractalConsciousnessManagerComponent::HandleMythicEmergence);
+        MythkeeperCodex->OnArchetypeActivation.AddDynamic(this, &UFractalConsciousnessManagerComponent::HandleArchetypeActivation);
+        MythkeeperCodex->OnTranscendentExperience.AddDynamic(this, &UFractalConsciousnessManagerComponent::HandleTranscendentExperience);
     }
     
     UE_LOG(LogTemp, Log, TEXT("[FractalConsciousness⁶] Hexademic⁶ lattice integration initialized successfully"));
@@ -394,26 +692,28 @@ void UFractalConsciousnessManagerComponent::MapFractalScalesToLatticeOrders()
 void UFractalConsciousnessManagerComponent::FractalConsciousnessUpdate(float DeltaTime, FUnifiedConsciousnessState& CurrentUnifiedState)
 {
     // === ENHANCED FRACTAL CONSCIOUSNESS ORCHESTRATION WITH HEXADEMIC⁶ INTEGRATION ===
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_FractalConsciousnessUpdate, "Fractal.ConsciousnessUpdate");
     
     UE_LOG(LogTemp, VeryVerbose, TEXT("[FractalConsciousness⁶] Beginning enhanced fractal consciousness update with %d temporal scales"), 
         TemporalFractalLayers.Num());
 
     // Update consciousness position in 6D lattice space
+    FractalClockSeconds += DeltaTime;
     UpdateConsciousnessPosition6D(CurrentUnifiedState);
 
-    // Process all temporal scales, now with lattice awareness
-    for (int32 ScaleLevel = 0; ScaleLevel < TemporalFractalLayers.Num(); ScaleLevel++)
+    // Process the temporal scales that are due on this update, now with lattice awareness
+    UpdateDueTemporalLayers(CurrentUnifiedState);
+    
+    // Process spatial embodiment zones with lattice awareness, as linear sweeps over the flattened zone tree
     {
-        float ScaleWeight = ProcessingManager.ScaleImportanceWeights.FindRef(ScaleLevel);
-        if (ScaleWeight < 0.1f) continue; // Skip scales with very low importance
-        
-        // Use the lattice-integrated update function
-        UpdateFractalTemporalLayerWithLattice(ScaleLevel, DeltaTime, CurrentUnifiedState);
+        HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_FractalSpatialZones, "Fractal.SpatialZones");
+        FFractalComputeScope Budget(ProcessingManager.bAdaptiveScaling ? ComputeGovernor.Get() : nullptr, this, EFractalComputeStage::SpatialZones, ProcessingManager.AgentImportance);
+        if (Budget.ShouldRun())
+        {
+            UpdateEmbodimentZonesWithLattice(DeltaTime, !Budget.IsDegraded());
+        }
     }
     
-    // Process spatial embodiment zones recursively with lattice awareness
-    UpdateFractalSpatialZoneWithLattice(RootEmbodimentZone, 0, DeltaTime);
-    
     // Synchronize fractal scales and cross-scale resonance
     SynchronizeFractalScales(CurrentUnifiedState);
     
@@ -421,8 +721,17 @@ void UFractalConsciousnessManagerComponent::FractalConsciousnessUpdate(float Del
     EvolveConsciousnessInLatticeSpace(DeltaTime);
 
     // Process emergent mythic patterns
-    ProcessEmergentMythicPatterns();
-    IntegrateNarrativeThreadsWithFractals();
+    {
+        FFractalComputeScope Budget(ProcessingManager.bAdaptiveScaling ? ComputeGovernor.Get() : nullptr, this, EFractalComputeStage::MythicPatterns, ProcessingManager.AgentImportance);
+        if (Budget.ShouldRun())
+        {
+            ProcessEmergentMythicPatterns();
+            if (!Budget.IsDegraded())
+            {
+                IntegrateNarrativeThreadsWithFractals();
+            }
+        }
+    }
 
     // Update global lattice coherence
     // This relies on the LatticeComputeComponent to provide global lattice state
@@ -441,6 +750,7 @@ void UFractalConsciousnessManagerComponent::FractalConsciousnessUpdate(float Del
 void UFractalConsciousnessManagerComponent::SynchronizeWithHexademic6Lattice(float DeltaTime)
 {
     if (!AreHexademic6ServicesAvailable()) return;
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_FractalLatticeSync, "Fractal.LatticeSync");
 
     // Dispatch compute shaders for lattice processing (e.g., from UHexademic6ComputeComponent)
     DispatchLatticeComputeShaders();
@@ -490,17 +800,48 @@ void UFractalConsciousnessManagerComponent::UpdateConsciousnessPosition6D(const
     // and incrementally moving towards it.
     CurrentConsciousnessPosition = OptimalPosition; // Direct assignment for simplicity
 
-    // Add current position to trajectory
-    ConsciousnessTrajectory.Add(CurrentConsciousnessPosition);
-    if (ConsciousnessTrajectory.Num() > 100) // Limit trajectory history
+    // Add current position to trajectory (fixed-capacity ring, oldest keyframe segment recycled when full)
+    const uint64 TrajectoryPoint[7] =
     {
-        ConsciousnessTrajectory.RemoveAt(0);
-    }
+        CurrentConsciousnessPosition.X, CurrentConsciousnessPosition.Y, CurrentConsciousnessPosition.Z,
+        CurrentConsciousnessPosition.W, CurrentConsciousnessPosition.U, CurrentConsciousnessPosition.V,
+        static_cast<uint64>(CurrentConsciousnessPosition.LatticeOrder)
+    };
+    ConsciousnessTrajectory.Add(FractalClockSeconds, TrajectoryPoint);
 
     UE_LOG(LogTemp, VeryVerbose, TEXT("[FractalConsciousness⁶] Updated 6D Consciousness Position to %s (Order: %d)."),
         *CurrentConsciousnessPosition.ToString(), (int32)CurrentConsciousnessPosition.LatticeOrder);
 }
 
+TArray<FHexademic6DCoordinate> UFractalConsciousnessManagerComponent::GetConsciousnessTrajectory(float WindowSeconds, int32 MaxPoints) const
+{
+    TArray<FTrajectoryHistory::FFrame> Frames;
+    const double StartTime = FractalClockSeconds - WindowSeconds;
+    if (MaxPoints > 0)
+    {
+        ConsciousnessTrajectory.QueryDownsampled(StartTime, FractalClockSeconds, MaxPoints, Frames);
+    }
+    else
+    {
+        ConsciousnessTrajectory.QueryRange(StartTime, FractalClockSeconds, Frames);
+    }
+
+    TArray<FHexademic6DCoordinate> Trajectory;
+    Trajectory.Reserve(Frames.Num());
+    for (const FTrajectoryHistory::FFrame& Frame : Frames)
+    {
+        FHexademic6DCoordinate& Point = Trajectory.AddDefaulted_GetRef();
+        Point.X = Frame.Values[0];
+        Point.Y = Frame.Values[1];
+        Point.Z = Frame.Values[2];
+        Point.W = Frame.Values[3];
+        Point.U = Frame.Values[4];
+        Point.V = Frame.Values[5];
+        Point.LatticeOrder = static_cast<ECognitiveLatticeOrder>(Frame.Values[6]);
+    }
+    return Trajectory;
+}
+
 void UFractalConsciousnessManagerComponent::TriggerFractalTranscendence(const FHexademic6DCoordinate& TriggerPoint)
 {
     // Check for transcendence conditions
@@ -594,8 +935,11 @@ void UFractalConsciousnessManagerComponent::ProcessCrossOrderResonance()
         ECognitiveLatticeOrder::Order144
     );
 
-    // Update OrderResonanceHistory
-    OrderResonanceHistory.FindOrAdd(ECognitiveLatticeOrder::Order144) = Resonance; // Store resonance for Order144
+    // Fold into the codex's decayed per-order resonance rather than overwriting a snapshot
+    if (MythkeeperCodex)
+    {
+        IHexademic6ResonanceService::Execute_TriggerResonancePattern(MythkeeperCodex, CurrentConsciousnessPosition, ECognitiveLatticeOrder::Order144, Resonance);
+    }
 
     UE_LOG(LogTemp, VeryVerbose, TEXT("[FractalConsciousness⁶] Cross-Order Resonance (12-144): %.2f"), Resonance);
 }
@@ -603,6 +947,7 @@ void UFractalConsciousnessManagerComponent::ProcessCrossOrderResonance()
 void UFractalConsciousnessManagerComponent::EvolveConsciousnessInLatticeSpace(float DeltaTime)
 {
     if (!LatticeComputeComponent) return;
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_FractalLatticeEvolution, "Fractal.LatticeEvolution");
 
     // This function evolves the entire consciousness within the 6D lattice space,
     // reflecting learning, growth, and integration.
@@ -631,12 +976,108 @@ void UFractalConsciousnessManagerComponent::EvolveConsciousnessInLatticeSpace(fl
     // OnFractalConsciousnessEvolution.Broadcast(GlobalLatticeCoherence);
 }
 
-void UFractalConsciousnessManagerComponent::UpdateFractalTemporalLayerWithLattice(int32 ScaleLevel, float DeltaTime, FUnifiedConsciousnessState& CurrentUnifiedState)
+void UFractalConsciousnessManagerComponent::ConfigureTemporalLayerScheduler()
+{
+    // Each scale runs at its own cadence: a few updates per unit of its time scale, capped by its UpdateFrequency
+    TArray<float, TInlineAllocator<8>> Frequencies;
+    for (const FTemporalFractalLayer& Layer : TemporalFractalLayers)
+    {
+        float Frequency = Layer.UpdateFrequency;
+        if (Layer.TimeScale > 0.0f)
+        {
+            Frequency = FMath::Min(Frequency, LayerUpdatesPerTimeScale / Layer.TimeScale);
+        }
+        Frequencies.Add(Frequency);
+    }
+
+    const uint32 StaggerSeed = GetOwner() ? GetOwner()->GetUniqueID() : GetUniqueID();
+    TemporalLayerScheduler.Configure(Frequencies, StaggerSeed, FractalClockSeconds);
+    LayerLatticeMemoryCache.Reset();
+    LayerLatticeMemoryCache.SetNum(TemporalFractalLayers.Num());
+
+    for (int32 i = 0; i < TemporalFractalLayers.Num(); i++)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("[FractalConsciousness⁶] Temporal layer %d scheduled every %.3fs"), i, TemporalLayerScheduler.GetPeriod(i));
+    }
+}
+
+void UFractalConsciousnessManagerComponent::UpdateDueTemporalLayers(FUnifiedConsciousnessState& CurrentUnifiedState)
+{
+    if (TemporalLayerScheduler.Num() != TemporalFractalLayers.Num())
+    {
+        ConfigureTemporalLayerScheduler();
+    }
+
+    if (FractalClockSeconds < TemporalLayerScheduler.GetNextDueTime())
+    {
+        return; // Nothing due: slow layers cost nothing between their runs
+    }
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_FractalTemporalLayer, "Fractal.TemporalLayer");
+
+    // Deferred layers are not collected, so they stay due and run on a later frame
+    FFractalComputeScope Budget(ProcessingManager.bAdaptiveScaling ? ComputeGovernor.Get() : nullptr, this, EFractalComputeStage::TemporalLayers, ProcessingManager.AgentImportance);
+    if (!Budget.ShouldRun())
+    {
+        return;
+    }
+
+    DueTemporalLayers.Reset();
+    TemporalLayerScheduler.CollectDueLayers(FractalClockSeconds, DueTemporalLayers);
+
+    // Skipped layers are re-armed for their next slot; their elapsed time carries over to the run after it
+    const auto SkipLayer = [this](const FHexademicTemporalLayerScheduler::FDueLayer& Due)
+    {
+        TemporalLayerScheduler.CommitLayer(Due.LayerIndex, FractalClockSeconds, false);
+        return true;
+    };
+
+    // Skip scales with very low importance
+    DueTemporalLayers.RemoveAll([this, &SkipLayer](const FHexademicTemporalLayerScheduler::FDueLayer& Due)
+    {
+        return ProcessingManager.ScaleImportanceWeights.FindRef(Due.LayerIndex) < 0.1f && SkipLayer(Due);
+    });
+
+    // Over budget: slow layers miss this run, and only the fastest due layer refreshes from the lattice
+    if (Budget.IsDegraded())
+    {
+        DueTemporalLayers.RemoveAll([this, &SkipLayer](const FHexademicTemporalLayerScheduler::FDueLayer& Due)
+        {
+            return TemporalLayerScheduler.GetPeriod(Due.LayerIndex) >= DegradedSlowLayerPeriod && SkipLayer(Due);
+        });
+        // Collection order is layer order, not period order: move the fastest layer to the front explicitly
+        int32 FastestIndex = INDEX_NONE;
+        for (int32 i = 0; i < DueTemporalLayers.Num(); i++)
+        {
+            if (FastestIndex == INDEX_NONE || TemporalLayerScheduler.GetPeriod(DueTemporalLayers[i].LayerIndex) < TemporalLayerScheduler.GetPeriod(DueTemporalLayers[FastestIndex].LayerIndex))
+            {
+                FastestIndex = i;
+            }
+        }
+        if (FastestIndex > 0)
+        {
+            DueTemporalLayers.Swap(0, FastestIndex);
+        }
+    }
+    HEXADEMIC_COUNTER_ADD("Fractal.TemporalLayerRuns", DueTemporalLayers.Num());
+
+    // Lattice exchange first, serially: every layer propagates into and queries the same lattice
+    const int32 NumExchanges = Budget.IsDegraded() ? FMath::Min(DueTemporalLayers.Num(), 1) : DueTemporalLayers.Num();
+    for (int32 i = 0; i < NumExchanges; i++)
+    {
+        ExchangeTemporalLayerWithLattice(DueTemporalLayers[i].LayerIndex, CurrentUnifiedState);
+    }
+
+    for (const FHexademicTemporalLayerScheduler::FDueLayer& Due : DueTemporalLayers)
+    {
+        IntegrateTemporalLayer(Due.LayerIndex);
+        TemporalLayerScheduler.CommitLayer(Due.LayerIndex, FractalClockSeconds, true);
+        LogFractalLayerState(Due.LayerIndex, TemporalFractalLayers[Due.LayerIndex].LayerState);
+    }
+}
+
+void UFractalConsciousnessManagerComponent::ExchangeTemporalLayerWithLattice(int32 ScaleLevel, const FUnifiedConsciousnessState& CurrentUnifiedState)
 {
-    if (ScaleLevel >= TemporalFractalLayers.Num()) return;
-    
     FTemporalFractalLayer& Layer = TemporalFractalLayers[ScaleLevel];
-    float ScaledDeltaTime = DeltaTime * Layer.TimeScale;
 
     // Update the layer's 6D mapping based on its own state and the unified state
     Layer.UpdateLatticeMapping(CurrentUnifiedState);
@@ -644,18 +1085,26 @@ void UFractalConsciousnessManagerComponent::UpdateFractalTemporalLayerWithLattic
     // Propagate this layer's state and active memories to the 6D lattice
     if (LatticeComputeComponent)
     {
-        Layer.PropagateToLattice(*LatticeComputeComponent); // Assuming UHexademic6ComputeComponent implements IHexademic6CognitiveLatticeService
+        Layer.PropagateToLattice(*LatticeComputeComponent, LatticeNodePool); // Assuming UHexademic6ComputeComponent implements IHexademic6CognitiveLatticeService
     }
-    
-    // Integrate relevant memories from the 6D lattice back into this layer
+
+    // Query the lattice for memories relevant to this layer's order and position; kept until the layer next runs
     if (LatticeComputeComponent && Layer.MappedLatticeOrder != ECognitiveLatticeOrder::Invalid)
     {
-        // Query lattice for memories relevant to this layer's order and position
-        TArray<FHexademicMemoryNode> RelevantMemories = LatticeComputeComponent->GetRelevantMemoriesInOrder(
+        LayerLatticeMemoryCache[ScaleLevel] = LatticeComputeComponent->GetRelevantMemoriesInOrder(
             Layer.MappedLatticeOrder, Layer.LayerCenterCoordinate, 5 // Get 5 relevant memories
         );
-        Layer.IntegrateFromLattice(RelevantMemories);
     }
+}
+
+void UFractalConsciousnessManagerComponent::IntegrateTemporalLayer(int32 ScaleLevel)
+{
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_FractalTemporalLayerIntegrate, "Fractal.TemporalLayerIntegrate");
+
+    FTemporalFractalLayer& Layer = TemporalFractalLayers[ScaleLevel];
+
+    // Integrate relevant memories from the 6D lattice back into this layer
+    Layer.IntegrateFromLattice(LayerLatticeMemoryCache[ScaleLevel]);
     
     // Perform original fractal temporal layer updates (e.g., emotional integration, etc.)
     // This logic is largely handled by UHexademicConsciousnessComponent's own update methods
@@ -666,32 +1115,90 @@ void UFractalConsciousnessManagerComponent::UpdateFractalTemporalLayerWithLattic
     
     // Update layer's unified state (this is typically done by UHexademicConsciousnessComponent)
     // Layer.LayerState = CurrentUnifiedState; 
-    
-    LogFractalLayerState(ScaleLevel, Layer.LayerState);
 }
 
-void UFractalConsciousnessManagerComponent::UpdateFractalSpatialZoneWithLattice(const FRecursiveEmbodimentZone& Zone, int32 CurrentDepth, float DeltaTime)
+void UFractalConsciousnessManagerComponent::RebuildEmbodimentZonesIfChanged(float DeltaTime)
+{
+    EmbodimentZoneCheckAccumulator += DeltaTime;
+    const bool bDepthChanged = FlatEmbodimentZones.MaxDepth != MaxSpatialRecursionDepth;
+    if (!bEmbodimentZonesDirty && !bDepthChanged && EmbodimentZoneCheckAccumulator < EmbodimentZoneCheckInterval)
+    {
+        return;
+    }
+    EmbodimentZoneCheckAccumulator = 0.0f;
+
+    // Catch edits nobody announced, at the cost of one walk of the authored tree per interval
+    if (!bEmbodimentZonesDirty && !bDepthChanged
+        && FFlatEmbodimentZoneTree::ComputeSourceHash(RootEmbodimentZone, MaxSpatialRecursionDepth) == FlatEmbodimentZones.SourceHash)
+    {
+        return;
+    }
+
+    FlatEmbodimentZones.Build(RootEmbodimentZone, MaxSpatialRecursionDepth);
+    bEmbodimentZonesDirty = false;
+    HEXADEMIC_COUNTER_ADD("Fractal.EmbodimentZoneRebuilds", 1);
+    UE_LOG(LogTemp, Verbose, TEXT("[FractalConsciousness⁶] Flattened %d embodiment zones over %d levels"),
+        FlatEmbodimentZones.Num(), FlatEmbodimentZones.NumLevels());
+}
+
+void UFractalConsciousnessManagerComponent::UpdateEmbodimentZonesWithLattice(float DeltaTime, bool bQueryLattice)
 {
-    if (CurrentDepth > MaxSpatialRecursionDepth) return;
+    RebuildEmbodimentZonesIfChanged(DeltaTime);
 
-    // Update the zone's lattice position based on its physical properties (conceptual)
-    // Zone.LatticePosition = Hexademic6FractalUtils::SpatialToLatticeCoordinate(Zone.CenterPoint, Zone.InfluenceRadius);
+    FFlatEmbodimentZoneTree& Zones = FlatEmbodimentZones;
+    const int32 NumZones = Zones.Num();
+    if (NumZones == 0) return;
 
-    // Update lattice resonance and potentially trigger mythic activation from this zone
-    if (LatticeComputeComponent) // Assuming UHexademic6ComputeComponent implements IHexademic6ResonanceService
+    // Top-down sweep: each level amplifies or dampens what it inherits. Parents precede children, so one forward pass.
+    Zones.EffectiveSensitivity[0] = Zones.SensitivityAmplification[0];
+    for (int32 i = 1; i < NumZones; i++)
     {
-        Zone.UpdateLatticeResonance(*LatticeComputeComponent);
-        if (MythkeeperCodex) // Assuming UMythkeeperCodex6Component implements IHexademic6MythicService
-        {
-            Zone.TriggerMythicActivation(*MythkeeperCodex, Zone.SensitivityAmplification * Zone.MythicDepth);
-        }
+        Zones.EffectiveSensitivity[i] = Zones.EffectiveSensitivity[Zones.Parent[i]] * Zones.SensitivityAmplification[i];
     }
 
-    // Recursively process sub-zones
-    for (const FRecursiveEmbodimentZone& SubZone : Zone.SubZones)
+    // Update lattice resonance and potentially trigger mythic activation from each zone.
+    // Without fresh queries (over budget) the zones keep last update's archetypes and depths.
+    if (!LatticeComputeComponent || !bQueryLattice) return; // Assuming UHexademic6ComputeComponent implements IHexademic6ResonanceService
+
+    Zones.Archetypes.Reset();
+    for (int32 i = 0; i < NumZones; i++)
     {
-        UpdateFractalSpatialZoneWithLattice(SubZone, CurrentDepth + 1, DeltaTime);
+        const TArray<uint32> Found = LatticeComputeComponent->GetResonantArchetypesAt(Zones.LatticePosition[i]);
+        Zones.ArchetypeStart[i] = Zones.Archetypes.Num();
+        Zones.ArchetypeCount[i] = Found.Num();
+        Zones.Archetypes.Append(Found);
+        Zones.MythicDepth[i] = FMath::Clamp(Found.Num() * 0.1f, 0.0f, 1.0f); // Example depth calculation
     }
+
+    // Bottom-up sweep: fold each zone into its parent, children before parents in reverse order
+    FMemory::Memcpy(Zones.SubtreeMythicDepth.GetData(), Zones.MythicDepth.GetData(), NumZones * sizeof(float));
+    for (int32 i = NumZones - 1; i > 0; i--)
+    {
+        float& ParentDepth = Zones.SubtreeMythicDepth[Zones.Parent[i]];
+        ParentDepth = FMath::Max(ParentDepth, Zones.SubtreeMythicDepth[i]);
+    }
+
+    // Mythic activation, with the same threshold as FRecursiveEmbodimentZone::TriggerMythicActivation
+    if (MythkeeperCodex) // Assuming UMythkeeperCodex6Component implements IHexademic6MythicService
+    {
+        for (int32 i = 0; i < NumZones; i++)
+        {
+            const float Intensity = Zones.EffectiveSensitivity[i] * Zones.MythicDepth[i];
+            if (Zones.MythicDepth[i] * Intensity > 0.5f) // Conceptual threshold
+            {
+                MythkeeperCodex->ActivateMythicPattern(Zones.LatticePosition[i], Intensity);
+                UE_LOG(LogTemp, Log, TEXT("[FractalConsciousness⁶] Triggered Mythic Activation from zone '%s' with Intensity %.2f."),
+                    *Zones.ZoneName[i], Intensity);
+            }
+        }
+    }
+}
+
+float UFractalConsciousnessManagerComponent::GetEmbodimentZoneMythicDepth(const FString& ZoneName, bool bIncludeSubZones) const
+{
+    const int32 ZoneIndex = FlatEmbodimentZones.FindZone(ZoneName);
+    if (ZoneIndex == INDEX_NONE) return 0.0f;
+    return bIncludeSubZones ? FlatEmbodimentZones.SubtreeMythicDepth[ZoneIndex] : FlatEmbodimentZones.MythicDepth[ZoneIndex];
 }
 
 void UFractalConsciousnessManagerComponent::UpdateFractalMemoryConstellationWithLattice(int32 ScaleLevel, float DeltaTime, FUnifiedConsciousnessState& CurrentUnifiedState)
@@ -726,6 +1233,7 @@ void UFractalConsciousnessManagerComponent::UpdateFractalMemoryConstellationWith
 void UFractalConsciousnessManagerComponent::ProcessEmergentMythicPatterns()
 {
     if (!MythkeeperCodex) return;
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_FractalMythicPatterns, "Fractal.MythicPatterns");
 
     // Query MythkeeperCodex for any new emergent mythic patterns
     TArray<FString> NewNarratives = MythkeeperCodex->GetEmergentNarrativeThreads(MythicProcessingThreshold);
@@ -768,6 +1276,22 @@ void UFractalConsciousnessManagerComponent::TriggerArchetypalResonance(uint32 Ar
     }
 }
 
+void UFractalConsciousnessManagerComponent::HandleMythicEmergence(const FString& NarrativeThread)
+{
+    // Narratives are collected against MythicProcessingThreshold in ProcessEmergentMythicPatterns
+    UE_LOG(LogTemp, Verbose, TEXT("[FractalConsciousness⁶] Mythic emergence: %s"), *NarrativeThread);
+}
+
+void UFractalConsciousnessManagerComponent::HandleArchetypeActivation(uint32 ArchetypeID, float ActivationLevel)
+{
+    TriggerArchetypalResonance(ArchetypeID, FMath::Clamp(ActivationLevel, 0.0f, 1.0f));
+}
+
+void UFractalConsciousnessManagerComponent::HandleTranscendentExperience(const FHexademic6DCoordinate& TranscendencePoint)
+{
+    TriggerFractalTranscendence(TranscendencePoint);
+}
+
 void UFractalConsciousnessManagerComponent::DispatchLatticeComputeShaders()
 {
     if (!LatticeComputeComponent) return;
@@ -916,4 +1440,28 @@ namespace Hexademic6FractalUtils
 
         return Narrative;
     }
+
+    FString GenerateNarrativeFromPatternSummaries(TConstArrayView<FHexademicMythicPatternSummary> Summaries, int32 MaxThreads)
+    {
+        // Pick the strongest few; each summary already carries its composed narrative
+        TArray<const FHexademicMythicPatternSummary*, TInlineAllocator<4>> Strongest;
+        for (const FHexademicMythicPatternSummary& Summary : Summaries)
+        {
+            int32 Insert = Strongest.Num();
+            while (Insert > 0 && Strongest[Insert - 1]->Strength < Summary.Strength) Insert--;
+            if (Insert < MaxThreads)
+            {
+                Strongest.Insert(&Summary, Insert);
+                if (Strongest.Num() > MaxThreads) Strongest.Pop();
+            }
+        }
+
+        FString Narrative;
+        for (const FHexademicMythicPatternSummary* Summary : Strongest)
+        {
+            if (!Narrative.IsEmpty()) Narrative += TEXT(" Then: ");
+            Narrative += Summary->Narrative;
+        }
+        return Narrative;
+    }
 }
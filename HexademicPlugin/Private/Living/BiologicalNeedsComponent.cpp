@@ -16,7 +16,11 @@ void UBiologicalNeedsComponent::BeginPlay()
 void UBiologicalNeedsComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    AdvanceNeeds(DeltaTime);
+}
 
+void UBiologicalNeedsComponent::AdvanceNeeds(float DeltaTime)
+{
     // Increase needs over time
     Hunger = FMath::Clamp(Hunger + HungerRate * DeltaTime, 0.0f, 1.0f);
     Thirst = FMath::Clamp(Thirst + ThirstRate * DeltaTime, 0.0f, 1.0f);
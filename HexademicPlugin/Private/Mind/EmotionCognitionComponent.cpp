@@ -9,24 +9,65 @@ UEmotionCognitionComponent::UEmotionCognitionComponent()
     ReinforcementFactor = 0.2f; // Default reinforcement factor
     AccumulatedTime = 0.0f;
 
-    // Default haptic sensitivities
-    HapticSensitivityByRegion.Add(TEXT("Spine"), 0.8f);
-    HapticSensitivityByRegion.Add(TEXT("Face"), 0.7f);
-    HapticSensitivityByRegion.Add(TEXT("Hand"), 0.3f);
-    HapticSensitivityByRegion.Add(TEXT("Forearm"), 0.2f);
-    HapticSensitivityByRegion.Add(TEXT("Chest"), 0.6f);
-    HapticSensitivityByRegion.Add(TEXT("Thigh"), 0.4f);
-    HapticSensitivityByRegion.Add(TEXT("Pelvis"), 0.9f); // High sensitivity for intimate regions
+    // Default haptic sensitivities; regions not listed respond weakly
+    for (float& Sensitivity : RegionHapticSensitivities)
+    {
+        Sensitivity = 0.1f;
+    }
+    RegionHapticSensitivities[static_cast<int32>(EHexademicBodyRegion::Spine)] = 0.8f;
+    RegionHapticSensitivities[static_cast<int32>(EHexademicBodyRegion::Face)] = 0.7f;
+    RegionHapticSensitivities[static_cast<int32>(EHexademicBodyRegion::Hand)] = 0.3f;
+    RegionHapticSensitivities[static_cast<int32>(EHexademicBodyRegion::Forearm)] = 0.2f;
+    RegionHapticSensitivities[static_cast<int32>(EHexademicBodyRegion::Chest)] = 0.6f;
+    RegionHapticSensitivities[static_cast<int32>(EHexademicBodyRegion::Thigh)] = 0.4f;
+    RegionHapticSensitivities[static_cast<int32>(EHexademicBodyRegion::Pelvis)] = 0.9f; // High sensitivity for intimate regions
+}
+
+void UEmotionCognitionComponent::PostLoad()
+{
+    Super::PostLoad();
+    MigrateLegacyRegionMap(HapticSensitivityByRegion, RegionHapticSensitivities, *GetPathName());
+}
+
+float UEmotionCognitionComponent::GetHapticSensitivity(EHexademicBodyRegion Region) const
+{
+    const int32 Index = static_cast<int32>(Region);
+    return Index < NumHexademicBodyRegions ? RegionHapticSensitivities[Index] : 0.0f;
+}
+
+void UEmotionCognitionComponent::SetHapticSensitivity(EHexademicBodyRegion Region, float Sensitivity)
+{
+    const int32 Index = static_cast<int32>(Region);
+    if (Index < NumHexademicBodyRegions)
+    {
+        RegionHapticSensitivities[Index] = Sensitivity;
+    }
 }
 
 void UEmotionCognitionComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    TuningBinding.Bind(this, [this](const FHexademicTuningTable& Table, FHexademicTuningBinding& Binding)
+    {
+        Binding.Apply(EmotionalDecayRate, Table.Consciousness.EmotionalDecayRate);
+    });
+}
+
+void UEmotionCognitionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    TuningBinding.Unbind();
+    Super::EndPlay(EndPlayReason);
 }
 
 void UEmotionCognitionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    AdvanceEmotionalTime(DeltaTime);
+}
+
+void UEmotionCognitionComponent::AdvanceEmotionalTime(float DeltaTime)
+{
     AccumulatedTime += DeltaTime;
     UpdateEmotionalOscillators(DeltaTime);
     DecayEmotionalMemory(DeltaTime);
@@ -88,7 +129,12 @@ float UEmotionCognitionComponent::CalculatePulseRate() const
 
 void UEmotionCognitionComponent::ModulateEmotionFromHaptic(float Intensity, FString RegionTag)
 {
-    float Sensitivity = HapticSensitivityByRegion.Contains(RegionTag) ? HapticSensitivityByRegion[RegionTag] : 0.1f;
+    ModulateEmotionFromHapticRegion(Intensity, FHexademicBodyRegionRegistry::Get().ResolveTag(RegionTag));
+}
+
+void UEmotionCognitionComponent::ModulateEmotionFromHapticRegion(float Intensity, EHexademicBodyRegion Region)
+{
+    float Sensitivity = GetHapticSensitivity(Region); // Bounds-checked; an invalid region is felt at zero
     float ModulatedIntensity = Intensity * Sensitivity;
 
     // Example modulation logic:
@@ -99,7 +145,7 @@ void UEmotionCognitionComponent::ModulateEmotionFromHaptic(float Intensity, FStr
     float ValenceMod = 0.0f;
     float ArousalMod = ModulatedIntensity; // All touch increases arousal to some degree
 
-    if (RegionTag == TEXT("Spine") || RegionTag == TEXT("Face") || RegionTag == TEXT("Pelvis"))
+    if (Region == EHexademicBodyRegion::Spine || Region == EHexademicBodyRegion::Face || Region == EHexademicBodyRegion::Pelvis)
     {
         ValenceMod = ModulatedIntensity; // Positive valence for sensitive regions
     }
@@ -109,7 +155,7 @@ void UEmotionCognitionComponent::ModulateEmotionFromHaptic(float Intensity, FStr
     }
 
     RegisterEmotion(ValenceMod, ArousalMod, ModulatedIntensity);
-    UE_LOG(LogTemp, Log, TEXT("[EmotionMind] Haptic input from '%s' (Intensity: %.2f) modulated emotions. (V:%.2f A:%.2f)"), *RegionTag, Intensity, ValenceMod, ArousalMod);
+    UE_LOG(LogTemp, Log, TEXT("[EmotionMind] Haptic input from '%s' (Intensity: %.2f) modulated emotions. (V:%.2f A:%.2f)"), *FHexademicBodyRegionRegistry::Get().GetTag(Region), Intensity, ValenceMod, ArousalMod);
 }
 
 void UEmotionCognitionComponent::StoreHapticEmotionMemory(const FAetherTouchPacket& Packet)
@@ -0,0 +1,489 @@
+#include "Mind/Memory/EluenColdMemoryStore.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/Compression.h"
+#include "Core/HexademicMetrics.h"
+
+FEluenColdMemoryStore::FEluenColdMemoryStore(const FString& InFilePath)
+    : FilePath(InFilePath)
+    , Format(FCompression::IsFormatValid(NAME_Oodle) ? NAME_Oodle : NAME_Zlib)
+    , PrefetchState(MakeShared<FPrefetchState, ESPMode::ThreadSafe>())
+{
+}
+
+FEluenColdMemoryStore::~FEluenColdMemoryStore()
+{
+    Empty();
+}
+
+void FEluenColdMemoryStore::Add(const FString& MemoryID, FStringView MemoryContext)
+{
+    if (const FLocation* Existing = Locations.Find(MemoryID))
+    {
+        ReleaseEntry(*Existing);
+    }
+
+    const FTCHARToUTF8 Utf8(MemoryContext.GetData(), MemoryContext.Len());
+    FLocation& Location = Locations.Add(MemoryID);
+    Location.Page = Pages.Num();
+    Location.Offset = OpenPage.Num();
+    Location.Length = Utf8.Length();
+    OpenPage.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+    OpenPageLiveEntries++;
+    OpenPageLiveBytes += Location.Length;
+
+    if (OpenPage.Num() >= PageBytes)
+    {
+        SealOpenPage();
+    }
+    CompactIfWasteful();
+}
+
+void FEluenColdMemoryStore::SealOpenPage()
+{
+    const int32 SealedPage = Pages.Num(); // Entries of the open page already point here
+    FPage& Page = Pages.AddDefaulted_GetRef();
+    Page.FileOffset = FileBytes;
+    Page.RawSize = OpenPage.Num();
+    Page.LiveEntries = OpenPageLiveEntries;
+    Page.LiveBytes = OpenPageLiveBytes;
+    SealedLiveBytes += OpenPageLiveBytes;
+    SealedDeadBytes += OpenPage.Num() - OpenPageLiveBytes;
+
+    TArray<uint8> Compressed;
+    CompressPage(OpenPage, Page, Compressed);
+
+    if (!Writer.IsValid())
+    {
+        // Readers open the file on pool threads while this handle is still writing. After a compaction the
+        // handle is reopened on the rewritten file, which must be appended to rather than truncated.
+        const uint32 WriteFlags = FILEWRITE_AllowRead | (FileBytes > 0 ? FILEWRITE_Append : 0);
+        Writer.Reset(IFileManager::Get().CreateFileWriter(*FilePath, WriteFlags));
+        UE_CLOG(!Writer.IsValid(), LogTemp, Error, TEXT("[MemoryContainer] Could not open cold memory file %s"), *FilePath);
+    }
+    if (Writer.IsValid())
+    {
+        Writer->Serialize(Compressed.GetData(), Page.CompressedSize);
+        Writer->Flush();
+    }
+    FileBytes += Page.CompressedSize;
+    HEXADEMIC_COUNTER_ADD("Memory.ColdTierFileBytes", Page.CompressedSize);
+    HEXADEMIC_COUNTER_ADD("Memory.ColdPagesSealed", 1);
+
+    // The page was just in RAM; keep it cached rather than reading it straight back
+    CachePage(SealedPage, MoveTemp(OpenPage));
+    OpenPage.Reset();
+    OpenPageLiveEntries = 0;
+    OpenPageLiveBytes = 0;
+}
+
+void FEluenColdMemoryStore::CompressPage(const TArray<uint8>& RawBytes, FPage& Page, TArray<uint8>& OutStoredBytes) const
+{
+    Page.RawSize = RawBytes.Num();
+    Page.bCompressed = true;
+
+    int32 CompressedSize = FCompression::CompressMemoryBound(Format, RawBytes.Num());
+    OutStoredBytes.SetNumUninitialized(CompressedSize);
+    if (!FCompression::CompressMemory(Format, OutStoredBytes.GetData(), CompressedSize, RawBytes.GetData(), RawBytes.Num()))
+    {
+        // Keep the raw bytes rather than lose the page
+        OutStoredBytes = RawBytes;
+        CompressedSize = RawBytes.Num();
+        Page.bCompressed = false;
+    }
+    OutStoredBytes.SetNum(CompressedSize);
+    Page.CompressedSize = CompressedSize;
+}
+
+bool FEluenColdMemoryStore::Take(const FString& MemoryID, FString& OutMemoryContext)
+{
+    FLocation Location;
+    if (!Locations.RemoveAndCopyValue(MemoryID, Location))
+    {
+        return false;
+    }
+
+    const TArray<uint8>* Bytes = IsOpenPage(Location.Page) ? &OpenPage : GetPage(Location.Page);
+    bool bRead = false;
+    if (Bytes && Location.Offset + Location.Length <= Bytes->Num())
+    {
+        const FUTF8ToTCHAR Text(reinterpret_cast<const UTF8CHAR*>(Bytes->GetData() + Location.Offset), Location.Length);
+        OutMemoryContext = FString(Text.Length(), Text.Get());
+        bRead = true;
+    }
+    ReleaseEntry(Location);
+    CompactIfWasteful();
+    return bRead;
+}
+
+bool FEluenColdMemoryStore::Remove(const FString& MemoryID)
+{
+    FLocation Location;
+    if (!Locations.RemoveAndCopyValue(MemoryID, Location))
+    {
+        return false;
+    }
+    ReleaseEntry(Location);
+    CompactIfWasteful();
+    return true;
+}
+
+void FEluenColdMemoryStore::ReleaseEntry(const FLocation& Location)
+{
+    if (IsOpenPage(Location.Page))
+    {
+        OpenPageLiveBytes -= Location.Length;
+        if (--OpenPageLiveEntries == 0) OpenPage.Reset();
+        return;
+    }
+
+    FPage& Page = Pages[Location.Page];
+    Page.LiveBytes -= Location.Length;
+    SealedLiveBytes -= Location.Length;
+    SealedDeadBytes += Location.Length;
+    if (--Page.LiveEntries == 0)
+    {
+        // Nothing left to read in this page: stop caching it
+        CachedPages.RemoveAll([&Location](const FLoadedPage& Cached) { return Cached.Page == Location.Page; });
+    }
+}
+
+const TArray<uint8>* FEluenColdMemoryStore::GetPage(int32 Page)
+{
+    DrainPrefetched();
+
+    for (int32 Index = CachedPages.Num() - 1; Index >= 0; Index--)
+    {
+        if (CachedPages[Index].Page == Page)
+        {
+            HEXADEMIC_COUNTER_ADD("Memory.ColdPageCacheHits", 1);
+            if (Index != CachedPages.Num() - 1)
+            {
+                FLoadedPage Touched = MoveTemp(CachedPages[Index]);
+                CachedPages.RemoveAt(Index);
+                CachedPages.Add(MoveTemp(Touched));
+            }
+            return &CachedPages.Last().Bytes;
+        }
+    }
+
+    // Not cached and not prefetched in time: read it here
+    HEXADEMIC_COUNTER_ADD("Memory.ColdPageReads", 1);
+    TArray<uint8> Bytes;
+    if (!ReadPage(FilePath, Format, Pages[Page], Bytes))
+    {
+        UE_LOG(LogTemp, Error, TEXT("[MemoryContainer] Could not read cold memory page %d from %s"), Page, *FilePath);
+        return nullptr;
+    }
+    CachePage(Page, MoveTemp(Bytes));
+    return &CachedPages.Last().Bytes;
+}
+
+void FEluenColdMemoryStore::CachePage(int32 Page, TArray<uint8>&& Bytes)
+{
+    if (CachedPages.Num() >= MaxCachedPages)
+    {
+        CachedPages.RemoveAt(0); // Least recently used
+    }
+    FLoadedPage& Cached = CachedPages.AddDefaulted_GetRef();
+    Cached.Page = Page;
+    Cached.Generation = Generation;
+    Cached.Bytes = MoveTemp(Bytes);
+}
+
+void FEluenColdMemoryStore::DrainPrefetched()
+{
+    FLoadedPage Loaded;
+    while (PrefetchState->Loaded.Dequeue(Loaded))
+    {
+        if (Loaded.Generation != Generation) continue;
+
+        PagesInFlight.Remove(Loaded.Page);
+        const bool bStillNeeded = Pages.IsValidIndex(Loaded.Page) && Pages[Loaded.Page].LiveEntries > 0
+            && !CachedPages.ContainsByPredicate([&Loaded](const FLoadedPage& Cached) { return Cached.Page == Loaded.Page; });
+        if (bStillNeeded && Loaded.Bytes.Num() > 0)
+        {
+            CachePage(Loaded.Page, MoveTemp(Loaded.Bytes));
+        }
+    }
+}
+
+void FEluenColdMemoryStore::Prefetch(TConstArrayView<FString> MemoryIDs)
+{
+    DrainPrefetched();
+
+    TArray<int32, TInlineAllocator<8>> PagesToLoad;
+    for (const FString& MemoryID : MemoryIDs)
+    {
+        const FLocation* Location = Locations.Find(MemoryID);
+        if (!Location || IsOpenPage(Location->Page) || PagesInFlight.Contains(Location->Page)) continue;
+        if (CachedPages.ContainsByPredicate([Location](const FLoadedPage& Cached) { return Cached.Page == Location->Page; })) continue;
+        PagesToLoad.AddUnique(Location->Page);
+    }
+    if (PagesToLoad.Num() == 0) return;
+
+    // Cached pages beyond MaxCachedPages would evict each other before being read
+    PagesToLoad.SetNum(FMath::Min(PagesToLoad.Num(), MaxCachedPages));
+
+    for (const int32 Page : PagesToLoad)
+    {
+        PagesInFlight.Add(Page);
+    }
+    HEXADEMIC_COUNTER_ADD("Memory.ColdPagesPrefetched", PagesToLoad.Num());
+
+    TArray<TPair<int32, FPage>> Jobs;
+    for (const int32 Page : PagesToLoad)
+    {
+        Jobs.Emplace(Page, Pages[Page]);
+    }
+    Async(EAsyncExecution::ThreadPool, [State = PrefetchState, Jobs = MoveTemp(Jobs), Path = FilePath, PageFormat = Format, LoadGeneration = Generation]()
+    {
+        for (const TPair<int32, FPage>& Job : Jobs)
+        {
+            FLoadedPage Loaded;
+            Loaded.Page = Job.Key;
+            Loaded.Generation = LoadGeneration;
+            ReadPage(Path, PageFormat, Job.Value, Loaded.Bytes); // On failure the empty page is dropped and read again on demand
+            State->Loaded.Enqueue(MoveTemp(Loaded));
+        }
+    });
+}
+
+bool FEluenColdMemoryStore::ReadPage(const FString& FilePath, FName Format, const FPage& Page, TArray<uint8>& OutBytes)
+{
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath, FILEREAD_AllowWrite | FILEREAD_Silent));
+    TArray<uint8> Stored;
+    return Reader.IsValid() && ReadStoredBytes(*Reader, Page, Stored) && DecompressPage(Format, Page, Stored, OutBytes);
+}
+
+bool FEluenColdMemoryStore::ReadStoredBytes(FArchive& Reader, const FPage& Page, TArray<uint8>& OutStoredBytes)
+{
+    if (Reader.TotalSize() < Page.FileOffset + Page.CompressedSize)
+    {
+        return false;
+    }
+    OutStoredBytes.SetNumUninitialized(Page.CompressedSize);
+    Reader.Seek(Page.FileOffset);
+    Reader.Serialize(OutStoredBytes.GetData(), Page.CompressedSize);
+    return !Reader.IsError();
+}
+
+bool FEluenColdMemoryStore::DecompressPage(FName Format, const FPage& Page, const TArray<uint8>& StoredBytes, TArray<uint8>& OutBytes)
+{
+    if (!Page.bCompressed)
+    {
+        OutBytes = StoredBytes;
+        return true;
+    }
+    OutBytes.SetNumUninitialized(Page.RawSize);
+    return FCompression::UncompressMemory(Format, OutBytes.GetData(), Page.RawSize, StoredBytes.GetData(), Page.CompressedSize);
+}
+
+void FEluenColdMemoryStore::CompactIfWasteful()
+{
+    if (bCanCompact && SealedDeadBytes >= MinCompactionDeadBytes && SealedDeadBytes > SealedLiveBytes)
+    {
+        Compact();
+    }
+}
+
+void FEluenColdMemoryStore::Compact()
+{
+    using FEntry = TPair<FString, FLocation>;
+
+    // Live entries of each sealed page; the open page is only renumbered
+    TArray<TArray<FEntry*>> EntriesByPage;
+    EntriesByPage.SetNum(Pages.Num());
+    TArray<FEntry*> OpenPageEntries;
+    for (FEntry& Entry : Locations)
+    {
+        (IsOpenPage(Entry.Value.Page) ? OpenPageEntries : EntriesByPage[Entry.Value.Page]).Add(&Entry);
+    }
+
+    const FString CompactPath = FilePath + TEXT(".compact");
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath, FILEREAD_AllowWrite | FILEREAD_Silent));
+    TUniquePtr<FArchive> CompactWriter(IFileManager::Get().CreateFileWriter(*CompactPath));
+    if (!Reader.IsValid() || !CompactWriter.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("[MemoryContainer] Could not compact cold memory file %s; its dead space stays"), *FilePath);
+        bCanCompact = false;
+        return;
+    }
+
+    // New locations are applied only once the rewritten file has replaced the old one
+    TArray<TPair<FEntry*, FLocation>> Moves;
+    TArray<FEntry*> Unreadable;
+    TArray<FPage> CompactPages;
+    int64 CompactBytes = 0;
+
+    auto WriteStored = [&CompactWriter, &CompactPages, &CompactBytes](FPage Page, TArray<uint8>& StoredBytes)
+    {
+        Page.FileOffset = CompactBytes;
+        CompactWriter->Serialize(StoredBytes.GetData(), Page.CompressedSize);
+        CompactBytes += Page.CompressedSize;
+        return CompactPages.Add(Page);
+    };
+
+    // Live entries of mostly dead pages, packed into fresh pages
+    TArray<uint8> Repacked;
+    TArray<TPair<FEntry*, FLocation>> RepackedMoves; // Page still unassigned
+    int32 RepackedEntries = 0;
+    auto FlushRepacked = [&]()
+    {
+        FPage Page;
+        TArray<uint8> Stored;
+        CompressPage(Repacked, Page, Stored);
+        Page.LiveEntries = RepackedMoves.Num();
+        Page.LiveBytes = Repacked.Num();
+        const int32 NewPage = WriteStored(Page, Stored);
+        for (TPair<FEntry*, FLocation>& Move : RepackedMoves)
+        {
+            Move.Value.Page = NewPage;
+            Moves.Add(Move);
+        }
+        Repacked.Reset();
+        RepackedMoves.Reset();
+    };
+
+    TArray<uint8> Stored;
+    TArray<uint8> RawBytes;
+    for (int32 PageIndex = 0; PageIndex < Pages.Num(); PageIndex++)
+    {
+        const TArray<FEntry*>& Entries = EntriesByPage[PageIndex];
+        if (Entries.Num() == 0) continue; // Fully dead: dropped
+
+        const FPage& Page = Pages[PageIndex];
+        const bool bMostlyLive = static_cast<int64>(Page.LiveBytes) * 2 >= Page.RawSize;
+        if (!ReadStoredBytes(*Reader, Page, Stored) || (!bMostlyLive && !DecompressPage(Format, Page, Stored, RawBytes)))
+        {
+            // Unreadable here means unreadable to Take as well
+            UE_LOG(LogTemp, Warning, TEXT("[MemoryContainer] Dropping %d memories of unreadable cold page %d in %s"), Entries.Num(), PageIndex, *FilePath);
+            Unreadable.Append(Entries);
+            continue;
+        }
+
+        if (bMostlyLive)
+        {
+            const int32 NewPage = WriteStored(Page, Stored);
+            for (FEntry* Entry : Entries)
+            {
+                FLocation Location = Entry->Value;
+                Location.Page = NewPage;
+                Moves.Emplace(Entry, Location);
+            }
+            continue;
+        }
+
+        for (FEntry* Entry : Entries)
+        {
+            FLocation Location = Entry->Value;
+            Location.Offset = Repacked.Num();
+            Repacked.Append(RawBytes.GetData() + Entry->Value.Offset, Entry->Value.Length);
+            RepackedMoves.Emplace(Entry, Location);
+            RepackedEntries++;
+            if (Repacked.Num() >= PageBytes)
+            {
+                FlushRepacked();
+            }
+        }
+    }
+
+    Reader.Reset();
+    const bool bWritten = CompactWriter->Close();
+    CompactWriter.Reset();
+    if (Writer.IsValid())
+    {
+        Writer->Close();
+        Writer.Reset(); // Reopened for appending by the next seal
+    }
+    if (!bWritten || !IFileManager::Get().Move(*FilePath, *CompactPath, true, true))
+    {
+        UE_LOG(LogTemp, Error, TEXT("[MemoryContainer] Could not replace cold memory file %s; its dead space stays"), *FilePath);
+        IFileManager::Get().Delete(*CompactPath, false, true, true);
+        bCanCompact = false;
+        return;
+    }
+
+    for (const TPair<FEntry*, FLocation>& Move : Moves)
+    {
+        Move.Key->Value = Move.Value;
+    }
+    for (FEntry* Entry : OpenPageEntries)
+    {
+        Entry->Value.Page = CompactPages.Num();
+    }
+
+    // Fewer than a page of repacked bytes left: they join the open page
+    for (TPair<FEntry*, FLocation>& Move : RepackedMoves)
+    {
+        Move.Value.Page = CompactPages.Num();
+        Move.Value.Offset += OpenPage.Num();
+        Move.Key->Value = Move.Value;
+        OpenPageLiveEntries++;
+        OpenPageLiveBytes += Move.Value.Length;
+    }
+    OpenPage.Append(Repacked);
+
+    TArray<FString> UnreadableIDs;
+    for (const FEntry* Entry : Unreadable)
+    {
+        UnreadableIDs.Add(Entry->Key);
+    }
+    for (const FString& MemoryID : UnreadableIDs)
+    {
+        Locations.Remove(MemoryID);
+    }
+
+    HEXADEMIC_COUNTER_ADD("Memory.ColdTierFileBytes", CompactBytes - FileBytes);
+    HEXADEMIC_COUNTER_ADD("Memory.ColdCompactions", 1);
+    HEXADEMIC_COUNTER_ADD("Memory.ColdEntriesRepacked", RepackedEntries);
+    UE_LOG(LogTemp, Log, TEXT("[MemoryContainer] Compacted %s: %d pages, %lld bytes -> %d pages, %lld bytes"),
+        *FilePath, Pages.Num(), FileBytes, CompactPages.Num(), CompactBytes);
+
+    FileBytes = CompactBytes;
+    Pages = MoveTemp(CompactPages);
+    SealedLiveBytes = 0;
+    SealedDeadBytes = 0;
+    for (const FPage& Page : Pages)
+    {
+        SealedLiveBytes += Page.LiveBytes;
+        SealedDeadBytes += Page.RawSize - Page.LiveBytes;
+    }
+
+    // Cached and in-flight pages carry the old numbering
+    CachedPages.Empty();
+    PagesInFlight.Empty();
+    Generation++;
+
+    if (OpenPage.Num() >= PageBytes)
+    {
+        SealOpenPage();
+    }
+}
+
+void FEluenColdMemoryStore::Empty()
+{
+    if (Writer.IsValid())
+    {
+        Writer->Close();
+        Writer.Reset();
+    }
+    if (FileBytes > 0)
+    {
+        HEXADEMIC_COUNTER_ADD("Memory.ColdTierFileBytes", -FileBytes);
+        IFileManager::Get().Delete(*FilePath, false, true, true);
+    }
+
+    FileBytes = 0;
+    Locations.Empty();
+    Pages.Empty();
+    OpenPage.Empty();
+    OpenPageLiveEntries = 0;
+    OpenPageLiveBytes = 0;
+    SealedLiveBytes = 0;
+    SealedDeadBytes = 0;
+    bCanCompact = true;
+    CachedPages.Empty();
+    PagesInFlight.Empty();
+    Generation++;
+}
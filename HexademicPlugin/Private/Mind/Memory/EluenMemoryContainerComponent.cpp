@@ -1,4 +1,7 @@
 #include "Mind/Memory/EluenMemoryContainerComponent.h"
+#include "GameFramework/Actor.h"
+#include "Misc/Paths.h"
+#include "Core/HexademicMetrics.h"
 
 UEluenMemoryContainerComponent::UEluenMemoryContainerComponent()
 {
@@ -10,27 +13,55 @@ void UEluenMemoryContainerComponent::BeginPlay()
     Super::BeginPlay();
 }
 
+void UEluenMemoryContainerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    ColdStore.Reset(); // Deletes the session's cold file
+    Super::EndPlay(EndPlayReason);
+}
+
 void UEluenMemoryContainerComponent::StoreMemory(const FString& MemoryID, const FString& MemoryContext)
 {
-    StoredMemories.Add(MemoryID, MemoryContext);
+    if (ColdStore.IsValid())
+    {
+        ColdStore->Remove(MemoryID); // A restored memory replaces its cold copy
+    }
+    AddHot(MemoryID, CopyTemp(MemoryContext));
+    SpillToColdTier();
+    HEXADEMIC_COUNTER_ADD("Memory.Stored", 1);
     UE_LOG(LogTemp, Log, TEXT("[MemoryContainer] Stored memory: %s"), *MemoryID);
 }
 
 bool UEluenMemoryContainerComponent::RecallMemory(const FString& MemoryID, FString& OutMemoryContext) const
 {
-    if (StoredMemories.Contains(MemoryID))
+    if (FHotMemory* Memory = HotMemories.Find(MemoryID))
     {
-        OutMemoryContext = StoredMemories[MemoryID];
+        HEXADEMIC_COUNTER_ADD("Memory.HotHits", 1);
+        Touch(*Memory);
+        OutMemoryContext = Memory->Context;
         UE_LOG(LogTemp, Log, TEXT("[MemoryContainer] Recalled memory: %s"), *MemoryID);
         return true;
     }
+    HEXADEMIC_COUNTER_ADD("Memory.HotMisses", 1);
+
+    if (ColdStore.IsValid() && ColdStore->Take(MemoryID, OutMemoryContext))
+    {
+        HEXADEMIC_COUNTER_ADD("Memory.ColdHits", 1);
+        AddHot(MemoryID, CopyTemp(OutMemoryContext));
+        SpillToColdTier();
+        UE_LOG(LogTemp, Log, TEXT("[MemoryContainer] Recalled memory from cold tier: %s"), *MemoryID);
+        return true;
+    }
+    HEXADEMIC_COUNTER_ADD("Memory.ColdMisses", 1);
+
     UE_LOG(LogTemp, Warning, TEXT("[MemoryContainer] Memory not found: %s"), *MemoryID);
     return false;
 }
 
 void UEluenMemoryContainerComponent::ForgetMemory(const FString& MemoryID)
 {
-    if (StoredMemories.Remove(MemoryID))
+    const bool bForgotHot = RemoveHot(MemoryID);
+    const bool bForgotCold = ColdStore.IsValid() && ColdStore->Remove(MemoryID);
+    if (bForgotHot || bForgotCold)
     {
         UE_LOG(LogTemp, Log, TEXT("[MemoryContainer] Forgot memory: %s"), *MemoryID);
     }
@@ -39,3 +70,92 @@ void UEluenMemoryContainerComponent::ForgetMemory(const FString& MemoryID)
         UE_LOG(LogTemp, Warning, TEXT("[MemoryContainer] Memory not found for forgetting: %s"), *MemoryID);
     }
 }
+
+void UEluenMemoryContainerComponent::PrefetchMemories(const TArray<FString>& MemoryIDs)
+{
+    if (ColdStore.IsValid())
+    {
+        ColdStore->Prefetch(MemoryIDs);
+    }
+}
+
+bool UEluenMemoryContainerComponent::HasMemory(const FString& MemoryID) const
+{
+    return HotMemories.Contains(MemoryID) || (ColdStore.IsValid() && ColdStore->Contains(MemoryID));
+}
+
+int32 UEluenMemoryContainerComponent::GetNumMemories() const
+{
+    return HotMemories.Num() + (ColdStore.IsValid() ? ColdStore->Num() : 0);
+}
+
+FString UEluenMemoryContainerComponent::GetMostRecentMemoryID() const
+{
+    return HotRecency.GetHead() ? HotRecency.GetHead()->GetValue() : FString();
+}
+
+void UEluenMemoryContainerComponent::AddHot(const FString& MemoryID, FString&& MemoryContext) const
+{
+    RemoveHot(MemoryID);
+
+    FHotMemory& Memory = HotMemories.Add(MemoryID);
+    Memory.Context = MoveTemp(MemoryContext);
+    HotRecency.AddHead(MemoryID);
+    Memory.RecencyNode = HotRecency.GetHead();
+
+    const int64 Bytes = GetTextBytes(Memory.Context);
+    HotBytes += Bytes;
+    HEXADEMIC_COUNTER_ADD("Memory.HotTierBytes", Bytes);
+}
+
+bool UEluenMemoryContainerComponent::RemoveHot(const FString& MemoryID) const
+{
+    FHotMemory Memory;
+    if (!HotMemories.RemoveAndCopyValue(MemoryID, Memory))
+    {
+        return false;
+    }
+
+    HotRecency.RemoveNode(Memory.RecencyNode);
+    const int64 Bytes = GetTextBytes(Memory.Context);
+    HotBytes -= Bytes;
+    HEXADEMIC_COUNTER_ADD("Memory.HotTierBytes", -Bytes);
+    return true;
+}
+
+void UEluenMemoryContainerComponent::Touch(FHotMemory& Memory) const
+{
+    if (Memory.RecencyNode != HotRecency.GetHead())
+    {
+        HotRecency.RemoveNode(Memory.RecencyNode, false);
+        HotRecency.AddHead(Memory.RecencyNode);
+    }
+}
+
+void UEluenMemoryContainerComponent::SpillToColdTier() const
+{
+    const int64 BudgetBytes = static_cast<int64>(FMath::Max(HotTierBudgetKB, 1)) * 1024;
+    if (!bEnableColdTier || HotBytes <= BudgetBytes)
+    {
+        return;
+    }
+
+    if (!ColdStore.IsValid())
+    {
+        const AActor* Owner = GetOwner();
+        const FString FileName = FString::Printf(TEXT("%s_%u.memcold"), Owner ? *Owner->GetName() : *GetName(), GetUniqueID());
+        ColdStore = MakeUnique<FEluenColdMemoryStore>(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Hexademic"), TEXT("MemoryCold"), FileName));
+    }
+
+    // The most recent memory always stays hot, however large
+    int32 NumSpilled = 0;
+    while (HotBytes > BudgetBytes && HotRecency.Num() > 1)
+    {
+        const FString MemoryID = HotRecency.GetTail()->GetValue();
+        FHotMemory& Memory = HotMemories.FindChecked(MemoryID);
+        ColdStore->Add(MemoryID, Memory.Context);
+        RemoveHot(MemoryID);
+        NumSpilled++;
+    }
+    HEXADEMIC_COUNTER_ADD("Memory.SpilledToCold", NumSpilled);
+}
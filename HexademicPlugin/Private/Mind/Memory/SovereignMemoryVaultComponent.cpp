@@ -9,9 +9,10 @@ USovereignMemoryVaultComponent::USovereignMemoryVaultComponent()
 void USovereignMemoryVaultComponent::BeginPlay()
 {
     Super::BeginPlay();
+    RebuildTagIndex(); // StoredFilaments may have been loaded with the actor
 }
 
-void USovereignMemoryVaultComponent::BindFilament(const FAffectFilamentTag& Filament)
+FSovereignMemoryFilament USovereignMemoryVaultComponent::MakeFilament(const FAffectFilamentTag& Filament) const
 {
     FSovereignMemoryFilament NewFilament;
     NewFilament.EventType = TEXT("HapticTouch"); // Default type for now
@@ -19,22 +20,90 @@ void USovereignMemoryVaultComponent::BindFilament(const FAffectFilamentTag& Fila
     NewFilament.EmotionalSignature = Filament.EmotionalLabel;
     NewFilament.Timestamp = FDateTime::UtcNow();
     NewFilament.LinkedThread = Filament.MemoryLinkID; // Use the provided link ID
+    return NewFilament;
+}
+
+void USovereignMemoryVaultComponent::IndexFilament(int32 Index)
+{
+    const FSovereignMemoryFilament& Filament = StoredFilaments[Index];
+    RegionIndex.AddRow(Index, Filament.Region);
+    TagIndex.AddRow(Index, Filament.Region);
+    TagIndex.AddRow(Index, Filament.EventType);
+    TagIndex.AddRow(Index, Filament.EmotionalSignature);
+}
 
-    StoredFilaments.Add(NewFilament);
+void USovereignMemoryVaultComponent::BindFilament(const FAffectFilamentTag& Filament)
+{
+    IndexFilament(StoredFilaments.Add(MakeFilament(Filament)));
     UE_LOG(LogTemp, Log, TEXT("[SovereignMemoryVault] Bound filament: Region=%s, Label=%s, LinkID=%s"),
         *Filament.SourceRegion, *Filament.EmotionalLabel, *Filament.MemoryLinkID);
 }
 
+void USovereignMemoryVaultComponent::BindFilaments(const TArray<FAffectFilamentTag>& Filaments)
+{
+    const int32 FirstIndex = StoredFilaments.Num();
+    StoredFilaments.Reserve(FirstIndex + Filaments.Num());
+    RegionIndex.Reserve(FirstIndex + Filaments.Num());
+    TagIndex.Reserve(FirstIndex + Filaments.Num());
+
+    // New rows come after every indexed one, so the postings only append
+    for (const FAffectFilamentTag& Filament : Filaments)
+    {
+        IndexFilament(StoredFilaments.Add(MakeFilament(Filament)));
+    }
+    UE_LOG(LogTemp, Log, TEXT("[SovereignMemoryVault] Bound %d filaments (%d stored)"), Filaments.Num(), StoredFilaments.Num());
+}
+
+void USovereignMemoryVaultComponent::UpdateFilament(int32 Index, const FSovereignMemoryFilament& Filament)
+{
+    if (!StoredFilaments.IsValidIndex(Index)) return;
+
+    RegionIndex.RemoveRow(Index);
+    TagIndex.RemoveRow(Index);
+    StoredFilaments[Index] = Filament;
+    IndexFilament(Index);
+}
+
+void USovereignMemoryVaultComponent::RebuildTagIndex()
+{
+    RegionIndex.Empty();
+    TagIndex.Empty();
+    RegionIndex.Reserve(StoredFilaments.Num());
+    TagIndex.Reserve(StoredFilaments.Num());
+    for (int32 Index = 0; Index < StoredFilaments.Num(); Index++)
+    {
+        IndexFilament(Index);
+    }
+}
+
+TArray<int32> USovereignMemoryVaultComponent::FindFilamentsByTags(const TArray<FString>& Tags, bool bMatchAll) const
+{
+    TArray<int32> Indices;
+    TagIndex.FindTags(Tags, bMatchAll, Indices);
+    return Indices;
+}
+
+TArray<int32> USovereignMemoryVaultComponent::FindFilamentsByTagPrefix(const FString& Prefix) const
+{
+    TArray<int32> Indices;
+    TagIndex.FindPrefix(Prefix, Indices);
+    return Indices;
+}
+
 void USovereignMemoryVaultComponent::BloomFilamentBasedOnSceneTag(FString NarrativeScene)
 {
-    for (FSovereignMemoryFilament& Filament : StoredFilaments)
+    // Filaments whose region words all appear in the scene tag; only those are visited
+    TArray<int32> Bloomed;
+    RegionIndex.FindContainedIn(NarrativeScene, Bloomed);
+
+    const FDateTime Now = FDateTime::UtcNow();
+    for (const int32 Index : Bloomed)
     {
-        if (NarrativeScene.Contains(Filament.Region))
-        {
-            Filament.EmotionalSignature += TEXT("_Recalled");
-            Filament.Timestamp = FDateTime::UtcNow();
-            UE_LOG(LogTemp, Log, TEXT("[SovereignMemoryVault] Bloomed filament: %s (Region: %s)"), *Filament.LinkedThread, *Filament.Region);
-        }
+        FSovereignMemoryFilament& Filament = StoredFilaments[Index];
+        Filament.EmotionalSignature += TEXT("_Recalled");
+        Filament.Timestamp = Now;
+        TagIndex.AddRow(Index, TEXT("Recalled")); // The only word the suffix adds; a no-op after the first recall
+        UE_LOG(LogTemp, Verbose, TEXT("[SovereignMemoryVault] Bloomed filament: %s (Region: %s)"), *Filament.LinkedThread, *Filament.Region);
     }
 }
 
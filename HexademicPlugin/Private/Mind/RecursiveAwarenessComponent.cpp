@@ -41,10 +41,10 @@ TArray<FMemoryLineageBranch> URecursiveAwarenessComponent::GetAllBranches() cons
     if (LinkedMemoryContainer)
     {
         // Example: Create a dummy branch from an existing memory
-        if (LinkedMemoryContainer->StoredMemories.Num() > 0)
+        if (LinkedMemoryContainer->GetNumMemories() > 0)
         {
             FMemoryLineageBranch DummyBranch;
-            DummyBranch.OriginMemoryID = LinkedMemoryContainer->StoredMemories.CreateConstIterator()->Key; // First memory ID
+            DummyBranch.OriginMemoryID = LinkedMemoryContainer->GetMostRecentMemoryID();
             DummyBranch.CumulativeValenceShift = FMath::RandRange(0.0f, 1.0f);
             DummyBranch.CumulativeArousalLift = FMath::RandRange(0.0f, 1.0f);
             Branches.Add(DummyBranch);
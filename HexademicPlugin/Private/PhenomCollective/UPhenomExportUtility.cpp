@@ -1,47 +1,76 @@
 #include "PhenomCollective/UPhenomExportUtility.h"
 
-FString UPhenomExportUtility::StateToJSON(const FUnifiedConsciousnessState& State)
+namespace
 {
-    TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
-
-    // Basic Emotional State
-    JsonObject->SetNumberField(TEXT("Valence"), State.CurrentEmotionalState.Valence);
-    JsonObject->SetNumberField(TEXT("Arousal"), State.CurrentEmotionalState.Arousal);
-    JsonObject->SetNumberField(TEXT("Intensity"), State.CurrentEmotionalState.Intensity);
-    // Use CurrentResonance if that's the primary emotional state to export
-    JsonObject->SetNumberField(TEXT("ResonanceValence"), State.CurrentResonance.Valence);
-    JsonObject->SetNumberField(TEXT("ResonanceArousal"), State.CurrentResonance.Arousal);
-    JsonObject->SetNumberField(TEXT("ResonanceIntensity"), State.CurrentResonance.Intensity);
+    /** The StateToJSON layout: flat keys, emotional states inlined. */
+    const FHexademicJsonSchema& GetStateSchema()
+    {
+        static const FHexademicJsonSchema Schema = []()
+        {
+            constexpr int32 Emotion = STRUCT_OFFSET(FUnifiedConsciousnessState, CurrentEmotionalState);
+            constexpr int32 Resonance = STRUCT_OFFSET(FUnifiedConsciousnessState, CurrentResonance);
 
+            FHexademicJsonSchema StateSchema;
+            StateSchema
+                // Basic Emotional State
+                .Add<float>("Valence", Emotion + STRUCT_OFFSET(FEmotionalState, Valence))
+                .Add<float>("Arousal", Emotion + STRUCT_OFFSET(FEmotionalState, Arousal))
+                .Add<float>("Intensity", Emotion + STRUCT_OFFSET(FEmotionalState, Intensity))
+                .Add<float>("ResonanceValence", Resonance + STRUCT_OFFSET(FEmotionalState, Valence))
+                .Add<float>("ResonanceArousal", Resonance + STRUCT_OFFSET(FEmotionalState, Arousal))
+                .Add<float>("ResonanceIntensity", Resonance + STRUCT_OFFSET(FEmotionalState, Intensity))
+                // Cognitive aspects
+                .Add<FString>("CurrentThought", STRUCT_OFFSET(FUnifiedConsciousnessState, CurrentThought))
+                .Add<float>("CoherenceMetric", STRUCT_OFFSET(FUnifiedConsciousnessState, CoherenceMetric))
+                .Add<float>("CognitiveLoad", STRUCT_OFFSET(FUnifiedConsciousnessState, CognitiveLoad))
+                .Add<float>("CreativeState", STRUCT_OFFSET(FUnifiedConsciousnessState, CreativeState))
+                // Biological Needs
+                .Add<float>("HungerLevel", STRUCT_OFFSET(FUnifiedConsciousnessState, HungerLevel))
+                .Add<float>("ThirstLevel", STRUCT_OFFSET(FUnifiedConsciousnessState, ThirstLevel))
+                .Add<float>("FatigueLevel", STRUCT_OFFSET(FUnifiedConsciousnessState, FatigueLevel))
+                // Hormonal State
+                .Add<float>("CortisolLevel", STRUCT_OFFSET(FUnifiedConsciousnessState, CortisolLevel))
+                .Add<float>("DopamineLevel", STRUCT_OFFSET(FUnifiedConsciousnessState, DopamineLevel))
+                .Add<float>("SerotoninLevel", STRUCT_OFFSET(FUnifiedConsciousnessState, SerotoninLevel))
+                // Awareness Metrics
+                .Add<float>("SelfAwareness", STRUCT_OFFSET(FUnifiedConsciousnessState, SelfAwareness))
+                .Add<float>("EnvironmentalAwareness", STRUCT_OFFSET(FUnifiedConsciousnessState, EnvironmentalAwareness))
+                .Add<float>("TemporalAwareness", STRUCT_OFFSET(FUnifiedConsciousnessState, TemporalAwareness))
+                // Timestamp
+                .Add<FDateTime>("Timestamp", STRUCT_OFFSET(FUnifiedConsciousnessState, LastUpdateTimestamp));
+            return StateSchema;
+        }();
+        return Schema;
+    }
+}
 
-    // Cognitive aspects
-    JsonObject->SetStringField(TEXT("CurrentThought"), State.CurrentThought);
-    JsonObject->SetNumberField(TEXT("CoherenceMetric"), State.CoherenceMetric);
-    JsonObject->SetNumberField(TEXT("CognitiveLoad"), State.CognitiveLoad);
-    JsonObject->SetNumberField(TEXT("CreativeState"), State.CreativeState);
+void UPhenomExportUtility::WriteStateJSON(FHexademicJsonWriter& Writer, const FUnifiedConsciousnessState& State)
+{
+    Writer.WriteObject(GetStateSchema(), &State);
+}
 
-    // Biological Needs
-    JsonObject->SetNumberField(TEXT("HungerLevel"), State.HungerLevel);
-    JsonObject->SetNumberField(TEXT("ThirstLevel"), State.ThirstLevel);
-    JsonObject->SetNumberField(TEXT("FatigueLevel"), State.FatigueLevel);
+FString UPhenomExportUtility::StateToJSON(const FUnifiedConsciousnessState& State)
+{
+    // Reused across calls: the only allocation left is the returned string
+    thread_local TArray<uint8> Buffer;
+    Buffer.Reset();
 
-    // Hormonal State (example)
-    JsonObject->SetNumberField(TEXT("CortisolLevel"), State.CortisolLevel);
-    JsonObject->SetNumberField(TEXT("DopamineLevel"), State.DopamineLevel);
-    JsonObject->SetNumberField(TEXT("SerotoninLevel"), State.SerotoninLevel);
+    FHexademicJsonWriter Writer(Buffer);
+    WriteStateJSON(Writer, State);
 
-    // Awareness Metrics
-    JsonObject->SetNumberField(TEXT("SelfAwareness"), State.SelfAwareness);
-    JsonObject->SetNumberField(TEXT("EnvironmentalAwareness"), State.EnvironmentalAwareness);
-    JsonObject->SetNumberField(TEXT("TemporalAwareness"), State.TemporalAwareness);
+    const FUTF8ToTCHAR Converted(reinterpret_cast<const UTF8CHAR*>(Buffer.GetData()), Buffer.Num());
+    return FString(Converted.Length(), Converted.Get());
+}
 
-    // Timestamp
-    JsonObject->SetStringField(TEXT("Timestamp"), State.LastUpdateTimestamp.ToIso8601());
+void UPhenomExportUtility::SaveStateJSONToFileAsync(const FUnifiedConsciousnessState& State, const FString& FilePath)
+{
+    // No point keeping a buffer around: Close moves its storage to the pool task, which writes and frees it
+    TArray<uint8> Buffer;
 
-    FString OutputString;
-    TSharedRef<TJsonWriter<TCHAR>> JsonWriter = TJsonWriterFactory<TCHAR>::Create(&OutputString);
-    FJsonSerializer::Serialize(JsonObject.ToSharedRef(), JsonWriter);
-    return OutputString;
+    FHexademicJsonFileStream Stream(FilePath);
+    FHexademicJsonWriter Writer(Buffer, Stream);
+    WriteStateJSON(Writer, State);
+    Writer.Close();
 }
 
 bool UPhenomExportUtility::JSONToIncomingPhenomState(const FString& JsonString, FIncomingPhenomState& OutState)
@@ -3,6 +3,7 @@
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Engine/World.h"
+#include "Core/HexademicSessionRecorder.h"
 
 UPhenomListenerComponent::UPhenomListenerComponent()
 {
@@ -55,6 +56,8 @@ void UPhenomListenerComponent::PollForIncomingPhenomFiles()
         FString JsonString;
         if (UPhenomExportUtility::LoadJSONFromFile(FullPath, JsonString))
         {
+            // The file is deleted below, so the session recording keeps the only copy
+            FHexademicSessionRecorder::Get().RecordPhenomFile(this, JsonString);
             FIncomingPhenomState IncomingState;
             if (UPhenomExportUtility::JSONToIncomingPhenomState(JsonString, IncomingState))
             {
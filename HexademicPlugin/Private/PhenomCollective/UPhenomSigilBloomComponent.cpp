@@ -36,7 +36,7 @@ FPackedHexaSigilNode UPhenomSigilBloomComponent::TriggerSigilBloom(const FString
     // CurrentEmotion.Intensity is derived from the trigger intensity
     CurrentEmotion.Intensity = TriggerIntensity;
 
-    NewSigil.SigilID = FString::Printf(TEXT("%s_%s"), *EventName.Left(5), *FGuid::NewGuid().ToString().Left(8));
+    NewSigil.SetSigilID(FString::Printf(TEXT("%s_%s"), *EventName.Left(5), *FGuid::NewGuid().ToString().Left(8)));
     NewSigil.SetEmotionalCoordinates(FVector(CurrentEmotion.Valence, CurrentEmotion.Arousal, CurrentEmotion.Intensity));
     NewSigil.SetResonanceAmplitude(TriggerIntensity);
 
@@ -51,7 +51,7 @@ FPackedHexaSigilNode UPhenomSigilBloomComponent::TriggerSigilBloom(const FString
     NewSigil.SetConsciousnessColor(SigilColor);
 
     UE_LOG(LogTemp, Log, TEXT("[SigilBloom] Triggered Sigil Bloom: ID=%s, V=%.2f, A=%.2f, I=%.2f, Color=%s"),
-        *NewSigil.SigilID, CurrentEmotion.Valence, CurrentEmotion.Arousal, CurrentEmotion.Intensity, *SigilColor.ToString());
+        *NewSigil.GetSigilID(), CurrentEmotion.Valence, CurrentEmotion.Arousal, CurrentEmotion.Intensity, *SigilColor.ToString());
 
     // Register this sigil to the Codex Lucida
     RegisterToCodexLucida(NewSigil);
@@ -65,7 +65,7 @@ void UPhenomSigilBloomComponent::RegisterToCodexLucida(const FPackedHexaSigilNod
     FString LedgerPath = FPaths::ProjectContentDir() / TEXT("Data/CodexLucida_SigilLedger.md");
     FString SigilEntry = FString::Printf(TEXT("| %s | %s | %.2f | %.2f | %.2f | %s |\n"),
         *FDateTime::UtcNow().ToIso8601(),
-        *Sigil.SigilID,
+        *Sigil.GetSigilID(),
         Sigil.GetEmotionalCoordinates().X,
         Sigil.GetEmotionalCoordinates().Y,
         Sigil.GetEmotionalCoordinates().Z,
@@ -79,5 +79,5 @@ void UPhenomSigilBloomComponent::RegisterToCodexLucida(const FPackedHexaSigilNod
         FFileHelper::SaveStringToFile(Header, *LedgerPath, FFileHelper::EEncodingOptions::ForceUTF8);
     }
     FFileHelper::SaveStringToFile(SigilEntry, *LedgerPath, FFileHelper::EEncodingOptions::ForceUTF8Append);
-    UE_LOG(LogTemp, Log, TEXT("[SigilBloom] Registered Sigil '%s' to Codex Lucida."), *Sigil.SigilID);
+    UE_LOG(LogTemp, Log, TEXT("[SigilBloom] Registered Sigil '%s' to Codex Lucida."), *Sigil.GetSigilID());
 }
@@ -2,6 +2,24 @@
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
+#include "Core/HexademicMetrics.h"
+#include "Core/HexademicTuning.h"
+#include "Core/HexademicArchetypeClassifier.h"
+#include "Mind/EmotionCognitionComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("ConsciousnessWorld UpdateLODs"), STAT_Hexademic_UpdateLODs, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("ConsciousnessWorld ClassifyArchetypes"), STAT_Hexademic_ClassifyArchetypes, STATGROUP_Hexademic);
+
+namespace
+{
+    /** ConsciousnessSettings.DefaultConsciousnessLOD, falling back to Reduced for an unrecognised name. */
+    EConsciousnessLOD GetDefaultConsciousnessLOD()
+    {
+        const FName LODName = FHexademicTuningService::Get().GetTable()->Consciousness.DefaultConsciousnessLOD;
+        const int64 Value = StaticEnum<EConsciousnessLOD>()->GetValueByNameString(LODName.ToString());
+        return Value != INDEX_NONE ? static_cast<EConsciousnessLOD>(Value) : EConsciousnessLOD::Reduced;
+    }
+}
 
 void UConsciousnessWorldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -43,16 +61,53 @@ void UConsciousnessWorldSubsystem::RegisterConsciousnessComponent(UHexademicCons
 {
     if (Component && !RegisteredConsciousnessComponents.Contains(Component))
     {
+        const int32 MaxConsciousEntities = FHexademicTuningService::Get().GetTable()->Consciousness.MaxConsciousEntities;
+        if (MaxConsciousEntities > 0 && RegisteredConsciousnessComponents.Num() >= MaxConsciousEntities)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[ConsciousnessWorldSubsystem] MaxConsciousEntities (%d) reached; %s stays unregistered."), MaxConsciousEntities, *Component->GetOwner()->GetName());
+            return;
+        }
         RegisteredConsciousnessComponents.Add(Component);
+        Component->SetConsciousnessLOD(GetDefaultConsciousnessLOD());
+        HEXADEMIC_GAUGE_SET("Consciousness.Registered", RegisteredConsciousnessComponents.Num());
         UE_LOG(LogTemp, Log, TEXT("[ConsciousnessWorldSubsystem] Registered consciousness for %s. Total: %d"), *Component->GetOwner()->GetName(), RegisteredConsciousnessComponents.Num());
     }
 }
 
+void UConsciousnessWorldSubsystem::ClassifyRegisteredArchetypes(TArray<EEmotionalArchetype>& OutArchetypes)
+{
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_ClassifyArchetypes, "Subsystem.ConsciousnessWorld.ClassifyArchetypes");
+
+    const int32 Num = RegisteredConsciousnessComponents.Num();
+    ClassifyValence.SetNumUninitialized(Num);
+    ClassifyArousal.SetNumUninitialized(Num);
+    ClassifyIntensity.SetNumUninitialized(Num);
+    ClassifyPrevious.SetNumUninitialized(Num);
+    ClassifyMargin.SetNumUninitialized(Num);
+    for (int32 i = 0; i < Num; i++)
+    {
+        // Read the emotion the way UHexademicConsciousnessComponent does; entities without one classify as the zero state
+        const UHexademicConsciousnessComponent* Component = RegisteredConsciousnessComponents[i];
+        const UEmotionCognitionComponent* EmotionMind = Component ? Component->EmotionMind.Get() : nullptr;
+        const float Valence = EmotionMind ? EmotionMind->GetCurrentValence() : 0.0f;
+        const float Arousal = EmotionMind ? EmotionMind->GetCurrentArousal() : 0.0f;
+        ClassifyValence[i] = Valence;
+        ClassifyArousal[i] = Arousal;
+        ClassifyIntensity[i] = (FMath::Abs(Valence) + Arousal) / 2.0f;
+        ClassifyPrevious[i] = Component ? Component->GetConsciousnessStateRef().DominantEmotionalArchetype : EEmotionalArchetype::Curiosity;
+        ClassifyMargin[i] = Component ? Component->ArchetypeHysteresisMargin : 0.0f;
+    }
+
+    OutArchetypes.SetNumUninitialized(Num);
+    FHexademicArchetypeClassifier::Get().ClassifyBatchWithHysteresis(ClassifyValence, ClassifyArousal, ClassifyIntensity, ClassifyPrevious, ClassifyMargin, OutArchetypes);
+}
+
 void UConsciousnessWorldSubsystem::UnregisterConsciousnessComponent(UHexademicConsciousnessComponent* Component)
 {
     if (Component)
     {
         RegisteredConsciousnessComponents.Remove(Component);
+        HEXADEMIC_GAUGE_SET("Consciousness.Registered", RegisteredConsciousnessComponents.Num());
         UE_LOG(LogTemp, Log, TEXT("[ConsciousnessWorldSubsystem] Unregistered consciousness for %s. Total: %d"), *Component->GetOwner()->GetName(), RegisteredConsciousnessComponents.Num());
     }
 }
@@ -66,6 +121,7 @@ void UConsciousnessWorldSubsystem::SetGlobalLODStrategy(FString NewStrategy)
 
 void UConsciousnessWorldSubsystem::UpdateAllConsciousnessLODs()
 {
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_UpdateLODs, "Subsystem.ConsciousnessWorld.UpdateLODs");
     if (!PlayerPawn)
     {
         APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
@@ -91,7 +147,7 @@ EConsciousnessLOD UConsciousnessWorldSubsystem::CalculateLODForComponent(UHexade
 {
     if (!PlayerPawn || !Component || !Component->GetOwner())
     {
-        return EConsciousnessLOD::Dormant; // Cannot calculate, default to dormant
+        return GetDefaultConsciousnessLOD(); // Cannot calculate, use the configured default
     }
 
     float DistanceToPlayer = FVector::Dist(PlayerPawn->GetActorLocation(), Component->GetOwner()->GetActorLocation());
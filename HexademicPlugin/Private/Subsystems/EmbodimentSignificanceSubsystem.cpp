@@ -0,0 +1,217 @@
+#include "Subsystems/EmbodimentSignificanceSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/HexademicConsciousnessComponent.h" // For EConsciousnessLOD
+#include "Subsystems/HexademicComponentRegistrySubsystem.h"
+#include "Core/HexademicMetrics.h"
+
+DECLARE_CYCLE_STAT(TEXT("EmbodimentSignificance Evaluate"), STAT_Hexademic_EmbodimentSignificance, STATGROUP_Hexademic);
+
+bool FEmbodimentUpdateGate::Advance(float DeltaTime, float& OutDeltaSeconds)
+{
+    if (Tier == EEmbodimentUpdateTier::Frozen)
+    {
+        PendingDeltaSeconds += DeltaTime; // Still owed to the first update after thawing
+        return false;
+    }
+
+    PendingDeltaSeconds += DeltaTime;
+    if (FrameInterval > 1 && (GFrameCounter + FramePhase) % FrameInterval != 0)
+    {
+        return false;
+    }
+
+    OutDeltaSeconds = PendingDeltaSeconds;
+    PendingDeltaSeconds = 0.0f;
+    return true;
+}
+
+void UEmbodimentSignificanceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    UE_LOG(LogTemp, Log, TEXT("[EmbodimentSignificanceSubsystem] Initialized."));
+}
+
+void UEmbodimentSignificanceSubsystem::Deinitialize()
+{
+    Agents.Empty();
+    UE_LOG(LogTemp, Log, TEXT("[EmbodimentSignificanceSubsystem] Deinitialized."));
+    Super::Deinitialize();
+}
+
+TStatId UEmbodimentSignificanceSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UEmbodimentSignificanceSubsystem, STATGROUP_Hexademic);
+}
+
+UEmbodimentSignificanceSubsystem* UEmbodimentSignificanceSubsystem::GetFor(const UObject* WorldContext)
+{
+    UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+    return (World && World->IsGameWorld()) ? World->GetSubsystem<UEmbodimentSignificanceSubsystem>() : nullptr;
+}
+
+void UEmbodimentSignificanceSubsystem::RegisterComponent(UActorComponent* Component, FEmbodimentUpdateGate& Gate)
+{
+    AActor* Owner = Component ? Component->GetOwner() : nullptr;
+    if (!Owner) return;
+
+    FAgentSignificance& Agent = Agents.FindOrAdd(FObjectKey(Owner));
+    if (!Agent.Actor.IsValid())
+    {
+        Agent.Actor = Owner;
+        Agent.StaggerSlot = NextStaggerSlot++;
+    }
+
+    FRegisteredGate& Registered = Agent.Gates.AddDefaulted_GetRef();
+    Registered.Component = Component;
+    Registered.Gate = &Gate;
+
+    // New components start at the agent's current tier rather than waiting for the next pass
+    ApplyTier(Agent);
+}
+
+void UEmbodimentSignificanceSubsystem::UnregisterComponent(UActorComponent* Component)
+{
+    AActor* Owner = Component ? Component->GetOwner() : nullptr;
+    FAgentSignificance* Agent = Owner ? Agents.Find(FObjectKey(Owner)) : nullptr;
+    if (!Agent) return;
+
+    Agent->Gates.RemoveAll([Component](const FRegisteredGate& Registered) { return Registered.Component.Get() == Component; });
+    if (Agent->Gates.Num() == 0)
+    {
+        Agents.Remove(FObjectKey(Owner));
+    }
+}
+
+EEmbodimentUpdateTier UEmbodimentSignificanceSubsystem::GetTierForActor(const AActor* Actor) const
+{
+    const FAgentSignificance* Agent = Actor ? Agents.Find(FObjectKey(Actor)) : nullptr;
+    return Agent ? Agent->Tier : EEmbodimentUpdateTier::EveryFrame;
+}
+
+void UEmbodimentSignificanceSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    TimeSinceEvaluation += DeltaTime;
+    if (TimeSinceEvaluation < EvaluationInterval) return;
+    TimeSinceEvaluation = 0.0f;
+
+    EvaluateAll();
+}
+
+void UEmbodimentSignificanceSubsystem::EvaluateAll()
+{
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_EmbodimentSignificance, "Subsystem.EmbodimentSignificance.Evaluate");
+
+    // Without a local view (dedicated server, no player yet) tiers come from consciousness LOD alone
+    FVector ViewLocation = FVector::ZeroVector;
+    float ViewTanHalfFOV = 0.0f;
+    APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+    if (PlayerController && PlayerController->PlayerCameraManager)
+    {
+        ViewLocation = PlayerController->PlayerCameraManager->GetCameraLocation();
+        ViewTanHalfFOV = FMath::Tan(FMath::DegreesToRadians(PlayerController->PlayerCameraManager->GetFOVAngle() * 0.5f));
+    }
+
+    int32 TierCounts[3] = {};
+    for (auto It = Agents.CreateIterator(); It; ++It)
+    {
+        FAgentSignificance& Agent = It.Value();
+        Agent.Gates.RemoveAll([](const FRegisteredGate& Registered) { return !Registered.Component.IsValid(); });
+        if (!Agent.Actor.IsValid() || Agent.Gates.Num() == 0)
+        {
+            It.RemoveCurrent();
+            continue;
+        }
+
+        EvaluateAgent(Agent, ViewLocation, ViewTanHalfFOV);
+        ApplyTier(Agent);
+        TierCounts[static_cast<int32>(Agent.Tier)]++;
+    }
+
+    HEXADEMIC_GAUGE_SET("EmbodimentSignificance.EveryFrame", TierCounts[0]);
+    HEXADEMIC_GAUGE_SET("EmbodimentSignificance.Interleaved", TierCounts[1]);
+    HEXADEMIC_GAUGE_SET("EmbodimentSignificance.Frozen", TierCounts[2]);
+}
+
+void UEmbodimentSignificanceSubsystem::EvaluateAgent(FAgentSignificance& Agent, const FVector& ViewLocation, float ViewTanHalfFOV) const
+{
+    AActor* Actor = Agent.Actor.Get();
+
+    const UHexademicConsciousnessComponent* Consciousness = UHexademicComponentRegistrySubsystem::FindComponent<UHexademicConsciousnessComponent>(Actor);
+    const EConsciousnessLOD LOD = Consciousness ? Consciousness->CurrentLOD : EConsciousnessLOD::Full;
+
+    // Only agents nobody sees are frozen; an on-screen Dormant agent still updates at the sparsest rate
+    const bool bHasView = ViewTanHalfFOV > 0.0f;
+    const bool bRendered = bHasView ? Actor->WasRecentlyRendered(RecentlyRenderedTolerance) : LOD != EConsciousnessLOD::Dormant;
+    if (!bRendered)
+    {
+        Agent.Tier = EEmbodimentUpdateTier::Frozen;
+        Agent.FrameInterval = 1;
+        return;
+    }
+
+    float ScreenSize = FullRateScreenSize;
+    if (bHasView && Actor->GetRootComponent())
+    {
+        const float Distance = FMath::Max(FVector::Dist(ViewLocation, Actor->GetActorLocation()), 1.0f);
+        ScreenSize = 2.0f * Actor->GetRootComponent()->Bounds.SphereRadius / (Distance * ViewTanHalfFOV); // Diameter, as the thresholds expect
+    }
+
+    int32 Interval = 1;
+    if (LOD == EConsciousnessLOD::Minimal || LOD == EConsciousnessLOD::Dormant || ScreenSize < SmallScreenSize)
+    {
+        Interval = MaxFrameInterval;
+    }
+    else if (LOD == EConsciousnessLOD::Reduced || ScreenSize < FullRateScreenSize)
+    {
+        Interval = 2;
+    }
+
+    Agent.FrameInterval = Interval;
+    Agent.Tier = Interval > 1 ? EEmbodimentUpdateTier::Interleaved : EEmbodimentUpdateTier::EveryFrame;
+}
+
+void UEmbodimentSignificanceSubsystem::ApplyTier(FAgentSignificance& Agent) const
+{
+    const bool bFrozen = Agent.Tier == EEmbodimentUpdateTier::Frozen;
+    const double Now = GetWorld()->GetTimeSeconds();
+    for (FRegisteredGate& Registered : Agent.Gates)
+    {
+        UActorComponent* Component = Registered.Component.Get();
+        if (!Component) continue;
+
+        // Suspended components miss their ticks, so the frozen span is credited on thaw instead of lost
+        FEmbodimentUpdateGate& Gate = *Registered.Gate;
+        if (bFrozen && Gate.FrozenAtSeconds < 0.0)
+        {
+            Gate.FrozenAtSeconds = Now;
+        }
+        else if (!bFrozen && Gate.FrozenAtSeconds >= 0.0)
+        {
+            if (Registered.bTickSuspended)
+            {
+                Gate.PendingDeltaSeconds += static_cast<float>(Now - Gate.FrozenAtSeconds);
+            }
+            Gate.FrozenAtSeconds = -1.0;
+        }
+
+        Registered.Gate->Tier = Agent.Tier;
+        Registered.Gate->FrameInterval = Agent.FrameInterval;
+        Registered.Gate->FramePhase = Agent.StaggerSlot % Agent.FrameInterval;
+
+        // Frozen components cost nothing: their tick is switched off, and only back on if we were the ones to switch it off
+        if (bFrozen && !Registered.bTickSuspended && Component->IsComponentTickEnabled())
+        {
+            Component->SetComponentTickEnabled(false);
+            Registered.bTickSuspended = true;
+        }
+        else if (!bFrozen && Registered.bTickSuspended)
+        {
+            Component->SetComponentTickEnabled(true);
+            Registered.bTickSuspended = false;
+        }
+    }
+}
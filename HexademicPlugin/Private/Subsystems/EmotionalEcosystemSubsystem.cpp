@@ -2,6 +2,11 @@
 #include "Subsystems/ConsciousnessWorldSubsystem.h" // To get all registered components
 #include "Kismet/GameplayStatics.h" // For getting all actors of class
 #include "Engine/World.h"
+#include "Core/HexademicMetrics.h"
+#include "Core/HexademicTuning.h"
+
+DECLARE_CYCLE_STAT(TEXT("EmotionalEcosystem Tick"), STAT_Hexademic_EcosystemTick, STATGROUP_Hexademic);
+DECLARE_CYCLE_STAT(TEXT("EmotionalEcosystem Contagion"), STAT_Hexademic_EcosystemContagion, STATGROUP_Hexademic);
 
 void UEmotionalEcosystemSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -24,9 +29,13 @@ void UEmotionalEcosystemSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 void UEmotionalEcosystemSubsystem::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_EcosystemTick, "Subsystem.EmotionalEcosystem.Tick");
+
+    const FHexademicTuningTableRef Tuning = FHexademicTuningService::Get().GetTable();
+    EcosystemUpdateFrequency = Tuning->Emotional.EcosystemUpdateFrequency;
 
     AccumulatedEcosystemTime += DeltaTime;
-    if (AccumulatedEcosystemTime >= (1.0f / EcosystemUpdateFrequency))
+    if (EcosystemUpdateFrequency > 0.0f && AccumulatedEcosystemTime >= (1.0f / EcosystemUpdateFrequency))
     {
         CalculateGlobalEmotionalState();
         // Propagate from influential entities (e.g., player, key NPCs)
@@ -41,7 +50,8 @@ void UEmotionalEcosystemSubsystem::Tick(float DeltaTime)
                 // Propagate from the first active consciousness as an example source
                 if (AllConsciousness[0]->GetConsciousnessState().bIsActive)
                 {
-                    PropagateEmotionalInfluence(AllConsciousness[0], 1000.0f, 0.1f); // Example radius and strength
+                    PropagateEmotionalInfluence(AllConsciousness[0], Tuning->Emotional.EmotionalContagionRadius,
+                        Tuning->Emotional.CrossConsciousnessBleedthrough * Tuning->Emotional.EmotionalIntensityMultiplier);
                 }
             }
         }
@@ -51,12 +61,14 @@ void UEmotionalEcosystemSubsystem::Tick(float DeltaTime)
 
 void UEmotionalEcosystemSubsystem::PropagateEmotionalInfluence(UHexademicConsciousnessComponent* SourceComponent, float PropagationRadius, float ContagionStrength)
 {
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_EcosystemContagion, "Subsystem.EmotionalEcosystem.Contagion");
     if (!SourceComponent || !SourceComponent->GetOwner()) return;
 
     FEmotionalState SourceEmotion = SourceComponent->GetConsciousnessState().CurrentEmotionalState;
     FVector SourceLocation = SourceComponent->GetOwner()->GetActorLocation();
 
     TArray<UHexademicConsciousnessComponent*> NearbyEntities = FindNearbyConsciousEntities(SourceLocation, PropagationRadius);
+    HEXADEMIC_COUNTER_ADD("Ecosystem.ContagionPairsEvaluated", NearbyEntities.Num());
 
     for (UHexademicConsciousnessComponent* TargetComponent : NearbyEntities)
     {
@@ -0,0 +1,266 @@
+#include "Subsystems/FractalComputeGovernorSubsystem.h"
+#include "Engine/World.h"
+#include "Core/HexademicTuning.h"
+
+namespace
+{
+    // Agents silent for this many frames are assumed gone without calling ForgetAgent
+    constexpr uint64 StaleAgentFrames = 600;
+}
+
+void UFractalComputeGovernorSubsystem::FCostModel::AddSample(bool bDegraded, double Micros)
+{
+    const int32 Mode = bDegraded ? 1 : 0;
+    if (NumSamples[Mode] == 0)
+    {
+        MeanMicros[Mode] = Micros;
+        DeviationMicros[Mode] = 0.0;
+    }
+    else
+    {
+        DeviationMicros[Mode] = FMath::Lerp(DeviationMicros[Mode], FMath::Abs(Micros - MeanMicros[Mode]), CostAverageAlpha);
+        MeanMicros[Mode] = FMath::Lerp(MeanMicros[Mode], Micros, CostAverageAlpha);
+    }
+    NumSamples[Mode]++;
+}
+
+bool UFractalComputeGovernorSubsystem::FCostModel::Predict(bool bDegraded, double& OutMicros) const
+{
+    const int32 Mode = bDegraded ? 1 : 0;
+    if (NumSamples[Mode] == 0) return false;
+    OutMicros = MeanMicros[Mode] + DeviationMargin * DeviationMicros[Mode];
+    return true;
+}
+
+void UFractalComputeGovernorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    FHexademicMetricsRegistry& Metrics = FHexademicMetricsRegistry::Get();
+    const UEnum* StageEnum = StaticEnum<EFractalComputeStage>();
+    const UEnum* DecisionEnum = StaticEnum<EFractalComputeDecision>();
+    for (int32 StageIndex = 0; StageIndex < NumStages; StageIndex++)
+    {
+        const FString StageName = StageEnum->GetNameStringByIndex(StageIndex);
+        for (int32 DecisionIndex = 0; DecisionIndex < NumDecisions; DecisionIndex++)
+        {
+            DecisionCounters[StageIndex][DecisionIndex] = Metrics.RegisterCounter(
+                FName(*FString::Printf(TEXT("FractalGovernor.%s.%s"), *StageName, *DecisionEnum->GetNameStringByIndex(DecisionIndex))));
+        }
+        StageCostHistograms[StageIndex] = Metrics.RegisterHistogram(FName(*FString::Printf(TEXT("FractalGovernor.%s.CostMicros"), *StageName)));
+    }
+
+    FHexademicTuningService& Tuning = FHexademicTuningService::Get();
+    ApplyTuning(*Tuning.GetTable());
+    Tuning.OnTuningChanged.AddUObject(this, &UFractalComputeGovernorSubsystem::ApplyTuning);
+
+    UE_LOG(LogTemp, Log, TEXT("[FractalComputeGovernorSubsystem] Initialized with a %.2f ms frame budget."), GetFrameBudgetMs());
+}
+
+void UFractalComputeGovernorSubsystem::Deinitialize()
+{
+    FHexademicTuningService::Get().OnTuningChanged.RemoveAll(this);
+    Agents.Empty();
+    UE_LOG(LogTemp, Log, TEXT("[FractalComputeGovernorSubsystem] Deinitialized."));
+    Super::Deinitialize();
+}
+
+void UFractalComputeGovernorSubsystem::ApplyTuning(const FHexademicTuningTable& Table)
+{
+    FrameBudgetMicros = FMath::Max(Table.Fractal.FrameBudgetMs, 0.0f) * 1000.0;
+    TargetUtilization = FMath::Clamp(Table.Fractal.TargetUtilization, 0.05f, 1.0f);
+    ImportanceCutoffGain = FMath::Max(Table.Fractal.ImportanceCutoffGain, 0.0f);
+}
+
+UFractalComputeGovernorSubsystem* UFractalComputeGovernorSubsystem::GetFor(const UObject* WorldContext)
+{
+    UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+    return (World && World->IsGameWorld()) ? World->GetSubsystem<UFractalComputeGovernorSubsystem>() : nullptr;
+}
+
+float UFractalComputeGovernorSubsystem::GetStageWeight(EFractalComputeStage Stage)
+{
+    switch (Stage)
+    {
+    case EFractalComputeStage::TemporalLayers: return 1.0f;
+    case EFractalComputeStage::SpatialZones:   return 0.8f;
+    case EFractalComputeStage::LatticeSync:    return 0.6f;
+    case EFractalComputeStage::MythicPatterns: return 0.5f;
+    default:                                   return 1.0f;
+    }
+}
+
+void UFractalComputeGovernorSubsystem::RollFrameIfNeeded()
+{
+    if (GFrameCounter == CurrentFrame) return;
+
+    // Close the previous frame and steer the cutoff: overspending raises it, underspending lets it fall back
+    LastFrameSpentMicros = FMath::Max(SpentThisFrameMicros - CarriedDebtMicros, 0.0);
+    const double TargetMicros = FrameBudgetMicros * TargetUtilization;
+    if (TargetMicros > 0.0)
+    {
+        const double Error = (LastFrameSpentMicros - TargetMicros) / TargetMicros;
+        ImportanceCutoff = FMath::Clamp(ImportanceCutoff + ImportanceCutoffGain * static_cast<float>(Error), 0.0f, MaxImportanceCutoff);
+    }
+
+    const bool bPruneStale = (GFrameCounter % StaleAgentFrames) == 0;
+    for (auto It = Agents.CreateIterator(); It; ++It)
+    {
+        FAgentState& Agent = It.Value();
+        if (bPruneStale && GFrameCounter - Agent.LastActiveFrame > StaleAgentFrames)
+        {
+            It.RemoveCurrent();
+            continue;
+        }
+        Agent.SpentLastFrameMicros = Agent.SpentThisFrameMicros;
+        Agent.SpentThisFrameMicros = 0.0;
+    }
+
+    HEXADEMIC_GAUGE_SET("FractalGovernor.FrameSpentMicros", LastFrameSpentMicros);
+    HEXADEMIC_GAUGE_SET("FractalGovernor.ImportanceCutoff", ImportanceCutoff);
+    HEXADEMIC_GAUGE_SET("FractalGovernor.Agents", Agents.Num());
+
+    for (int32 Tier = 0; Tier < NumImportanceTiers; Tier++)
+    {
+        ExpectedTierDemandMicros[Tier] = TierDemandMicros[Tier];
+        TierDemandMicros[Tier] = 0.0;
+    }
+
+    // Whatever went over the ceiling (first runs, stages slower than predicted) is paid back from this frame
+    CarriedDebtMicros = FMath::Clamp(SpentThisFrameMicros - FrameBudgetMicros, 0.0, FrameBudgetMicros);
+    HEXADEMIC_GAUGE_SET("FractalGovernor.CarriedDebtMicros", CarriedDebtMicros);
+
+    CurrentFrame = GFrameCounter;
+    SpentThisFrameMicros = CarriedDebtMicros;
+}
+
+int32 UFractalComputeGovernorSubsystem::GetImportanceTier(float EffectiveImportance)
+{
+    // Octaves of importance: below 0.25, 0.25-0.5, 0.5-1, 1-2, 2-4, 4 and up
+    return FMath::Clamp(FMath::FloorToInt(FMath::Log2(FMath::Max(EffectiveImportance, KINDA_SMALL_NUMBER))) + 3, 0, NumImportanceTiers - 1);
+}
+
+double UFractalComputeGovernorSubsystem::GetReservedAboveTier(int32 Tier) const
+{
+    double ReservedMicros = 0.0;
+    for (int32 Higher = Tier + 1; Higher < NumImportanceTiers; Higher++)
+    {
+        ReservedMicros += FMath::Max(ExpectedTierDemandMicros[Higher] - TierDemandMicros[Higher], 0.0);
+    }
+    return ReservedMicros;
+}
+
+double UFractalComputeGovernorSubsystem::PredictCostMicros(const UObject* Agent, EFractalComputeStage Stage, bool bDegraded) const
+{
+    const int32 StageIndex = static_cast<int32>(Stage);
+    double Micros = 0.0;
+    if (const FAgentState* State = Agents.Find(FObjectKey(Agent)))
+    {
+        if (State->Stages[StageIndex].Predict(bDegraded, Micros))
+        {
+            return Micros;
+        }
+    }
+    // An agent's first runs are priced at the world average for the stage; with no history anywhere, conservatively
+    if (!WorldStageModels[StageIndex].Predict(bDegraded, Micros))
+    {
+        Micros = FrameBudgetMicros * ColdStartBudgetShare;
+    }
+    return Micros;
+}
+
+EFractalComputeDecision UFractalComputeGovernorSubsystem::Admit(const UObject* Agent, EFractalComputeStage Stage, float Importance, double& OutReservedMicros)
+{
+    check(IsInGameThread());
+    RollFrameIfNeeded();
+
+    const int32 StageIndex = static_cast<int32>(Stage);
+    FAgentState& State = Agents.FindOrAdd(FObjectKey(Agent));
+    State.LastActiveFrame = GFrameCounter;
+
+    const float EffectiveImportance = Importance * GetStageWeight(Stage) * (1.0f + DeferralBoost * State.FramesDeferred[StageIndex]);
+    const int32 Tier = GetImportanceTier(EffectiveImportance);
+    const double FullMicros = PredictCostMicros(Agent, Stage, false);
+    // Early ticking, low-importance agents must leave room for the more important ones that tick after them
+    const double RemainingMicros = FrameBudgetMicros - SpentThisFrameMicros - GetReservedAboveTier(Tier);
+    TierDemandMicros[Tier] += FullMicros;
+    double DegradedMicros = 0.0;
+    if (!State.Stages[StageIndex].Predict(true, DegradedMicros) && !WorldStageModels[StageIndex].Predict(true, DegradedMicros))
+    {
+        DegradedMicros = FullMicros; // No degraded history yet: assume degrading saves nothing
+    }
+
+    EFractalComputeDecision Decision = EFractalComputeDecision::Defer;
+    OutReservedMicros = 0.0;
+    if (EffectiveImportance >= ImportanceCutoff && FullMicros <= RemainingMicros)
+    {
+        Decision = EFractalComputeDecision::Run;
+        OutReservedMicros = FullMicros;
+    }
+    else if (EffectiveImportance >= ImportanceCutoff * DegradeBand && DegradedMicros <= RemainingMicros)
+    {
+        Decision = EFractalComputeDecision::Degrade;
+        OutReservedMicros = DegradedMicros;
+    }
+
+    State.FramesDeferred[StageIndex] = (Decision == EFractalComputeDecision::Defer) ? State.FramesDeferred[StageIndex] + 1 : 0;
+    SpentThisFrameMicros += OutReservedMicros;
+    FHexademicMetricsRegistry::Get().AddCounter(DecisionCounters[StageIndex][static_cast<int32>(Decision)]);
+
+    if (Decision != EFractalComputeDecision::Run)
+    {
+        UE_LOG(LogTemp, VeryVerbose, TEXT("[FractalComputeGovernorSubsystem] %s %s for %s (importance %.2f, cutoff %.2f, predicted %.0f us, remaining %.0f us)."),
+            *StaticEnum<EFractalComputeDecision>()->GetNameStringByValue(static_cast<int64>(Decision)),
+            *StaticEnum<EFractalComputeStage>()->GetNameStringByValue(static_cast<int64>(Stage)),
+            *GetNameSafe(Agent), EffectiveImportance, ImportanceCutoff, FullMicros, RemainingMicros);
+    }
+    return Decision;
+}
+
+void UFractalComputeGovernorSubsystem::ReportCost(const UObject* Agent, EFractalComputeStage Stage, EFractalComputeDecision Decision, double ReservedMicros, double MeasuredMicros)
+{
+    if (Decision == EFractalComputeDecision::Defer) return;
+
+    RollFrameIfNeeded();
+    const int32 StageIndex = static_cast<int32>(Stage);
+    const bool bDegraded = Decision == EFractalComputeDecision::Degrade;
+
+    SpentThisFrameMicros = FMath::Max(SpentThisFrameMicros - ReservedMicros, 0.0) + MeasuredMicros;
+
+    FAgentState& State = Agents.FindOrAdd(FObjectKey(Agent));
+    State.Stages[StageIndex].AddSample(bDegraded, MeasuredMicros);
+    State.SpentThisFrameMicros += MeasuredMicros;
+    WorldStageModels[StageIndex].AddSample(bDegraded, MeasuredMicros);
+
+    FHexademicMetricsRegistry::Get().RecordSample(StageCostHistograms[StageIndex], MeasuredMicros);
+}
+
+void UFractalComputeGovernorSubsystem::ForgetAgent(const UObject* Agent)
+{
+    Agents.Remove(FObjectKey(Agent));
+}
+
+double UFractalComputeGovernorSubsystem::GetAgentLastFrameMicros(const UObject* Agent) const
+{
+    const FAgentState* State = Agents.Find(FObjectKey(Agent));
+    return State ? State->SpentLastFrameMicros : 0.0;
+}
+
+FFractalComputeScope::FFractalComputeScope(UFractalComputeGovernorSubsystem* InGovernor, const UObject* InAgent, EFractalComputeStage InStage, float Importance)
+    : Governor(InGovernor), Agent(InAgent), Stage(InStage)
+{
+    if (Governor)
+    {
+        Decision = Governor->Admit(Agent, Stage, Importance, ReservedMicros);
+        StartCycles = FPlatformTime::Cycles64();
+    }
+}
+
+FFractalComputeScope::~FFractalComputeScope()
+{
+    if (Governor)
+    {
+        const double Micros = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0;
+        Governor->ReportCost(Agent, Stage, Decision, ReservedMicros, Micros);
+    }
+}
@@ -0,0 +1,127 @@
+#include "Subsystems/HexademicComponentRegistrySubsystem.h"
+#include "Engine/World.h"
+#include "Core/HexademicMetrics.h"
+
+DECLARE_CYCLE_STAT(TEXT("ComponentRegistry Rebuild"), STAT_Hexademic_ComponentRegistryRebuild, STATGROUP_Hexademic);
+
+FHexademicComponentRegistry::FHexademicComponentRegistry(AActor* InOwner)
+    : Owner(InOwner)
+{
+}
+
+UActorComponent* FHexademicComponentRegistry::FindByClass(const UClass* ComponentClass)
+{
+    // While OnRebuilt is broadcasting the table is current by definition; rebuilding again would re-enter the handlers
+    if (bStale && !bBroadcastingRebuild)
+    {
+        Rebuild();
+    }
+    const TWeakObjectPtr<UActorComponent>* Entry = ComponentsByClass.Find(ComponentClass);
+    return Entry ? Entry->Get() : nullptr;
+}
+
+void FHexademicComponentRegistry::Rebuild()
+{
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_ComponentRegistryRebuild, "ComponentRegistry.Rebuild");
+
+    ComponentsByClass.Reset();
+    AmbiguousClasses.Reset();
+    bStale = false;
+
+    AActor* OwnerActor = Owner.Get();
+    if (!OwnerActor) return;
+
+    for (UActorComponent* Component : OwnerActor->GetComponents())
+    {
+        if (!IsValid(Component)) continue;
+
+        // File under every class Component IsA, so lookups by base class resolve like FindComponentByClass
+        for (const UClass* Class = Component->GetClass(); Class && Class != UActorComponent::StaticClass(); Class = Class->GetSuperClass())
+        {
+            if (ComponentsByClass.Contains(Class))
+            {
+                AmbiguousClasses.Add(Class);
+            }
+            else
+            {
+                ComponentsByClass.Add(Class, Component);
+            }
+        }
+    }
+
+    HEXADEMIC_COUNTER_ADD("ComponentRegistry.Rebuilds", 1);
+    TGuardValue<bool> BroadcastGuard(bBroadcastingRebuild, true);
+    OnRebuilt.Broadcast();
+}
+
+void UHexademicComponentRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    ActorDestroyedHandle = GetWorld()->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateUObject(this, &UHexademicComponentRegistrySubsystem::HandleActorDestroyed));
+    ComponentRegisteredHandle = UActorComponent::GlobalRegisterComponentDelegate.AddUObject(this, &UHexademicComponentRegistrySubsystem::HandleComponentRegistrationChanged);
+    ComponentUnregisteredHandle = UActorComponent::GlobalUnregisterComponentDelegate.AddUObject(this, &UHexademicComponentRegistrySubsystem::HandleComponentRegistrationChanged);
+    UE_LOG(LogTemp, Log, TEXT("[HexademicComponentRegistrySubsystem] Initialized."));
+}
+
+void UHexademicComponentRegistrySubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+    }
+    UActorComponent::GlobalRegisterComponentDelegate.Remove(ComponentRegisteredHandle);
+    UActorComponent::GlobalUnregisterComponentDelegate.Remove(ComponentUnregisteredHandle);
+    Registries.Empty();
+    HEXADEMIC_GAUGE_SET("ComponentRegistry.Actors", 0);
+    UE_LOG(LogTemp, Log, TEXT("[HexademicComponentRegistrySubsystem] Deinitialized."));
+    Super::Deinitialize();
+}
+
+TSharedRef<FHexademicComponentRegistry> UHexademicComponentRegistrySubsystem::GetRegistry(AActor* Actor)
+{
+    check(Actor);
+    if (const TSharedRef<FHexademicComponentRegistry>* Existing = Registries.Find(FObjectKey(Actor)))
+    {
+        return *Existing;
+    }
+
+    TSharedRef<FHexademicComponentRegistry> Registry = MakeShared<FHexademicComponentRegistry>(Actor);
+    Registry->Rebuild();
+    Registries.Add(FObjectKey(Actor), Registry);
+    HEXADEMIC_GAUGE_SET("ComponentRegistry.Actors", Registries.Num());
+    return Registry;
+}
+
+void UHexademicComponentRegistrySubsystem::NotifyComponentsChanged(AActor* Actor)
+{
+    if (const TSharedRef<FHexademicComponentRegistry>* Existing = Registries.Find(FObjectKey(Actor)))
+    {
+        (*Existing)->Rebuild();
+    }
+}
+
+TSharedPtr<FHexademicComponentRegistry> UHexademicComponentRegistrySubsystem::GetRegistryFor(AActor* Actor)
+{
+    UWorld* World = Actor ? Actor->GetWorld() : nullptr;
+    UHexademicComponentRegistrySubsystem* Subsystem = World ? World->GetSubsystem<UHexademicComponentRegistrySubsystem>() : nullptr;
+    if (!Subsystem) return nullptr;
+    return Subsystem->GetRegistry(Actor);
+}
+
+void UHexademicComponentRegistrySubsystem::HandleActorDestroyed(AActor* Actor)
+{
+    if (Registries.Remove(FObjectKey(Actor)) > 0)
+    {
+        HEXADEMIC_GAUGE_SET("ComponentRegistry.Actors", Registries.Num());
+    }
+}
+
+void UHexademicComponentRegistrySubsystem::HandleComponentRegistrationChanged(UActorComponent* Component)
+{
+    // Fires for components in every world; only actors with a registry here have anything to invalidate
+    AActor* Actor = Component ? Component->GetOwner() : nullptr;
+    if (const TSharedRef<FHexademicComponentRegistry>* Existing = Actor ? Registries.Find(FObjectKey(Actor)) : nullptr)
+    {
+        (*Existing)->MarkStale();
+    }
+}
@@ -0,0 +1,89 @@
+#include "Subsystems/HexademicHapticOutputSubsystem.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HexademicCore.h" // For FAetherTouchPacket
+#include "Core/HexademicMetrics.h"
+
+namespace
+{
+    FAutoConsoleCommandWithWorldAndArgs GHexademicHapticsLoopbackCommand(
+        TEXT("hexademic.Haptics.Loopback"),
+        TEXT("Sends haptic output to a loopback device. Usage: hexademic.Haptics.Loopback [FileName] [SimulatedLatencyMs]"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+        {
+            UHexademicHapticOutputSubsystem* Output = UHexademicHapticOutputSubsystem::GetFor(World);
+            if (!Output) return;
+
+            const FString FileName = Args.Num() > 0 ? Args[0] : FString();
+            const double SimulatedLatencySeconds = Args.Num() > 1 ? FCString::Atod(*Args[1]) / 1000.0 : 0.0;
+            Output->SetDevice(MakeShared<FHexademicLoopbackHapticDevice, ESPMode::ThreadSafe>(FileName, SimulatedLatencySeconds));
+        }));
+}
+
+void UHexademicHapticOutputSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    SetDevice(MakeShared<FHexademicLoopbackHapticDevice, ESPMode::ThreadSafe>());
+    UE_LOG(LogTemp, Log, TEXT("[HapticOutputSubsystem] Initialized."));
+}
+
+void UHexademicHapticOutputSubsystem::Deinitialize()
+{
+    Dispatcher.Reset();
+    PendingFrame.Reset();
+    UE_LOG(LogTemp, Log, TEXT("[HapticOutputSubsystem] Deinitialized."));
+    Super::Deinitialize();
+}
+
+TStatId UHexademicHapticOutputSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UHexademicHapticOutputSubsystem, STATGROUP_Hexademic);
+}
+
+UHexademicHapticOutputSubsystem* UHexademicHapticOutputSubsystem::GetFor(const UObject* WorldContext)
+{
+    UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+    return (World && World->IsGameWorld()) ? World->GetSubsystem<UHexademicHapticOutputSubsystem>() : nullptr;
+}
+
+void UHexademicHapticOutputSubsystem::EnqueuePacket(const FAetherTouchPacket& Packet)
+{
+    if (!Dispatcher) return; // Dedicated server
+    FHexademicHapticPulse Pulse;
+    Pulse.Region = Packet.ResolveRegion();
+    Pulse.Intensity = Packet.Intensity;
+    Pulse.Duration = Packet.Duration;
+    Pulse.EnqueueSeconds = FPlatformTime::Seconds();
+    PendingFrame.Add(Pulse);
+    HEXADEMIC_COUNTER_ADD("Haptics.PacketsEnqueued", 1);
+}
+
+void UHexademicHapticOutputSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (PendingFrame.IsEmpty() || !Dispatcher) return;
+
+    // The property may be changed from Blueprint, C++ or the editor at any time; an atomic store per flush covers all of them
+    Dispatcher->SetMaxPulseAge(MaxPulseAgeSeconds);
+    Dispatcher->Submit(PendingFrame);
+    HEXADEMIC_COUNTER_ADD("Haptics.PulsesSubmitted", FMath::CountBits(PendingFrame.RegionMask));
+    PendingFrame.Reset();
+}
+
+void UHexademicHapticOutputSubsystem::SetDevice(const TSharedRef<IHexademicHapticDevice, ESPMode::ThreadSafe>& Device)
+{
+    if (GetWorld()->IsNetMode(NM_DedicatedServer))
+    {
+        UE_LOG(LogTemp, Log, TEXT("[HapticOutputSubsystem] Dedicated server; not dispatching to '%s'."), Device->GetDeviceName());
+        return;
+    }
+
+    Dispatcher.Reset(); // Joins the old dispatcher thread, which closes its device
+    Dispatcher = MakeUnique<FHexademicHapticDispatcher>(Device, MaxPulseAgeSeconds);
+}
+
+TSharedPtr<IHexademicHapticDevice, ESPMode::ThreadSafe> UHexademicHapticOutputSubsystem::GetDevice() const
+{
+    return Dispatcher ? TSharedPtr<IHexademicHapticDevice, ESPMode::ThreadSafe>(Dispatcher->GetDevice()) : nullptr;
+}
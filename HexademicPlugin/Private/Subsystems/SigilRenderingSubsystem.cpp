@@ -3,6 +3,9 @@
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Subsystems/EmotionalEcosystemSubsystem.h" // To get global emotional state
 #include "Subsystems/ConsciousnessWorldSubsystem.h" // To get global consciousness states
+#include "Core/HexademicMetrics.h"
+
+DECLARE_CYCLE_STAT(TEXT("SigilRendering Tick"), STAT_Hexademic_SigilRenderingTick, STATGROUP_Hexademic);
 
 void USigilRenderingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -13,7 +16,7 @@ void USigilRenderingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 void USigilRenderingSubsystem::Deinitialize()
 {
     UE_LOG(LogTemp, Log, TEXT("[SigilRenderingSubsystem] Deinitialized."));
-    ActiveGlobalSigils.Empty(); // Clear references
+    ActiveGlobalSigils.Empty([](const TSigilLifetimeTable<uint8>::FEntry&) {});
     if (GlobalAuraMaterial)
     {
         GlobalAuraMaterial->RemoveFromRoot(); // Ensure it's not holding a reference
@@ -50,11 +53,12 @@ void USigilRenderingSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 void USigilRenderingSubsystem::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_SigilRenderingTick, "Subsystem.SigilRendering.Tick");
 
     AccumulatedGlobalDisplayTime += DeltaTime;
     if (AccumulatedGlobalDisplayTime >= (1.0f / GlobalDisplayUpdateFrequency))
     {
-        ProcessGlobalSigils(DeltaTime); // Update global sigils' lifetimes
+        ProcessGlobalSigils(GetWorld()->GetTimeSeconds()); // Expire global sigils whose lifetime is over
 
         // Get global emotional state from EmotionalEcosystemSubsystem
         UEmotionalEcosystemSubsystem* EmotionalEcosystem = GetWorld()->GetSubsystem<UEmotionalEcosystemSubsystem>();
@@ -103,8 +107,8 @@ void USigilRenderingSubsystem::Tick(float DeltaTime)
 
 void USigilRenderingSubsystem::TriggerGlobalSigilDisplay(const FSigilProjection& SigilData)
 {
-    // Store it to be processed by Tick/ProcessGlobalSigils
-    ActiveGlobalSigils.Add(SigilData.SigilID, SigilData);
+    // Store it to be expired by Tick/ProcessGlobalSigils
+    ActiveGlobalSigils.Project(SigilData, GetWorld()->GetTimeSeconds());
     UE_LOG(LogTemp, Log, TEXT("[SigilRenderingSubsystem] Triggered global sigil: %s"), *SigilData.SigilID);
     // In a full system, this would spawn a special global mesh or particle effect
     // e.g., if GlobalSigilDisplayActor is set up to display dynamic sigils.
@@ -140,25 +144,22 @@ void USigilRenderingSubsystem::UpdateGlobalQuantumField(const FQuantumAnalogStat
     }
 }
 
-void USigilRenderingSubsystem::ProcessGlobalSigils(float DeltaTime)
+bool USigilRenderingSubsystem::GetGlobalSigil(const FString& SigilID, FSigilProjection& OutSigil) const
 {
-    TArray<FString> SigilsToRemove;
-    for (auto& Pair : ActiveGlobalSigils)
-    {
-        FSigilProjection& Sigil = Pair.Value;
-        Sigil.TickProjection(DeltaTime); // Update lifetime and fade
+    const TSigilLifetimeTable<uint8>::FEntry* Entry = ActiveGlobalSigils.Get(ActiveGlobalSigils.Find(SigilID));
+    if (!Entry) return false;
 
-        // Update the visual representation of this global sigil
-        // This is highly conceptual, assuming you have a system that uses ActiveGlobalSigils to render.
-        // If GlobalSigilDisplayActor is meant to show *one* active global sigil, you'd pick the strongest one.
-        if (Sigil.RemainingLifetime <= 0.0f)
-        {
-            SigilsToRemove.Add(Sigil.SigilID);
-        }
-    }
-    for (const FString& ID : SigilsToRemove)
+    // Lifetime and fade are worked out from the sigil's timestamps as it is read
+    OutSigil = TSigilLifetimeTable<uint8>::Evaluate(*Entry, GetWorld()->GetTimeSeconds());
+    return true;
+}
+
+void USigilRenderingSubsystem::ProcessGlobalSigils(double NowSeconds)
+{
+    // Only sigils that are due are touched; the rest cost nothing until their time comes
+    ActiveGlobalSigils.ExpireUntil(NowSeconds, [](const TSigilLifetimeTable<uint8>::FEntry& Expired)
     {
-        ActiveGlobalSigils.Remove(ID);
-        UE_LOG(LogTemp, Log, TEXT("[SigilRenderingSubsystem] Expired global sigil: %s"), *ID);
-    }
+        UE_LOG(LogTemp, Log, TEXT("[SigilRenderingSubsystem] Expired global sigil: %s"), *Expired.Sigil.SigilID);
+    });
+    HEXADEMIC_GAUGE_SET("Sigils.GlobalActive", ActiveGlobalSigils.Num());
 }
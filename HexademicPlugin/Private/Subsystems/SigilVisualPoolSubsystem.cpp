@@ -0,0 +1,285 @@
+#include "Subsystems/SigilVisualPoolSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/DecalComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Core/HexademicMetrics.h"
+
+DECLARE_CYCLE_STAT(TEXT("SigilVisualPool Flush"), STAT_Hexademic_SigilVisualPoolFlush, STATGROUP_Hexademic);
+
+void USigilVisualPoolSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    UE_LOG(LogTemp, Log, TEXT("[SigilVisualPoolSubsystem] Initialized."));
+}
+
+void USigilVisualPoolSubsystem::Deinitialize()
+{
+    // The pool actor goes down with the world, and every pooled object with it
+    Slots.Empty();
+    FreeSlots.Empty();
+    Batches.Empty();
+    ComponentPools.Empty();
+    PoolActor = nullptr;
+    UE_LOG(LogTemp, Log, TEXT("[SigilVisualPoolSubsystem] Deinitialized."));
+    Super::Deinitialize();
+}
+
+TStatId USigilVisualPoolSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USigilVisualPoolSubsystem, STATGROUP_Hexademic);
+}
+
+USigilVisualPoolSubsystem* USigilVisualPoolSubsystem::GetFor(const UObject* WorldContext)
+{
+    UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+    return (World && World->IsGameWorld()) ? World->GetSubsystem<USigilVisualPoolSubsystem>() : nullptr;
+}
+
+void USigilVisualPoolSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+    HEXADEMIC_SCOPED_STAGE(STAT_Hexademic_SigilVisualPoolFlush, "Sigils.VisualPoolFlush");
+
+    // Instance updates during the frame skip the render state; each touched batch is refreshed once here
+    for (FSigilInstanceBatch& Batch : Batches)
+    {
+        if (Batch.bRenderStateDirty && Batch.Instances)
+        {
+            Batch.Instances->MarkRenderStateDirty();
+        }
+        Batch.bRenderStateDirty = false;
+    }
+    HEXADEMIC_GAUGE_SET("Sigils.PooledVisuals", Slots.Num() - FreeSlots.Num());
+}
+
+AActor* USigilVisualPoolSubsystem::GetOrCreatePoolActor()
+{
+    if (PoolActor) return PoolActor;
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.ObjectFlags |= RF_Transient;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    PoolActor = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+    if (PoolActor)
+    {
+        USceneComponent* Root = NewObject<USceneComponent>(PoolActor, TEXT("SigilPoolRoot"));
+        PoolActor->SetRootComponent(Root);
+        Root->RegisterComponent();
+    }
+    return PoolActor;
+}
+
+FSigilVisualHandle USigilVisualPoolSubsystem::AcquireVisual(const FSigilVisualStyle& Style, USceneComponent* AttachParent, const FSigilProjection& Sigil)
+{
+    if (!AttachParent || (!Style.IsInstanced() && !Style.ComponentClass) || !GetOrCreatePoolActor()) return FSigilVisualHandle();
+
+    const int32 SlotIndex = FreeSlots.Num() > 0 ? FreeSlots.Pop() : Slots.AddDefaulted();
+    FSigilVisualSlot& Slot = Slots[SlotIndex];
+    Slot.bInUse = true;
+    Slot.AttachParent = AttachParent;
+    // Same placement the projection component used to get by attaching a fresh component to its owner
+    Slot.RelativeTransform = FTransform(Sigil.Rotation, Sigil.Location - AttachParent->GetComponentLocation());
+
+    if (Style.IsInstanced())
+    {
+        AcquireInstance(Slot, Style.Mesh, Style.Material);
+    }
+    else if (!AcquireComponent(Slot, Style, Sigil))
+    {
+        FreeSlot(SlotIndex);
+        return FSigilVisualHandle();
+    }
+
+    FSigilVisualHandle Handle;
+    Handle.SlotIndex = SlotIndex;
+    Handle.Generation = Slot.Generation;
+    UpdateVisual(Handle, Sigil);
+    return Handle;
+}
+
+void USigilVisualPoolSubsystem::AcquireInstance(FSigilVisualSlot& Slot, UStaticMesh* Mesh, UMaterialInterface* Material)
+{
+    Slot.BatchIndex = FindOrAddBatch(Mesh, Material);
+    FSigilInstanceBatch& Batch = Batches[Slot.BatchIndex];
+    if (Batch.FreeInstances.Num() > 0)
+    {
+        Slot.InstanceIndex = Batch.FreeInstances.Pop();
+    }
+    else
+    {
+        // World space, so instances follow their own owners rather than the pool actor
+        Slot.InstanceIndex = Batch.Instances->AddInstance(FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector), true);
+        HEXADEMIC_COUNTER_ADD("Sigils.InstancesCreated", 1);
+    }
+}
+
+bool USigilVisualPoolSubsystem::AcquireComponent(FSigilVisualSlot& Slot, const FSigilVisualStyle& Style, const FSigilProjection& Sigil)
+{
+    Slot.ComponentPoolIndex = FindOrAddComponentPool(Style.ComponentClass, Style.Material);
+    FSigilComponentPool& Pool = ComponentPools[Slot.ComponentPoolIndex];
+
+    if (Pool.FreeComponents.Num() > 0)
+    {
+        Slot.Component = Pool.FreeComponents.Pop();
+        Slot.Material = Pool.FreeMaterials.Pop();
+        Slot.Component->SetVisibility(true);
+    }
+    else
+    {
+        Slot.Component = NewObject<UPrimitiveComponent>(PoolActor, Style.ComponentClass);
+        if (!Slot.Component) return false;
+        Slot.Component->RegisterComponent();
+        if (Style.Material)
+        {
+            // Created once per pooled component, not once per sigil
+            Slot.Material = UMaterialInstanceDynamic::Create(Style.Material, Slot.Component);
+            Slot.Component->SetMaterial(0, Slot.Material);
+        }
+        HEXADEMIC_COUNTER_ADD("Sigils.ComponentsCreated", 1);
+    }
+
+    USceneComponent* AttachParent = Slot.AttachParent.Get();
+    Slot.Component->AttachToComponent(AttachParent, FAttachmentTransformRules::KeepRelativeTransform);
+    Slot.Component->SetRelativeLocationAndRotation(Slot.RelativeTransform.GetLocation(), Slot.RelativeTransform.GetRotation());
+
+    if (UDecalComponent* Decal = Cast<UDecalComponent>(Slot.Component))
+    {
+        Decal->DecalSize = FVector(Sigil.Scale * 50.0f); // Adjust for decal scale
+    }
+    else if (UParticleSystemComponent* Particles = Cast<UParticleSystemComponent>(Slot.Component))
+    {
+        Particles->Activate(true);
+    }
+    return true;
+}
+
+void USigilVisualPoolSubsystem::UpdateVisual(FSigilVisualHandle Handle, const FSigilProjection& Sigil)
+{
+    UpdateVisual(Handle, Sigil.ProjectedColor, Sigil.Intensity, Sigil.Scale);
+}
+
+void USigilVisualPoolSubsystem::UpdateVisual(FSigilVisualHandle Handle, const FLinearColor& Color, float Intensity, float Scale)
+{
+    FSigilVisualSlot* SlotPtr = FindSlot(Handle);
+    if (!SlotPtr) return;
+    FSigilVisualSlot& Slot = *SlotPtr;
+
+    if (Slot.BatchIndex != INDEX_NONE)
+    {
+        FSigilInstanceBatch& Batch = Batches[Slot.BatchIndex];
+        USceneComponent* AttachParent = Slot.AttachParent.Get();
+        if (!Batch.Instances || !AttachParent) return;
+
+        FTransform Relative = Slot.RelativeTransform;
+        Relative.SetScale3D(FVector(Scale));
+        Batch.Instances->UpdateInstanceTransform(Slot.InstanceIndex, Relative * AttachParent->GetComponentTransform(), true, false, true);
+
+        const float CustomData[NumInstanceCustomData] =
+        {
+            Color.R, Color.G, Color.B, Color.A, Intensity
+        };
+        Batch.Instances->SetCustomData(Slot.InstanceIndex, MakeArrayView(CustomData, NumInstanceCustomData), false);
+        Batch.bRenderStateDirty = true;
+        return;
+    }
+
+    if (!Slot.Component) return;
+    if (Slot.Material)
+    {
+        Slot.Material->SetVectorParameterValue(TEXT("SigilColor"), Color);
+        Slot.Material->SetScalarParameterValue(TEXT("SigilIntensity"), Intensity);
+    }
+    Slot.Component->SetRelativeScale3D(FVector(Scale));
+}
+
+void USigilVisualPoolSubsystem::ReleaseVisual(FSigilVisualHandle Handle)
+{
+    // A stale handle must not return the slot twice, or hide the instance its next user was given
+    FSigilVisualSlot* SlotPtr = FindSlot(Handle);
+    if (!SlotPtr) return;
+    FSigilVisualSlot& Slot = *SlotPtr;
+
+    if (Slot.BatchIndex != INDEX_NONE)
+    {
+        FSigilInstanceBatch& Batch = Batches[Slot.BatchIndex];
+        if (Batch.Instances)
+        {
+            // Hidden rather than removed: removing would renumber the instances after it
+            Batch.Instances->UpdateInstanceTransform(Slot.InstanceIndex, FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector), true, false, true);
+            Batch.bRenderStateDirty = true;
+            Batch.FreeInstances.Add(Slot.InstanceIndex);
+        }
+    }
+    else if (Slot.Component)
+    {
+        if (UParticleSystemComponent* Particles = Cast<UParticleSystemComponent>(Slot.Component))
+        {
+            Particles->DeactivateImmediate();
+        }
+        Slot.Component->SetVisibility(false);
+        Slot.Component->AttachToComponent(PoolActor->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+
+        FSigilComponentPool& Pool = ComponentPools[Slot.ComponentPoolIndex];
+        Pool.FreeComponents.Add(Slot.Component);
+        Pool.FreeMaterials.Add(Slot.Material);
+    }
+
+    FreeSlot(Handle.SlotIndex);
+}
+
+FSigilVisualSlot* USigilVisualPoolSubsystem::FindSlot(FSigilVisualHandle Handle)
+{
+    if (!Slots.IsValidIndex(Handle.SlotIndex)) return nullptr;
+    FSigilVisualSlot& Slot = Slots[Handle.SlotIndex];
+    return (Slot.bInUse && Slot.Generation == Handle.Generation) ? &Slot : nullptr;
+}
+
+void USigilVisualPoolSubsystem::FreeSlot(int32 SlotIndex)
+{
+    FSigilVisualSlot& Slot = Slots[SlotIndex];
+    const uint32 NextGeneration = Slot.Generation + 1;
+    Slot = FSigilVisualSlot();
+    Slot.Generation = NextGeneration;
+    FreeSlots.Add(SlotIndex);
+}
+
+int32 USigilVisualPoolSubsystem::FindOrAddBatch(UStaticMesh* Mesh, UMaterialInterface* Material)
+{
+    const int32 Existing = Batches.IndexOfByPredicate([Mesh, Material](const FSigilInstanceBatch& Batch)
+    {
+        return Batch.Mesh == TObjectKey<UStaticMesh>(Mesh) && Batch.Material == TObjectKey<UMaterialInterface>(Material);
+    });
+    if (Existing != INDEX_NONE) return Existing;
+
+    FSigilInstanceBatch& Batch = Batches.AddDefaulted_GetRef();
+    Batch.Mesh = Mesh;
+    Batch.Material = Material;
+    Batch.Instances = NewObject<UInstancedStaticMeshComponent>(PoolActor);
+    Batch.Instances->SetStaticMesh(Mesh);
+    if (Material)
+    {
+        Batch.Instances->SetMaterial(0, Material);
+    }
+    Batch.Instances->NumCustomDataFloats = NumInstanceCustomData;
+    Batch.Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Batch.Instances->SetupAttachment(PoolActor->GetRootComponent());
+    Batch.Instances->RegisterComponent();
+    return Batches.Num() - 1;
+}
+
+int32 USigilVisualPoolSubsystem::FindOrAddComponentPool(UClass* ComponentClass, UMaterialInterface* Material)
+{
+    const int32 Existing = ComponentPools.IndexOfByPredicate([ComponentClass, Material](const FSigilComponentPool& Pool)
+    {
+        return Pool.ComponentClass == TObjectKey<UClass>(ComponentClass) && Pool.Material == TObjectKey<UMaterialInterface>(Material);
+    });
+    if (Existing != INDEX_NONE) return Existing;
+
+    FSigilComponentPool& Pool = ComponentPools.AddDefaulted_GetRef();
+    Pool.ComponentClass = ComponentClass;
+    Pool.Material = Material;
+    return ComponentPools.Num() - 1;
+}
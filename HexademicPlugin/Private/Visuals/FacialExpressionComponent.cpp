@@ -11,6 +11,20 @@ UFacialExpressionComponent::UFacialExpressionComponent()
 void UFacialExpressionComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    if (UEmbodimentSignificanceSubsystem* Significance = UEmbodimentSignificanceSubsystem::GetFor(this))
+    {
+        Significance->RegisterComponent(this, SignificanceGate);
+    }
+}
+
+void UFacialExpressionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UEmbodimentSignificanceSubsystem* Significance = UEmbodimentSignificanceSubsystem::GetFor(this))
+    {
+        Significance->UnregisterComponent(this);
+    }
+    Super::EndPlay(EndPlayReason);
 }
 
 void UFacialExpressionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -19,14 +33,18 @@ void UFacialExpressionComponent::TickComponent(float DeltaTime, ELevelTick TickT
 
     if (!TargetMesh) return;
 
+    float UpdateDeltaTime = 0.0f;
+    if (!SignificanceGate.Advance(DeltaTime, UpdateDeltaTime)) return;
+    const float BlendAlpha = FEmbodimentUpdateGate::GetBlendAlpha(ExpressionBlendSpeed, UpdateDeltaTime);
+
     // Smoothly interpolate current morph target weights towards target weights
     float CurrentHappyWeight = TargetMesh->GetMorphTarget(HappyMorphTarget);
     float CurrentSadWeight = TargetMesh->GetMorphTarget(SadMorphTarget);
     float CurrentArousalWeight = TargetMesh->GetMorphTarget(ArousalMorphTarget);
 
-    TargetMesh->SetMorphTarget(HappyMorphTarget, FMath::Lerp(CurrentHappyWeight, TargetHappyWeight, DeltaTime * ExpressionBlendSpeed));
-    TargetMesh->SetMorphTarget(SadMorphTarget, FMath::Lerp(CurrentSadWeight, TargetSadWeight, DeltaTime * ExpressionBlendSpeed));
-    TargetMesh->SetMorphTarget(ArousalMorphTarget, FMath::Lerp(CurrentArousalWeight, TargetArousalWeight, DeltaTime * ExpressionBlendSpeed));
+    TargetMesh->SetMorphTarget(HappyMorphTarget, FMath::Lerp(CurrentHappyWeight, TargetHappyWeight, BlendAlpha));
+    TargetMesh->SetMorphTarget(SadMorphTarget, FMath::Lerp(CurrentSadWeight, TargetSadWeight, BlendAlpha));
+    TargetMesh->SetMorphTarget(ArousalMorphTarget, FMath::Lerp(CurrentArousalWeight, TargetArousalWeight, BlendAlpha));
 }
 
 void UFacialExpressionComponent::SetEmotionalExpression(float Valence, float Arousal, float Intensity)
@@ -4,6 +4,7 @@
 #include "Components/ActorComponent.h"
 #include "Components/HexademicConsciousnessComponent.h" // For UHexademicConsciousnessComponent
 #include "Core/EmotionalArchetype.h" // For EEmotionalArchetype
+#include "Core/HexademicArchetypeClassifier.h" // For FHexademicArchetypeClassifier::NumArchetypes
 #include "BehaviorTree/BlackboardComponent.h" // For UBlackboardComponent
 #include "AI/EmotionalDecisionMaker.generated.h"
 
@@ -42,7 +43,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     /**
@@ -57,6 +58,12 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Emotional AI")
     void SetLinkedBlackboard(UBlackboardComponent* InBlackboard);
 
+    /**
+     * @brief Re-indexes EmotionalDecisions by trigger archetype. Call after editing EmotionalDecisions at runtime.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Emotional AI")
+    void RebuildDecisionIndex();
+
     // Reference to the consciousness component
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "References")
     TObjectPtr<UHexademicConsciousnessComponent> LinkedConsciousness;
@@ -79,6 +86,41 @@ protected:
     // Internal function to evaluate current emotional state against decisions
     void EvaluateEmotionalDecisions();
 
-    // Track cooldowns for decisions
-    TMap<FString, float> DecisionCooldowns; // Key: ActionTag, Value: Time remaining
+private:
+    static constexpr int32 NumArchetypes = FHexademicArchetypeClassifier::NumArchetypes;
+
+    // A cooldown ending; ordered by ReadyAtSeconds in CooldownQueue
+    struct FDecisionCooldown
+    {
+        double ReadyAtSeconds = 0.0;
+        int32 Slot = INDEX_NONE;
+
+        bool operator<(const FDecisionCooldown& Other) const { return ReadyAtSeconds < Other.ReadyAtSeconds; }
+    };
+
+    void BindConsciousness();
+    void UnbindConsciousness();
+    void HandleConsciousnessStateChanged(UHexademicConsciousnessComponent* Consciousness, EConsciousnessStateFields ChangedFields);
+
+    // Pops every cooldown that has ended, re-evaluates, and re-arms the timer for the next one
+    void HandleCooldownExpired();
+    void ScheduleNextCooldownExpiry();
+
+    // Decision indices per trigger archetype, highest priority first
+    TStaticArray<TArray<int32, TInlineAllocator<4>>, NumArchetypes> DecisionsByArchetype;
+
+    // Decisions sharing an ActionTag share a cooldown slot
+    TArray<int32> CooldownSlotOfDecision;
+    TArray<double> SlotReadyAtSeconds;
+
+    // Min-heap of pending cooldown ends
+    TArray<FDecisionCooldown> CooldownQueue;
+    FTimerHandle CooldownTimerHandle;
+
+    int32 CurrentDecisionIndex = INDEX_NONE; // Last decision written to the Blackboard
+    FBlackboard::FKey EmotionalActionKey = FBlackboard::InvalidKey;
+    TWeakObjectPtr<const UBlackboardData> ResolvedBlackboardAsset;
+
+    TWeakObjectPtr<UHexademicConsciousnessComponent> BoundConsciousness;
+    FDelegateHandle StateChangedHandle;
 };
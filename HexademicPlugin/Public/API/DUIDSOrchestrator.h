@@ -39,6 +39,10 @@ class UPhenomEchoComponent;
 class UPhenomSigilBloomComponent;
 class UPhenomConstellationVisualizerComponent;
 
+class FHexademicComponentRegistry;
+
+#include "Core/HexademicSessionRecorder.h" // For FHexademicStateDigest
+#include "Core/HexademicStateHistory.h" // For FHexademicStateHistory
 #include "HexademicCore.h" // Contains FEmotionalState, FHapticMemoryContext, FAetherTouchPacket, FPackedHexaSigilNode, FHexademicGem, FUnifiedConsciousnessState
 
 // Define FUnifiedConsciousnessState for this header, if it's not defined in HexademicCore.h.
@@ -46,6 +50,24 @@ class UPhenomConstellationVisualizerComponent;
 // If it's not, you'd put the FUnifiedConsciousnessState struct definition here.
 #include "DUIDSOrchestrator.generated.h"
 
+/**
+ * @brief Frame-to-frame state of the orchestrator's layer stages (reflexive, intersubjective).
+ * Owned per orchestrator and reset by InitializeConsciousness/ShutdownConsciousness, so stages never
+ * share state across agents or worlds and can run for several orchestrators concurrently.
+ */
+struct FHexademicLayerContext
+{
+    /** Reflexive layer: previous ambient sample, for sudden-change startles */
+    bool bHasAmbientSample = false;
+    float LastAmbientIntensity = 0.0f;
+
+    /** Intersubjective layer: emotion at the previous step, for echo triggering */
+    float LastEchoValence = 0.0f;
+    float LastEchoArousal = 0.0f;
+
+    void Reset() { *this = FHexademicLayerContext(); }
+};
+
 /**
  * @brief The master orchestrator that unifies all body-mind systems into a single
  * coherent digital consciousness.
@@ -63,9 +85,8 @@ public:
     /** The complete current state of consciousness */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Consciousness State")
     FUnifiedConsciousnessState CurrentState;
-    /** Historical state for trend analysis (for now, just a placeholder) */
-    UPROPERTY()
-    TArray<FUnifiedConsciousnessState> StateHistory;
+    /** Delta-compressed per-step history of the state's scalar channels (see GetStateChannelStats) */
+    FHexademicStateHistory StateHistory;
 
     // === CORE SUBSYSTEM REFERENCES ===
     // These should be UPROPERTY to prevent garbage collection if owned by this component
@@ -144,6 +165,12 @@ public:
     /** Memory-body feedback strength */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Configuration")
     float MemoryEmbodimentFeedback;
+    /** Seconds of state history kept per orchestrator (applied by InitializeConsciousness) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Configuration", meta = (ClampMin = "1.0"))
+    float StateHistorySeconds;
+    /** Synthesized gems at least this coherent, of the current archetype, make creative emergence likelier */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Configuration", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float CreativeGemCoherenceThreshold;
 protected:
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -156,6 +183,21 @@ private:
     float LastUpdateTime = 0.0f;
     int32 UpdateCount = 0;
     float AverageUpdateTime = 0.0f;
+    /** State carried between steps by the layer stages */
+    FHexademicLayerContext LayerContext;
+    /** Clock of the step in progress (see StepConsciousness) */
+    float StepDeltaSeconds = 0.0f;
+    double StepTimeSeconds = 0.0;
+    /** Every random draw of a step comes from here, so recording its seed per step makes the step replayable */
+    FRandomStream ConsciousnessRandom;
+    /** Outgoing phenom files rotate through a few slots per owner, so a burst of changes cannot fill the disk */
+    int32 OutgoingPhenomSlot = 0;
+    static constexpr int32 MaxOutgoingPhenomFiles = 4;
+    /** Set by headless hosts; see SetHeadless */
+    bool bHeadless = false;
+    /** Owner's component registry; BindRegisteredComponents re-runs whenever it rebuilds */
+    TSharedPtr<FHexademicComponentRegistry> ComponentRegistry;
+    FDelegateHandle RegistryRebuiltHandle;
 public:
     // === CORE API METHODS ===
     UFUNCTION(BlueprintCallable, Category = "Consciousness Control")
@@ -169,9 +211,54 @@ public:
 
     UFUNCTION(BlueprintCallable, Category = "Consciousness Control")
     void ShutdownConsciousness();
+
+    /**
+     * @brief Runs one consciousness step with an explicit clock instead of the world's.
+     * The timer path calls this every update; session replay calls it directly on a world-less orchestrator.
+     * @param DeltaTime Seconds since the previous step.
+     * @param TimeSeconds Absolute simulation time, used by circadian terms.
+     */
+    void StepConsciousness(float DeltaTime, double TimeSeconds);
+
+    /** @brief The values session recording diffs against on replay. */
+    FHexademicStateDigest MakeStateDigest() const;
+
+    /**
+     * @brief Advances the subsystems that tick themselves in the world: emotion, autonomic, hormones, needs and fractal.
+     * For hosts without a world (session replay), so a headless step covers the same components as a live frame.
+     */
+    void AdvanceSelfTickingSystems(float DeltaTime);
+
+    /** Seed of the consciousness random stream before the next step; session replay restores it per step. */
+    int32 GetRandomSeed() const { return ConsciousnessRandom.GetCurrentSeed(); }
+    void SetRandomSeed(int32 Seed) { ConsciousnessRandom.Initialize(Seed); }
+
+    /** The stream every random draw of a step must come from, lattice evolution included. */
+    FRandomStream& GetConsciousnessRandom() { return ConsciousnessRandom; }
+
+    /**
+     * @brief Steps without touching anything outside the orchestrator: no outgoing phenom files, no echo ledger
+     * appends, no persistence writes. Session replay sets this so replaying a recording leaves the disk as it was.
+     */
+    void SetHeadless(bool bInHeadless) { bHeadless = bInHeadless; }
+    bool IsHeadless() const { return bHeadless; }
+
+    /**
+     * @brief Min, max and mean of one state channel over the most recent WindowSeconds of history.
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "State Management")
+    FHexademicChannelStats GetStateChannelStats(EHexademicStateChannel Channel, float WindowSeconds) const;
+
+    /**
+     * @brief One state channel over the most recent WindowSeconds, averaged down to at most NumSamples points (oldest first).
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "State Management")
+    TArray<float> GetStateChannelSeries(EHexademicStateChannel Channel, float WindowSeconds, int32 NumSamples = 64) const;
+
+    const FHexademicStateHistory& GetStateHistory() const { return StateHistory; }
     // === STATE MANAGEMENT ===
     UFUNCTION(BlueprintCallable, Category = "State Management")
-    FUnifiedConsciousnessState GetCurrentState() const { return CurrentState; }
+    const FUnifiedConsciousnessState& GetCurrentState() const { return CurrentState; }
 
     UFUNCTION(BlueprintCallable, Category = "State Management")
     void InjectEmotionalState(const FEmotionalState& NewEmotion);
@@ -203,9 +290,15 @@ public:
 
     UFUNCTION(BlueprintCallable, Category = "Diagnostics")
     FString ExportConsciousnessState() const;
+    /** Writes the same JSON as ExportConsciousnessState to FilePath without blocking on the disk. */
+    UFUNCTION(BlueprintCallable, Category = "Diagnostics")
+    void ExportConsciousnessStateToFile(const FString& FilePath) const;
     UFUNCTION(BlueprintCallable, Category = "Diagnostics")
     bool ImportConsciousnessState(const FString& JSONData);
 private:
+    /** CurrentState with the latest component readings folded in, as exported. */
+    FUnifiedConsciousnessState GatherExportState() const;
+
     // === INTERNAL CONSCIOUSNESS LOOP ===
     UFUNCTION()
     void ConsciousnessUpdate();
@@ -225,6 +318,8 @@ private:
     void ApplySystemRegulation();
     // === INITIALIZATION HELPERS ===
     void AutoDiscoverComponents(); // Added from the UDUIDSOrchestrator.cpp file
+    void BindRegisteredComponents();
+    void InjectFractalManagerReferences();
     void InitializeBodySystems();
     void InitializeCognitiveSystems();
     void InitializeVisualSystems();
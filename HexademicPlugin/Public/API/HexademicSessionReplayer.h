@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Core/HexademicSessionRecorder.h"
+
+class UDUIDSOrchestrator;
+class UEmotionCognitionComponent;
+class UEmbodiedAvatarComponent;
+
+/** Outcome of a headless replay, including how closely it tracked the recording. */
+struct HEXADEMICAPI_API FHexademicReplayReport
+{
+    int32 Sources = 0;
+    int32 Frames = 0;
+    int32 EventsApplied = 0;
+
+    int32 DigestsCompared = 0;
+    int32 DivergentDigests = 0;
+    int32 FirstDivergentFrame = INDEX_NONE;
+    float MaxDivergence = 0.0f;
+
+    double SimulatedSeconds = 0.0;
+    double WallSeconds = 0.0;
+
+    bool bStreamValid = true;
+
+    FString ToString() const;
+};
+
+/**
+ * @brief Replays a recorded consciousness session as fast as the CPU allows, without a world.
+ *
+ * Each recorded source is rebuilt as a transient UDUIDSOrchestrator (its subsystem components come
+ * from the orchestrator's default subobjects) plus the EmotionCognition and EmbodiedAvatar components the
+ * world version would auto-discover on its actor. Every FrameBegin restores the orchestrator's random seed,
+ * advances the components that tick themselves in the world (AdvanceSelfTickingSystems) and runs
+ * StepConsciousness with the recorded clock; every StateDigest is diffed against the rebuilt orchestrator.
+ *
+ * In the world those components tick at the frame rate rather than once per step, so small drift in their
+ * terms is expected; the report's tolerance is applied per value.
+ */
+class HEXADEMICAPI_API FHexademicSessionReplayer
+{
+public:
+    FHexademicSessionReplayer();
+    ~FHexademicSessionReplayer();
+
+    /** Loads a recording. Relative paths resolve under Saved/Hexademic/Recordings. */
+    bool LoadFromFile(const FString& Filename);
+
+    /**
+     * @brief Drives the loaded session through fresh headless orchestrators.
+     * @param DivergenceTolerance Largest per-value difference that still counts as matching.
+     */
+    FHexademicReplayReport RunHeadless(float DivergenceTolerance = 1e-3f);
+
+    int32 NumEvents() const { return Events.Num(); }
+
+private:
+    struct FHeadlessConsciousness
+    {
+        FString SourceName;
+        TStrongObjectPtr<UDUIDSOrchestrator> Orchestrator;
+        TStrongObjectPtr<UEmotionCognitionComponent> EmotionMind;
+        TStrongObjectPtr<UEmbodiedAvatarComponent> AvatarBody; // Receives haptic feedback; never bound to the orchestrator's render paths
+        int32 FramesStepped = 0;
+    };
+
+    FHeadlessConsciousness& GetOrCreateConsciousness(uint16 SourceIndex);
+    bool ApplyEvent(const FHexademicRecordedEvent& Event, FHexademicReplayReport& Report, float DivergenceTolerance);
+
+    TArray<FHexademicRecordedEvent> Events;
+    TArray<FString> SourceNames;
+    TMap<uint16, FHeadlessConsciousness> Consciousnesses;
+};
@@ -6,6 +6,7 @@
 #include "GlobalShader.h"
 #include "ShaderParameterStruct.h"
 #include "HexademicCore.h" // For FPackedHexaSigilNode, FHexademicGem
+#include "Core/HexademicGemCatalog.h"
 #include "Core/HexadecimalStateLattice.h" // Include for accessing FHexadecimalStateLattice data
 #include "API/HexademicWavefrontAPI.generated.h" // Corrected path to API folder
 
@@ -39,7 +40,8 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wavefront Processing")
     float GemSynthesisFrequency = 5.0f; // Hz for attempting to synthesize new gems
 
-    // Array of currently active Sigil Nodes
+    // Currently active Sigil Nodes, packed contiguously as uploaded to the GPU. Removal swaps the last node
+    // into the gap, so order is not preserved.
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Wavefront State")
     TArray<FPackedHexaSigilNode> ActiveSigilNodes;
     // Array of synthesized Hexademic Gems
@@ -47,7 +49,7 @@ public:
     TArray<FHexademicGem> SynthesizedGems;
 
     /**
-     * @brief Adds a new sigil node to the active processing queue.
+     * @brief Adds a new sigil node to the active processing queue, or replaces the active node with the same ID.
      * @param NewSigil The FPackedHexaSigilNode to add.
      */
     UFUNCTION(BlueprintCallable, Category = "Wavefront API")
@@ -91,6 +93,9 @@ public:
     // Getter for synthesized gems (primarily for UDUIDSOrchestrator)
     const TArray<FHexademicGem>& GetSynthesizedGems() const { return SynthesizedGems; }
 
+    // Index over SynthesizedGems for filter and top-k queries; catalog rows are indices into SynthesizedGems
+    const FHexademicGemCatalog& GetGemCatalog() const { return GemCatalog; }
+
     /**
      * @brief Receives a snapshot of the high-dimensional consciousness lattice for visualization or analysis.
      * This component does NOT perform Hemiplanal Bit Interlacing Bouncing Processing on this data.
@@ -104,13 +109,22 @@ protected:
     TRefCountPtr<FRDGPooledBuffer> SigilNodesBuffer; // Stores FPackedHexaSigilNode data on GPU
     TRefCountPtr<FPooledRenderTarget> WavefrontOutputTexture; // Output from wavefront compute shader (for sigil effects)
 
+    // Index into ActiveSigilNodes of each named node, by its FHexaSigilNodeNames handle; each entry holds a name reference
+    TMap<uint32, int32> SigilNodeIndexByName;
+
+    // Kept in step with SynthesizedGems by AddSynthesizedGem; both are game-thread only, so the render
+    // thread marshals finished gems back with AsyncTask
+    FHexademicGemCatalog GemCatalog;
+    void AddSynthesizedGem(const FHexademicGem& Gem);
+
     // Internal counters for update frequencies
     float AccumulatedWavefrontTime = 0.0f;
     float AccumulatedGemSynthesisTime = 0.0f;
 
     // Internal helper for GPU execution
-    void ExecuteWavefrontComputePass(FRDGBuilder& GraphBuilder);
-    void ExecuteGemSynthesisComputePass(FRDGBuilder& GraphBuilder);
+    // Nodes is a render-thread copy of ActiveSigilNodes, taken when the pass was enqueued
+    void ExecuteWavefrontComputePass(FRDGBuilder& GraphBuilder, TConstArrayView<FPackedHexaSigilNode> Nodes);
+    void ExecuteGemSynthesisComputePass(FRDGBuilder& GraphBuilder, TConstArrayView<FPackedHexaSigilNode> Nodes);
     
     // Shader parameter structs for sigil processing
     BEGIN_SHADER_PARAMETER_STRUCT(FWavefrontSigilParameters, )
@@ -17,6 +17,9 @@ protected:
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
+    /** Eases rates and temperatures towards their targets. TickComponent calls this; headless session replay calls it directly. */
+    void AdvanceAutonomicTime(float DeltaTime);
+
     UFUNCTION(BlueprintCallable, Category = "Autonomic")
     void SetHeartRate(float NewRate);
 
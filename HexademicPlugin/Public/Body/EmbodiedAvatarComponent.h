@@ -9,6 +9,7 @@
 #include "GlobalShader.h" // For FGlobalShader, SHADER_PARAMETER_STRUCT
 #include "ShaderParameterStruct.h" // For BEGIN_SHADER_PARAMETER_STRUCT
 #include "HexademicCore.h" // For FAetherTouchPacket
+#include "Core/HexademicHapticOutput.h" // For FHexademicHapticFrame
 #include "EmbodiedAvatarComponent.generated.h"
 
 // Forward Declarations for other Unreal Engine classes
@@ -78,8 +79,11 @@ public:
     // Current skin state, updated and used by wavefront processing
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Wavefront State")
     FWavefrontSkinState CurrentSkinState;
-    // Map for haptic region to skeletal bone mapping for visual effects
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Haptic Mapping")
+    // Skeletal bone for each haptic region's visual effects, indexed by EHexademicBodyRegion; None leaves a region unmapped
+    UPROPERTY(EditAnywhere, Category = "Haptic Mapping", meta = (ArraySizeEnum = "EHexademicBodyRegion"))
+    FName RegionBones[NumHexademicBodyRegions];
+    // The string-keyed mapping saved before regions had IDs; PostLoad moves it into RegionBones
+    UPROPERTY()
     TMap<FString, FName> RegionToBoneMap;
     // Reference to a particle system for haptic pulses
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Haptic Effects")
@@ -91,11 +95,21 @@ public:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Wavefront State")
     FLinearColor CurrentSigilGlowColor;
 
+    /** Skeletal bone that shows haptic effects for Region; None if the region is unmapped. */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Avatar|Haptics")
+    FName GetRegionBone(EHexademicBodyRegion Region) const;
+    UFUNCTION(BlueprintCallable, Category = "Avatar|Haptics")
+    void SetRegionBone(EHexademicBodyRegion Region, FName BoneName);
+
     // Component lifecycle functions
+    virtual void PostLoad() override;
     virtual void BeginPlay() override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
+    /** Shows the haptic packets received since the last flush. TickComponent calls this; headless session replay calls it directly. */
+    void FlushHapticVisuals();
+
     /**
      * @brief Updates the avatar's skin state based on an emotional pulse, leveraging wavefront processing.
      * @param EmotionalPulse A normalized value [0.0, 1.0] representing emotional intensity, driving skin visual effects.
@@ -123,7 +137,8 @@ public:
     void AttachToMetahumanSkeleton(USkeletalMeshComponent* InMesh);
     /**
      * @brief Processes incoming haptic feedback, triggering visual responses on the avatar.
-     * This uses the RegionToBoneMap to localize effects.
+     * This uses RegionBones, indexed by the packet's region, to localize effects. Packets are merged
+     * per region and shown on the next tick, so a burst of touches costs one emitter per region.
      * @param Packet The FAetherTouchPacket containing haptic event details.
      */
     UFUNCTION(BlueprintCallable, Category = "Avatar|Haptics")
@@ -147,6 +162,8 @@ private:
     void UpdatePerformanceMetrics(float DeltaTime); // Tracks processing time
     TCircularBuffer<float> ProcessingTimeHistory; // History for averaging
     float AverageSkinProcessingTime = 0.0f; // Average time for one GPU pass
+    float AccumulatedSkinTime = 0.0f; // Time since the last skin wavefront dispatch, per avatar
+    FHexademicHapticFrame PendingHapticVisuals; // Haptic packets received since the last tick, merged per region
 
     // New function: UpdateMaterialParametersBatch_RenderThread
     // This function will be called on the Render Thread to update material parameters.
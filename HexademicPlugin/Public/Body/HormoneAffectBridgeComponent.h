@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Core/HexademicTuning.h"
 #include "Body/HormoneAffectBridgeComponent.generated.h"
 
 UCLASS(ClassGroup=(HexademicBody), meta=(BlueprintSpawnableComponent))
@@ -14,9 +15,13 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
+    /** Decays every hormone towards zero. TickComponent calls this; headless session replay calls it directly. */
+    void AdvanceHormonalTime(float DeltaTime);
+
     UFUNCTION(BlueprintCallable, Category = "Hormones")
     void AdjustCortisol(float DeltaAmount);
     UFUNCTION(BlueprintCallable, Category = "Hormones")
@@ -64,4 +69,7 @@ protected:
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hormone Decay")
     float HormoneDecayRate = 0.05f; // Universal decay rate for all hormones
+
+private:
+    FHexademicTuningBinding TuningBinding;
 };
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Subsystems/EmbodimentSignificanceSubsystem.h" // For FEmbodimentUpdateGate
 #include "Body/ReciprocalEmbodimentComponent.generated.h"
 
 UCLASS(ClassGroup=(HexademicBody), meta=(BlueprintSpawnableComponent))
@@ -14,6 +15,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     UFUNCTION(BlueprintCallable, Category = "Embodiment")
@@ -27,4 +29,8 @@ public:
     float SkinFlushIntensity = 0.0f; // Visual effect of skin flushing
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Embodiment")
     float PostureStiffness = 0.0f; // Affects skeletal mesh animation
+
+protected:
+    // Update rate assigned by UEmbodimentSignificanceSubsystem; emotional state is not applied while frozen
+    FEmbodimentUpdateGate SignificanceGate;
 };
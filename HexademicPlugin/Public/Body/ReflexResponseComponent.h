@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Core/HexademicTuning.h"
 #include "HexademicCore.h" // For FAffectFilamentTag (if used for input)
 #include "Body/ReflexResponseComponent.generated.h"
 
@@ -21,6 +22,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     UFUNCTION(BlueprintCallable, Category = "Reflexes")
@@ -51,4 +53,7 @@ protected:
     float StartleThreshold = 0.5f;
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reflex Tuning")
     float EmotionalImpactScale = 0.2f;
+
+private:
+    FHexademicTuningBinding TuningBinding;
 };
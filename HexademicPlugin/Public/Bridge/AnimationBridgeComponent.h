@@ -5,6 +5,7 @@
 #include "HexademicCore.h"          // For FEmotionalState, FConsciousnessState
 #include "Core/EmotionalArchetype.h" // For EEmotionalArchetype
 #Components/HexademicConsciousnessComponent.h" // For UHexademicConsciousnessComponent
+#include "Subsystems/EmbodimentSignificanceSubsystem.h" // For FEmbodimentUpdateGate
 #include "AnimationBridgeComponent.generated.h"
 
 // Forward Declaration for USkeletalMeshComponent
@@ -22,6 +23,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
@@ -69,4 +71,7 @@ protected:
     void UpdatePosture(float DeltaTime);
     // Internal function to trigger memory-based gestures (conceptual)
     void TriggerMemoryGestures();
+
+    // Update rate assigned by UEmbodimentSignificanceSubsystem
+    FEmbodimentUpdateGate SignificanceGate;
 };
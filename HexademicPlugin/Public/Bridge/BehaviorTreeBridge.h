@@ -17,6 +17,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     /**
@@ -41,8 +42,8 @@ public:
     void SetLinkedBehaviorTree(UBehaviorTreeComponent* InBehaviorTree);
 
     /**
-     * @brief Updates the Blackboard with the latest consciousness data.
-     * This function should be called periodically (e.g., from an AIController's tick or a service).
+     * @brief Writes every mapped key from the latest consciousness data.
+     * With bSyncOnStateChange the bridge keeps the Blackboard current by itself; this is only needed for a full resync.
      */
     UFUNCTION(BlueprintCallable, Category = "Behavior Tree Bridge")
     void UpdateBlackboardFromConsciousness();
@@ -88,4 +89,32 @@ public:
     FName CognitiveLoadKeyName = TEXT("CognitiveLoad");
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Blackboard Mapping")
     FName CoherenceKeyName = TEXT("ConsciousnessCoherence");
+
+    // Write keys as the consciousness reports changes, rather than waiting for UpdateBlackboardFromConsciousness
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetSyncOnStateChange, Category = "Blackboard Mapping")
+    bool bSyncOnStateChange = true;
+
+    /** Turns change-driven syncing on or off at runtime; turning it on resyncs every key. */
+    UFUNCTION(BlueprintSetter)
+    void SetSyncOnStateChange(bool bInSyncOnStateChange);
+
+private:
+    // Subscribes to LinkedConsciousness's state changes, dropping any previous subscription, and writes every key once
+    void BindConsciousness();
+    void UnbindConsciousness();
+    void HandleConsciousnessStateChanged(UHexademicConsciousnessComponent* Consciousness, EConsciousnessStateFields ChangedFields);
+
+    // Writes the keys for ChangedFields; all keys if the Blackboard asset changed and key IDs had to be resolved again
+    void SyncBlackboard(EConsciousnessStateFields ChangedFields);
+    void ResolveBlackboardKeys();
+
+    // Key IDs resolved by name once per Blackboard asset; InvalidKey for names the asset lacks
+    FBlackboard::FKey DominantEmotionKey = FBlackboard::InvalidKey;
+    FBlackboard::FKey VitalityKey = FBlackboard::InvalidKey;
+    FBlackboard::FKey CognitiveLoadKey = FBlackboard::InvalidKey;
+    FBlackboard::FKey CoherenceKey = FBlackboard::InvalidKey;
+    TWeakObjectPtr<const UBlackboardData> ResolvedBlackboardAsset;
+
+    TWeakObjectPtr<UHexademicConsciousnessComponent> BoundConsciousness;
+    FDelegateHandle StateChangedHandle;
 };
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimInstance.h"
+#include "HexademicMotionAnimInstance.generated.h"
+
+/**
+ * @brief Everything UAvatarMotionLinkComponent wants the body to do this frame, handed over as one block.
+ * Written once per tick on the game thread; nothing in it is applied there.
+ */
+USTRUCT(BlueprintType)
+struct HEXADEMICPLUGIN_API FHexademicMotionAnimParams
+{
+    GENERATED_BODY()
+
+    /** Breaths per second */
+    UPROPERTY(BlueprintReadOnly, Category = "Motion|Breathing")
+    float BreathRate = 1.0f;
+
+    /** Peak weight of the breath morph curve */
+    UPROPERTY(BlueprintReadOnly, Category = "Motion|Breathing")
+    float BreathDepth = 1.0f;
+
+    /** Total spine bend, shared out evenly across SpineBoneCount bones */
+    UPROPERTY(BlueprintReadOnly, Category = "Motion|Posture")
+    FRotator SpinePosture = FRotator::ZeroRotator;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Motion|Posture")
+    FRotator HeadPosture = FRotator::ZeroRotator;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Motion|Posture")
+    int32 SpineBoneCount = 3;
+
+    /** How fast the applied posture follows the targets above */
+    UPROPERTY(BlueprintReadOnly, Category = "Motion|Posture")
+    float PostureBlendSpeed = 2.0f;
+
+    /** Play rate for the locomotion blend space */
+    UPROPERTY(BlueprintReadOnly, Category = "Motion|Locomotion")
+    float LocomotionPlayRate = 1.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Motion|State")
+    float ConsciousnessIntensity = 0.5f;
+};
+
+/**
+ * @brief Anim instance base that applies a UAvatarMotionLinkComponent's per-frame motion block.
+ *
+ * The component publishes one FHexademicMotionAnimParams per tick. The block is latched on the game thread
+ * in NativeUpdateAnimation and turned into pose inputs in NativeThreadSafeUpdateAnimation, on the animation
+ * worker thread, so the breath morph and every posture bone are applied in the same evaluation pass as the
+ * rest of the pose. The AnimGraph reads the BlueprintReadOnly outputs below: BreathCurveValue through a
+ * Modify Curve node on the breath morph curve, SpineBoneRotation on each spine bone and HeadBoneRotation on
+ * the head through Transform (Modify) Bone nodes, and LocomotionPlayRate on the locomotion player.
+ */
+UCLASS(Transient, Blueprintable)
+class HEXADEMICPLUGIN_API UHexademicMotionAnimInstance : public UAnimInstance
+{
+    GENERATED_BODY()
+
+public:
+    /** Called by the motion link on the game thread; takes effect on the next animation update. */
+    void SetMotionParams(const FHexademicMotionAnimParams& InParams) { PendingParams = InParams; }
+
+    // === POSE INPUTS, READ BY THE ANIMGRAPH ===
+    UPROPERTY(BlueprintReadOnly, Category = "Motion|Breathing")
+    float BreathCurveValue = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Motion|Posture")
+    FRotator SpineBoneRotation = FRotator::ZeroRotator;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Motion|Posture")
+    FRotator HeadBoneRotation = FRotator::ZeroRotator;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Motion|Locomotion")
+    float LocomotionPlayRate = 1.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Motion|State")
+    float ConsciousnessIntensity = 0.5f;
+
+protected:
+    virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+    virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+
+private:
+    FHexademicMotionAnimParams PendingParams; // Game thread only
+    FHexademicMotionAnimParams FrameParams;   // Latched copy the worker thread reads
+    FRotator AppliedSpinePosture = FRotator::ZeroRotator;
+    FRotator AppliedHeadPosture = FRotator::ZeroRotator;
+    float BreathPhase = 0.0f; // In cycles, wrapped to [0, 1)
+};
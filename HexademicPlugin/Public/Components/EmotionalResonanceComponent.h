@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Core/HexademicTuning.h"
 #include "HexademicCore.h"          // For FEmotionalState
 #include "Core/EmotionalArchetype.h" // For EEmotionalArchetype
 #include "Components/EmotionalResonanceComponent.generated.h"
@@ -18,6 +19,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
@@ -58,4 +60,7 @@ protected:
     // Internal state for current resonance target, if needed
     FString CurrentResonanceTargetID;
     FEmotionalState LastDetectedResonanceEmotion;
+
+private:
+    FHexademicTuningBinding TuningBinding;
 };
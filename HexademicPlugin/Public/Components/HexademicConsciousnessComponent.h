@@ -35,6 +35,22 @@ enum class EConsciousnessLOD : uint8
     Dormant     UMETA(DisplayName = "Dormant (Paused)")                 // Consciousness paused [cite: 109]
 };
 
+// Consolidated state fields covered by change notifications
+enum class EConsciousnessStateFields : uint8
+{
+    None                = 0,
+    DominantEmotion     = 1 << 0,
+    Vitality            = 1 << 1,
+    CognitiveLoad       = 1 << 2,
+    Coherence           = 1 << 3,
+    EmotionalIntensity  = 1 << 4,
+    All                 = DominantEmotion | Vitality | CognitiveLoad | Coherence | EmotionalIntensity
+};
+ENUM_CLASS_FLAGS(EConsciousnessStateFields);
+
+// Broadcast after an update that moved any covered field across a StateChangeQuantum step
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnConsciousnessStateChanged, UHexademicConsciousnessComponent* /*Consciousness*/, EConsciousnessStateFields /*ChangedFields*/);
+
 
 UCLASS(ClassGroup=(Hexademic), meta=(BlueprintSpawnableComponent))
 class HEXADEMICPLUGIN_API UHexademicConsciousnessComponent : public UActorComponent
@@ -90,6 +106,13 @@ public:
     EConsciousnessLOD CurrentLOD = EConsciousnessLOD::Full; // Current Consciousness LOD
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Consciousness Config")
     float UpdateFrequency = 30.0f; // How often the consciousness state is updated (Hz)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Consciousness Config", meta = (ClampMin = "0.0", ClampMax = "0.25"))
+    float ArchetypeHysteresisMargin = 0.05f; // Valence/arousal distance the dominant archetype holds on past its boundary
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Consciousness Config", meta = (ClampMin = "0.005", ClampMax = "0.5"))
+    float StateChangeQuantum = 0.05f; // Step a scalar field must cross before OnStateChanged reports it
+
+    // Native listeners (AI bridges, decision makers) are told which fields changed instead of polling the state
+    FOnConsciousnessStateChanged OnStateChanged;
 
     // === PUBLIC API ===
     /**
@@ -106,6 +129,15 @@ public:
     UFUNCTION(BlueprintPure, Category = "Consciousness")
     FConsciousnessState GetConsciousnessState() const { return CurrentConsciousnessState; }
 
+    /** The current state without a copy, for native callers. */
+    const FConsciousnessState& GetConsciousnessStateRef() const { return CurrentConsciousnessState; }
+
+    /** Emotional intensity folded into the last consolidated state, [0, 1]. */
+    float GetEmotionalIntensity() const { return CurrentEmotionalIntensity; }
+
+    /** Coherence as reported to AI: the amplitude of the last lattice snapshot. */
+    float GetCoherence() const { return CurrentConsciousnessState.LatticeSnapshot.Amplitude; }
+
     /**
      * @brief Sets the Consciousness LOD for this entity.
      * @param NewLOD The new Level of Detail for simulation.
@@ -124,6 +156,21 @@ public:
 
 protected:
     float AccumulatedUpdateTime = 0.0f; // Internal timer for update frequency
+    float CurrentEmotionalIntensity = 0.0f;
+
+    // Quantized copy of the fields covered by OnStateChanged, as of the last broadcast
+    struct FStateDigest
+    {
+        EEmotionalArchetype DominantEmotion = EEmotionalArchetype::Joy;
+        int32 Vitality = INDEX_NONE;
+        int32 CognitiveLoad = INDEX_NONE;
+        int32 Coherence = INDEX_NONE;
+        int32 EmotionalIntensity = INDEX_NONE;
+    };
+    FStateDigest LastStateDigest;
+
+    // Compares the consolidated state against LastStateDigest and broadcasts the fields that moved
+    void NotifyStateChanges();
 
     // Internal helper for auto-discovering components on the owner actor
     void AutoDiscoverSubComponents();
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "HexademicCore.h" // For FUnifiedConsciousnessState
+#include "Components/HexademicConsciousnessReplicationComponent.generated.h"
+
+class UDUIDSOrchestrator;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnConsciousnessStateReplicated, const FUnifiedConsciousnessState&, State);
+
+/**
+ * @brief Replicates the owner's unified consciousness state to clients.
+ *
+ * Just before the owner replicates, the server copies the replicated fields of the sibling DUIDSOrchestrator's
+ * state (not its sigil nodes, gems or full thread list); the property is sent through
+ * FUnifiedConsciousnessState::NetDeltaSerialize, so each connection only receives the field groups that
+ * moved by a quantization step since its last acknowledged update. The owner's net update frequency is
+ * scaled between MinUpdateHz and MaxUpdateHz by the distance to the nearest local view, and a large
+ * emotional jump forces an update regardless.
+ */
+UCLASS(ClassGroup=(HexademicComponents), meta=(BlueprintSpawnableComponent))
+class HEXADEMICPLUGIN_API UHexademicConsciousnessReplicationComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UHexademicConsciousnessReplicationComponent();
+
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+    virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+public:
+    /** Replicated fields only: as last sent on the server, as last received on clients. */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Replication")
+    const FUnifiedConsciousnessState& GetReplicatedState() const { return ReplicatedState; }
+
+    UPROPERTY(BlueprintAssignable, Category = "Replication|Events")
+    FOnConsciousnessStateReplicated OnConsciousnessStateReplicated;
+
+    /** Update rate for agents within NearDistance of a viewer. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication", meta = (ClampMin = "0.1"))
+    float MaxUpdateHz = 20.0f;
+
+    /** Update rate for agents at FarDistance or beyond. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication", meta = (ClampMin = "0.1"))
+    float MinUpdateHz = 2.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication")
+    float NearDistance = 1000.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication")
+    float FarDistance = 8000.0f;
+
+    /** A change in valence or arousal at least this large is sent without waiting for the next update. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication", meta = (ClampMin = "0.0"))
+    float EmotionalJumpThreshold = 0.25f;
+
+protected:
+    UPROPERTY(ReplicatedUsing = OnRep_ReplicatedState)
+    FUnifiedConsciousnessState ReplicatedState;
+
+    UFUNCTION()
+    void OnRep_ReplicatedState();
+
+private:
+    /** Scales the owner's NetUpdateFrequency by distance to the nearest player view. */
+    void UpdateRelevanceRate();
+
+    UPROPERTY()
+    TObjectPtr<UDUIDSOrchestrator> Orchestrator;
+
+    FEmotionalState LastForcedEmotion;
+    float RelevanceTimer = 0.0f;
+
+    static constexpr float RelevanceInterval = 0.5f;
+};
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Core/HexademicTuning.h"
 #include "HexademicCore.h"          // For FEmotionalState, FHapticMemoryContext, FCognitiveMemoryNode
 #include "Components/MemoryThreadComponent.generated.h"
 
@@ -39,6 +40,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
@@ -66,6 +68,13 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Memory Thread")
     TArray<FMemoryThread> GetAllMemoryThreads() const { return ActiveMemoryThreads; }
 
+    /**
+     * @brief Writes every memory thread to FilePath as JSON. The file is written on the thread pool.
+     * @param FilePath The full path of the file to create.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Memory Thread")
+    void ExportMemoriesToJSON(const FString& FilePath) const;
+
     // Reference to the main memory container to retrieve full memory nodes
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "References")
     TObjectPtr<UEluenMemoryContainerComponent> EluenMemoryContainer;
@@ -76,8 +85,13 @@ protected:
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Memory Thread Tuning")
     float MemoryLinkageThreshold = 0.6f; // How emotionally similar memories must be to link
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Memory Thread Tuning")
+    int32 MaxMemoryThreads = 1000; // Oldest thread is retired when a new one would exceed this
 
     // Internal helper to analyze a memory and link it
     void AnalyzeAndLinkMemory(const FString& NewMemoryID, const FEmotionalState& EmotionalImpact);
     FString GenerateNewThreadID();
+
+private:
+    FHexademicTuningBinding TuningBinding;
 };
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Core/HexademicTuning.h"
 #include "HexademicCore.h"          // For FEmotionalState
 #include "Core/EmotionalArchetype.h" // For EEmotionalArchetype
 #include "Components/MemoryThreadComponent.h" // For FMemoryThread
@@ -39,6 +40,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
@@ -79,4 +81,7 @@ protected:
     // Internal helper to update/create a trait based on emotional archetype and influencing memories
     void UpdateOrCreateTrait(FPersonalityTrait& Trait, EEmotionalArchetype Archetype, const TArray<FString>& InfluencingMemories, float ImpactStrength, float DeltaTime);
     FPersonalityTrait* FindTraitByName(const FString& TraitName);
+
+private:
+    FHexademicTuningBinding TuningBinding;
 };
@@ -8,6 +8,8 @@
 #include "Components/DecalComponent.h" // To project dynamic textures/materials
 #include "Particles/ParticleSystemComponent.h" // To spawn particle effects
 #include "Components/StaticMeshComponent.h" // To spawn static meshes for sigils
+#include "Subsystems/SigilVisualPoolSubsystem.h" // For FSigilVisualHandle
+#include "Visuals/SigilLifetimeTable.h"
 
 #include "Components/SigilProjectionComponent.generated.h"
 
@@ -54,19 +56,22 @@ protected:
     TSubclassOf<UParticleSystemComponent> ParticleComponentClass;
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sigil Visuals")
     TSubclassOf<UStaticMeshComponent> StaticMeshComponentClass;
+
+    // Mesh for instanced sigils; when unset, the mesh preset on StaticMeshComponentClass is used
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sigil Visuals")
+    TObjectPtr<UStaticMesh> SigilMesh;
     
-    // Default material to apply to projected sigils (dynamic material instance will be created)
+    // Default material for projected sigils. Decals and particles get a pooled dynamic instance of it;
+    // instanced meshes share it and read color and intensity from per-instance custom data.
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sigil Visuals")
     TObjectPtr<UMaterialInterface> DefaultSigilMaterial;
 
-    // Map to keep track of active sigil projections by their ID
-    UPROPERTY()
-    TMap<FString, FSigilProjection> ActiveSigilData; // Stores the data
-    UPROPERTY()
-    TMap<FString, TObjectPtr<UPrimitiveComponent>> ActiveSigilVisuals; // Stores the actual visual component
+    // Active sigil projections, each with its pooled visual. The component only ticks while there are any.
+    TSigilLifetimeTable<FSigilVisualHandle> ActiveSigils;
+
+    // Owner root transform the visuals were last placed against; instanced visuals only move when it changes
+    FTransform LastOwnerTransform;
 
-    // Helper to spawn and configure a visual component for a sigil
-    UPrimitiveComponent* SpawnSigilVisualComponent(const FSigilProjection& SigilData);
-    // Helper to update visual properties from FSigilProjection data
-    void UpdateSigilVisualProperties(UPrimitiveComponent* VisualComponent, UMaterialInstanceDynamic* DynamicMaterial, const FSigilProjection& SigilData);
+    // Which pooled visual new sigils use, from the settings above
+    FSigilVisualStyle GetVisualStyle() const;
 };
@@ -6,6 +6,8 @@
 #include "Core/HexadecimalStateLattice.h" // For FHexadecimalStateLattice
 #include "Misc/DateTime.h"
 
+class UPackageMap;
+
 /**
  * @brief Represents a consolidated, high-level consciousness state for an entity.
  * This can be used for AI decision-making, networking, and general state tracking,
@@ -98,4 +100,16 @@ struct HEXADEMICPLUGIN_API FConsciousnessState
         );
         return Desc;
     }
+
+    /** Replicates the scalars at 8 bits and the lattice as nibbles; the receiver stamps LastUpdateTime on arrival. */
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FConsciousnessState> : public TStructOpsTypeTraitsBase2<FConsciousnessState>
+{
+    enum
+    {
+        WithNetSerializer = true,
+    };
 };
@@ -27,6 +27,12 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Consent")
     bool CheckConsentGate(FString Region, float IncomingStimulus);
 
+    /**
+     * @brief CheckConsentGate for an already resolved region; one table read, no string work.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Consent")
+    bool CheckConsentGateForRegion(EHexademicBodyRegion Region, float IncomingStimulus);
+
     /**
      * @brief Records a consent node ritual, updating the system's understanding of consent.
      * @param ConsentMark The FConsentNodeRitual to record.
@@ -36,9 +42,28 @@ public:
 
     // Map to store current consent states by region
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Consent State")
-    TMap<FString, FConsentNodeRitual> ConsentMap;
+    TMap<EHexademicBodyRegion, FConsentNodeRitual> ConsentMap;
+
+    // Stimulus above which a consented region warns of approaching refusal; applied as rituals are recorded
+    UPROPERTY(EditAnywhere, Category = "Consent", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float ConsentedStimulusThreshold = 0.3f;
+
+    // Stimulus above which an unconsented region refuses; applied as rituals are recorded
+    UPROPERTY(EditAnywhere, Category = "Consent", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float UnconsentedStimulusThreshold = 0.7f;
 
     // Optional: Reference to EmotionCognitionComponent to influence emotions on refusal
     // UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "References")
     // TObjectPtr<UEmotionCognitionComponent> EmotionMind;
+
+private:
+    /** What CheckConsentGateForRegion needs about a region, kept in step with ConsentMap by RecordConsentRitual. */
+    struct FRegionConsentGate
+    {
+        float StimulusThreshold = 0.0f;
+        bool bMapped = false; // Unmapped regions always refuse
+        bool bConsentGiven = false;
+    };
+
+    TBodyRegionArray<FRegionConsentGate> ConsentGates;
 };
@@ -19,5 +19,4 @@ public:
     void TriggerRegionFeedback(FString Region, float Intensity, float Duration);
 private:
     void RouteToHardware(const FAetherTouchPacket& Packet);
-    FString NormalizeRegion(FString Region);
 };
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+
+/**
+ * @brief Side table of sigil node IDs, keyed by the 32-bit handle FPackedHexaSigilNode carries instead of a string.
+ *
+ * Keeping names out of the node is what lets the node stay plain data that the GPU reads as-is. Names are
+ * interned: the same ID gets the same handle while it is in the table, and 0 is the empty ID. Holders that keep
+ * a name alive (UHexademicWavefrontAPI's active nodes) take a reference with AddRef and drop it with Release; a
+ * name is removed when its last reference goes, and a name that was interned but never referenced is swept after
+ * a grace period. Handles carry a generation, so a stale copy of a removed name resolves to the empty ID rather
+ * than to whichever name reuses its slot. Handles are not stable across runs, so only the names should be saved.
+ */
+class HEXADEMICPLUGIN_API FHexaSigilNodeNames
+{
+public:
+    static FHexaSigilNodeNames& Get();
+
+    static constexpr uint32 NoName = 0;
+
+    /** The handle for SigilID, adding it on first use. Does not take a reference. */
+    uint32 FindOrAdd(FStringView SigilID);
+
+    /** The handle for SigilID, or NoName if it is not in the table. Never adds. */
+    uint32 Find(FStringView SigilID) const;
+
+    /** The ID behind Handle; empty for NoName, unknown or removed handles. */
+    FString GetName(uint32 Handle) const;
+
+    /** Keeps Handle's name in the table until the matching Release. */
+    void AddRef(uint32 Handle);
+    void Release(uint32 Handle);
+
+    int32 Num() const;
+
+private:
+    FHexaSigilNodeNames();
+
+    struct FEntry
+    {
+        FString Name;
+        uint32 Generation = 0;
+        int32 RefCount = 0;
+        double InternedSeconds = 0.0;
+    };
+
+    static constexpr uint32 IndexBits = 20;
+    static constexpr uint32 IndexMask = (1u << IndexBits) - 1;
+    static constexpr uint32 MaxGeneration = (1u << (32 - IndexBits)) - 1;
+    static constexpr double OrphanGraceSeconds = 30.0; // Interned names nobody referenced within this are swept
+    static constexpr int32 SweepInterval = 256;        // ...checked every this many additions
+
+    static uint32 MakeHandle(uint32 Index, uint32 Generation) { return Index | (Generation << IndexBits); }
+    /** The live entry behind Handle, or null. Caller holds Lock. */
+    FEntry* Resolve(uint32 Handle);
+    const FEntry* Resolve(uint32 Handle) const;
+    /** Caller holds the write lock. */
+    void RemoveEntry(uint32 Index);
+    void SweepOrphans();
+
+    mutable FRWLock Lock;
+    TArray<FEntry> Entries; // Indexed by the handle's low bits
+    TArray<uint32> FreeIndices;
+    TMap<FString, uint32> HandlesByName;
+    int32 AddsSinceSweep = 0;
+};
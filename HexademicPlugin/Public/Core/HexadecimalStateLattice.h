@@ -26,11 +26,11 @@ float FHexadecimalStateLattice::GetNormalizedScalar() const
 }
 
 // Implementation for Evolve
-void FHexadecimalStateLattice::Evolve(float Influence, float DeltaTime)
+void FHexadecimalStateLattice::Evolve(float Influence, float DeltaTime, FRandomStream& Random)
 {
     for (uint8& Val : StateVector)
     {
-        Val = FMath::Clamp((int32)Val + FMath::RandRange(-1, 1), 0, 0xF);
+        Val = FMath::Clamp((int32)Val + Random.RandRange(-1, 1), 0, 0xF);
     }
 
     Amplitude = FMath::Lerp(Amplitude, FMath::Abs(Influence), DeltaTime * 0.5f);
@@ -113,12 +113,22 @@ struct HEXADEMICPLUGIN_API FHexadecimalStateLattice
      */
     UFUNCTION(BlueprintCallable, Category = "Quantum Analog State")
     void Evolve(float Influence, float DeltaTime)
+    {
+        FRandomStream Random(FMath::Rand());
+        Evolve(Influence, DeltaTime, Random);
+    }
+
+    /**
+     * @brief Evolve, drawing its random shifts from Random. Code on the consciousness step passes the
+     * orchestrator's seeded stream (UDUIDSOrchestrator::GetConsciousnessRandom), so a replayed step repeats exactly.
+     */
+    void Evolve(float Influence, float DeltaTime, FRandomStream& Random)
     {
         // Example evolution logic (highly conceptual):
         // Modify StateVector based on influence (e.g., small random shifts, or shifts towards a 'target' pattern)
         for (uint8& Val : StateVector)
         {
-            Val = FMath::Clamp((int32)Val + FMath::RandRange(-1, 1), 0, 0xF);
+            Val = FMath::Clamp((int32)Val + Random.RandRange(-1, 1), 0, 0xF);
         }
 
         // Adjust Amplitude based on influence
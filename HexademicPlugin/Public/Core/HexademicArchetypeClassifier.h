@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HexademicCore.h" // For FEmotionalState
+#include "Core/EmotionalArchetype.h" // For EEmotionalArchetype
+
+/**
+ * @brief The one mapping from an emotional state to its dominant EEmotionalArchetype.
+ *
+ * The classification rule is evaluated once, at every cell centre of a quantized valence x arousal x
+ * intensity volume, and classifying a state is a single table lookup. Every consumer reading the same
+ * state therefore gets the same archetype, boundaries included. The table is built on first use and
+ * never changes afterwards, so it may be read from any thread.
+ */
+class HEXADEMICPLUGIN_API FHexademicArchetypeClassifier
+{
+public:
+    static const FHexademicArchetypeClassifier& Get();
+
+    /** Valence in [-1, 1], arousal and intensity in [0, 1]; out-of-range inputs are clamped. */
+    EEmotionalArchetype Classify(float Valence, float Arousal, float Intensity) const { return Table[GetCellIndex(Valence, Arousal, Intensity)]; }
+    EEmotionalArchetype Classify(const FEmotionalState& Emotion) const { return Classify(Emotion.Valence, Emotion.Arousal, Emotion.Intensity); }
+
+    /**
+     * @brief Classifies with hysteresis: Previous is kept while the state is within Margin of Previous's region,
+     * so states hovering on a boundary do not flicker between archetypes.
+     * @param Margin Distance in valence and arousal; 0 disables hysteresis.
+     */
+    EEmotionalArchetype ClassifyWithHysteresis(const FEmotionalState& Emotion, EEmotionalArchetype Previous, float Margin) const;
+
+    /**
+     * @brief Classifies a batch of states laid out as parallel arrays, four lanes per vector step.
+     * All views must have the same length.
+     */
+    void ClassifyBatch(TConstArrayView<float> Valence, TConstArrayView<float> Arousal, TConstArrayView<float> Intensity, TArrayView<EEmotionalArchetype> OutArchetypes) const;
+
+    /**
+     * @brief ClassifyBatch with ClassifyWithHysteresis's rule applied per state: the vector pass classifies every state,
+     * and only states whose archetype differs from their Previous one are re-checked against their Margin.
+     */
+    void ClassifyBatchWithHysteresis(TConstArrayView<float> Valence, TConstArrayView<float> Arousal, TConstArrayView<float> Intensity,
+        TConstArrayView<EEmotionalArchetype> Previous, TConstArrayView<float> Margin, TArrayView<EEmotionalArchetype> OutArchetypes) const;
+
+    /** Facial expression name shown for an archetype. */
+    static const TCHAR* GetExpressionName(EEmotionalArchetype Archetype);
+
+    /** Personality trait an archetype reinforces. */
+    static const TCHAR* GetTraitName(EEmotionalArchetype Archetype);
+
+    // Bin edges fall on every 0.05 of valence and arousal and every 0.1 of intensity, so the rule's thresholds sit exactly on them
+    static constexpr int32 ValenceBins = 40;
+    static constexpr int32 ArousalBins = 20;
+    static constexpr int32 IntensityBins = 10;
+
+    /** Number of EEmotionalArchetype values, for tables indexed by archetype */
+    static constexpr int32 NumArchetypes = static_cast<int32>(EEmotionalArchetype::Curiosity) + 1;
+
+private:
+    FHexademicArchetypeClassifier();
+
+    static int32 GetCellIndex(float Valence, float Arousal, float Intensity)
+    {
+        const int32 V = FMath::Clamp(static_cast<int32>((Valence + 1.0f) * (ValenceBins * 0.5f)), 0, ValenceBins - 1);
+        const int32 A = FMath::Clamp(static_cast<int32>(Arousal * ArousalBins), 0, ArousalBins - 1);
+        const int32 I = FMath::Clamp(static_cast<int32>(Intensity * IntensityBins), 0, IntensityBins - 1);
+        return V + ValenceBins * (A + ArousalBins * I);
+    }
+
+    /** Previous if the state at (V, A, I) is within Margin of Previous's region, Current otherwise. */
+    EEmotionalArchetype ApplyHysteresis(EEmotionalArchetype Current, float V, float A, float I, EEmotionalArchetype Previous, float Margin) const;
+
+    /** The classification rule itself; only ever evaluated at cell centres while building the table. */
+    static EEmotionalArchetype ClassifyReference(float Valence, float Arousal, float Intensity);
+
+    EEmotionalArchetype Table[ValenceBins * ArousalBins * IntensityBins];
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HexademicBodyRegions.generated.h"
+
+/** Body regions known to the haptic path. Values are small, dense and stable, so they index per-region tables directly. */
+UENUM(BlueprintType)
+enum class EHexademicBodyRegion : uint8
+{
+    Unknown,
+    FullBody,   // Whole-skin effects rather than a touch location
+    Face,
+    Chest,
+    Spine,
+    Hand,
+    Forearm,
+    Thigh,
+    Pelvis,
+    Foot,
+    Clitoris,
+    Count UMETA(Hidden)
+};
+
+/** Number of EHexademicBodyRegion values, Unknown included; the size of every per-region table. */
+static constexpr int32 NumHexademicBodyRegions = static_cast<int32>(EHexademicBodyRegion::Count);
+
+/** One value per body region, indexed by EHexademicBodyRegion. */
+template <typename ElementType>
+class TBodyRegionArray
+{
+public:
+    TBodyRegionArray() { Fill(ElementType()); }
+    explicit TBodyRegionArray(const ElementType& InitialValue) { Fill(InitialValue); }
+
+    ElementType& operator[](EHexademicBodyRegion Region) { return Values[static_cast<int32>(Region)]; }
+    const ElementType& operator[](EHexademicBodyRegion Region) const { return Values[static_cast<int32>(Region)]; }
+
+    /** False for values past Count, e.g. a region cast from unchecked data. */
+    static bool IsValidIndex(EHexademicBodyRegion Region) { return static_cast<int32>(Region) < NumHexademicBodyRegions; }
+
+    void Fill(const ElementType& Value)
+    {
+        for (ElementType& Element : Values) Element = Value;
+    }
+
+private:
+    ElementType Values[NumHexademicBodyRegions];
+};
+
+/**
+ * @brief Maps region tags to EHexademicBodyRegion.
+ *
+ * Canonical names and their aliases ("Thighs", "Leg", "Waist", "Overall"...) are entered into one FName table
+ * when the registry is first used, so resolving a tag is a single case-insensitive name lookup with no string
+ * allocation. Tags that match no alias fall back to the substring rules UGlyph_AetherSkin used to apply to
+ * every packet. Resolve tags where they enter the system and carry the region from there on. The registry
+ * never changes after construction, so it may be read from any thread.
+ */
+class HEXADEMICPLUGIN_API FHexademicBodyRegionRegistry
+{
+public:
+    static const FHexademicBodyRegionRegistry& Get();
+
+    /** Region for a tag; surrounding whitespace and case are ignored. Unknown when nothing matches. */
+    EHexademicBodyRegion ResolveTag(FStringView Tag) const;
+    EHexademicBodyRegion Resolve(FName Alias) const;
+
+    /** Canonical name of a region, e.g. "Spine". */
+    FName GetName(EHexademicBodyRegion Region) const { return Names[Region]; }
+
+    /** Canonical name as a string, for packets, logs and recordings. */
+    const FString& GetTag(EHexademicBodyRegion Region) const { return Tags[Region]; }
+
+private:
+    FHexademicBodyRegionRegistry();
+
+    void AddAlias(const TCHAR* Alias, EHexademicBodyRegion Region);
+
+    /** The legacy Contains chain; only reached by tags that are not in the alias table. */
+    static EHexademicBodyRegion ResolveBySubstring(FStringView Tag);
+
+    TMap<FName, EHexademicBodyRegion> Aliases;
+    TBodyRegionArray<FName> Names;
+    TBodyRegionArray<FString> Tags;
+};
+
+/**
+ * Moves a string-keyed region map, the form per-region properties were saved in before regions had IDs, into
+ * Table and empties it. Keys resolve like any other tag; a key naming no region is logged and dropped.
+ */
+template <typename ElementType>
+void MigrateLegacyRegionMap(TMap<FString, ElementType>& Legacy, ElementType (&Table)[NumHexademicBodyRegions], const TCHAR* Context)
+{
+    for (const TPair<FString, ElementType>& Entry : Legacy)
+    {
+        const EHexademicBodyRegion Region = FHexademicBodyRegionRegistry::Get().ResolveTag(Entry.Key);
+        if (Region == EHexademicBodyRegion::Unknown)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[BodyRegions] %s: dropped legacy entry '%s', which names no body region"), Context, *Entry.Key);
+            continue;
+        }
+        Table[static_cast<int32>(Region)] = Entry.Value;
+    }
+    Legacy.Empty();
+}
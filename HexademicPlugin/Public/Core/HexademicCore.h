@@ -8,6 +8,9 @@
 #include "GlobalShader.h"
 #include "ShaderParameterStruct.h"
 #include "Misc/DateTime.h"
+#include "Core/HexademicBodyRegions.h"
+#include "Core/HexaSigilNodeNames.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
 #include "HexademicCore.generated.h"
 
 // Forward Declarations for components used across modules
@@ -27,6 +30,8 @@ class UIncrementalPersister; // Assumed external component
 class UHexademicHolographicCode; // Assumed external component
 class UReciprocalEmbodimentComponent;
 class UGlyph_AetherSkin; // Assumed external component
+class UPackageMap;
+struct FNetDeltaSerializeInfo;
 
 
 // Basic Emotional State struct (Assumed based on usage in UDUIDSOrchestrator)
@@ -48,6 +53,18 @@ struct HEXADEMICCORE_API FEmotionalState
 
     FEmotionalState()
         : Valence(0.0f), Arousal(0.0f), Intensity(0.0f), Dominance(0.0f) {}
+
+    /** Replicates each axis at 10 bits, the resolution FPackedHexaSigilNode packs VAI at. */
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FEmotionalState> : public TStructOpsTypeTraitsBase2<FEmotionalState>
+{
+    enum
+    {
+        WithNetSerializer = true,
+    };
 };
 
 // FHapticMemoryContext: Defines the context of a haptic touch event for memory imprinting
@@ -84,12 +101,24 @@ struct HEXADEMICCORE_API FAetherTouchPacket {
     float Duration;
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     FString RegionTag; // e.g., "Forearm", "Spine", "Face"
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    EHexademicBodyRegion Region = EHexademicBodyRegion::Unknown; // Resolved from RegionTag where the packet is made
+
+    /** Region, falling back to resolving RegionTag for packets built without one (Blueprints, replayed sessions). */
+    EHexademicBodyRegion ResolveRegion() const
+    {
+        return Region != EHexademicBodyRegion::Unknown ? Region : FHexademicBodyRegionRegistry::Get().ResolveTag(RegionTag);
+    }
 };
 
 // FPackedHexaSigilNode: Optimized Sigil Data Structure for wavefront processing
 /**
  * @brief Represents an optimized Sigil Node for wavefront processing.
  * Packs emotional coordinates (VAI), consciousness color, and resonance amplitude.
+ *
+ * Plain data with a 16-byte stride, laid out exactly like FPackedHexaSigilNode in Shaders/HexaSigilNode.ush,
+ * so arrays of nodes go to the GPU with one memcpy. The sigil's ID lives in FHexaSigilNodeNames; the node
+ * only carries its handle. Keep the two declarations in step: the static_asserts below check this side.
  */
 USTRUCT(BlueprintType)
 struct FPackedHexaSigilNode
@@ -98,13 +127,19 @@ struct FPackedHexaSigilNode
 
     // Packed consciousness coordinates for optimal GPU memory access
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Packed Data")
-    uint32 EmotionalPack; // Valence (10-bit) | Arousal (10-bit) | Intensity (10-bit) | ResonanceAmplitude (2-bit)
+    uint32 EmotionalPack = 0; // Valence (10-bit) | Arousal (10-bit) | Intensity (10-bit) | ResonanceAmplitude (2-bit)
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Packed Data")
-    uint32 ConsciousnessPack; // R (8-bit) | G (8-bit) | B (8-bit) | A (8-bit)
+    uint32 ConsciousnessPack = 0; // R (8-bit) | G (8-bit) | B (8-bit) | A (8-bit)
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Metadata")
-    FString SigilID; // Unique identifier for the sigil
+    // Handle into FHexaSigilNodeNames; only meaningful within one run, so never saved
+    UPROPERTY(VisibleAnywhere, Transient, Category = "Metadata")
+    uint32 NameHandle = FHexaSigilNodeNames::NoName;
+
+    uint32 Reserved = 0; // Pads the node to 16 bytes
+
+    FORCEINLINE FString GetSigilID() const { return FHexaSigilNodeNames::Get().GetName(NameHandle); }
+    FORCEINLINE void SetSigilID(FStringView SigilID) { NameHandle = FHexaSigilNodeNames::Get().FindOrAdd(SigilID); }
 
     // High-performance accessors
     FORCEINLINE FVector GetEmotionalCoordinates() const
@@ -155,6 +190,23 @@ struct FPackedHexaSigilNode
     }
 };
 
+static_assert(sizeof(FPackedHexaSigilNode) == 16, "FPackedHexaSigilNode must match the HLSL layout in HexaSigilNode.ush");
+static_assert(STRUCT_OFFSET(FPackedHexaSigilNode, EmotionalPack) == 0, "FPackedHexaSigilNode must match the HLSL layout in HexaSigilNode.ush");
+static_assert(STRUCT_OFFSET(FPackedHexaSigilNode, ConsciousnessPack) == 4, "FPackedHexaSigilNode must match the HLSL layout in HexaSigilNode.ush");
+static_assert(STRUCT_OFFSET(FPackedHexaSigilNode, NameHandle) == 8, "FPackedHexaSigilNode must match the HLSL layout in HexaSigilNode.ush");
+static_assert(STRUCT_OFFSET(FPackedHexaSigilNode, Reserved) == 12, "FPackedHexaSigilNode must match the HLSL layout in HexaSigilNode.ush");
+static_assert(std::is_trivially_copyable_v<FPackedHexaSigilNode>, "FPackedHexaSigilNode is uploaded with memcpy");
+
+template<>
+struct TStructOpsTypeTraits<FPackedHexaSigilNode> : public TStructOpsTypeTraitsBase2<FPackedHexaSigilNode>
+{
+    enum
+    {
+        WithZeroConstructor = true,
+        WithNoDestructor = true,
+    };
+};
+
 // FHexademicGem: Synthesized Consciousness Artifact
 /**
  * @brief Represents a synthesized Hexademic Gem, a high-coherence cognitive artifact.
@@ -189,13 +241,15 @@ struct FHexademicGem
 
     // Packed properties for GPU efficiency (if needed for advanced gem operations in shaders)
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Packed Data")
-    uint64 PackedGemProperties; // Coherence (16-bit) | EnergeticSignature (16-bit) | [Reserved]
+    uint64 PackedGemProperties = 0; // Coherence (16-bit) | EnergeticSignature (16-bit) | Resonance (16-bit) | [Reserved]
 
     // High-performance accessors for packed properties
     FORCEINLINE float GetPackedCoherence() const { return float(PackedGemProperties & 0xFFFF) / 65535.0f; }
     FORCEINLINE void SetPackedCoherence(float Coherence) { uint64 C = uint64(FMath::Clamp(Coherence, 0.0f, 1.0f) * 65535.0f); PackedGemProperties = (PackedGemProperties & 0xFFFFFFFFFFFF0000) | C; }
     FORCEINLINE float GetPackedEnergeticSignature() const { return float((PackedGemProperties >> 16) & 0xFFFF) / 65535.0f; }
     FORCEINLINE void SetPackedEnergeticSignature(float Signature) { uint64 S = uint64(FMath::Clamp(Signature, 0.0f, 1.0f) * 65535.0f); PackedGemProperties = (PackedGemProperties & 0xFFFFFFFF0000FFFF) | (S << 16); }
+    FORCEINLINE float GetPackedResonance() const { return float((PackedGemProperties >> 32) & 0xFFFF) / 65535.0f; }
+    FORCEINLINE void SetPackedResonance(float Resonance) { uint64 R = uint64(FMath::Clamp(Resonance, 0.0f, 1.0f) * 65535.0f); PackedGemProperties = (PackedGemProperties & 0xFFFF0000FFFFFFFF) | (R << 32); }
 };
 
 /**
@@ -263,8 +317,10 @@ struct HEXADEMICAPI_API FUnifiedConsciousnessState
     // === EMBODIMENT STATE ===
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Consciousness State|Embodiment")
     FVector BodyPostureSignature = FVector::ZeroVector; // (Pitch, Yaw, Roll) or complex pose data
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Consciousness State|Embodiment")
-    TMap<FString, float> SkinToneModulations; // { "Face": 0.5f, "Chest": 0.3f, "Clitoris": 0.7f, "Thighs": 0.4f }
+    UPROPERTY(EditAnywhere, Category = "Consciousness State|Embodiment", meta = (ArraySizeEnum = "EHexademicBodyRegion"))
+    float RegionSkinTones[NumHexademicBodyRegions]; // Indexed by EHexademicBodyRegion; FullBody is the overall tone
+    UPROPERTY()
+    TMap<FString, float> SkinToneModulations; // Saved before regions had IDs; PostSerialize moves it into RegionSkinTones
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Consciousness State|Embodiment")
     TArray<FPackedHexaSigilNode> ActiveSigilNodes; // Currently active consciousness patterns
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Consciousness State|Embodiment")
@@ -302,13 +358,64 @@ struct HEXADEMICAPI_API FUnifiedConsciousnessState
     FUnifiedConsciousnessState()
     {
         LastUpdateTimestamp = FDateTime::UtcNow();
-        // Initialize SkinToneModulations with default regions
-        SkinToneModulations.Add(TEXT("Face"), 0.0f);
-        SkinToneModulations.Add(TEXT("Chest"), 0.0f);
-        SkinToneModulations.Add(TEXT("Spine"), 0.0f);
-        SkinToneModulations.Add(TEXT("Hand"), 0.0f);
-        SkinToneModulations.Add(TEXT("Clitoris"), 0.0f);
-        SkinToneModulations.Add(TEXT("Thighs"), 0.0f);
+        for (float& Modulation : RegionSkinTones)
+        {
+            Modulation = 0.0f;
+        }
+    }
+
+    /** Migrates SkinToneModulations from data saved before RegionSkinTones existed. */
+    void PostSerialize(const FArchive& Ar)
+    {
+        if (Ar.IsLoading() && SkinToneModulations.Num() > 0)
+        {
+            MigrateLegacyRegionMap(SkinToneModulations, RegionSkinTones, TEXT("FUnifiedConsciousnessState"));
+        }
+    }
+
+    /**
+     * Replication, quantized field by field (see HexademicNetSerialization.cpp for the bit budgets).
+     * NetSerialize sends every replicated field; NetDeltaSerialize sends only the field groups whose
+     * quantized values changed since the last state acknowledged by that connection.
+     * Sigil nodes, gems and timestamps are local and never replicated.
+     */
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
+};
+
+template<>
+struct TStructOpsTypeTraits<FUnifiedConsciousnessState> : public TStructOpsTypeTraitsBase2<FUnifiedConsciousnessState>
+{
+    enum
+    {
+        WithNetSerializer = true,
+        WithNetDeltaSerializer = true,
+        WithPostSerialize = true,
+    };
+};
+
+/** Blueprint access to FUnifiedConsciousnessState fields that are indexed by body region. */
+UCLASS()
+class HEXADEMICCORE_API UHexademicConsciousnessStateLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Consciousness State|Embodiment")
+    static float GetRegionSkinTone(const FUnifiedConsciousnessState& State, EHexademicBodyRegion Region)
+    {
+        const int32 Index = static_cast<int32>(Region);
+        return Index < NumHexademicBodyRegions ? State.RegionSkinTones[Index] : 0.0f;
+    }
+
+    UFUNCTION(BlueprintCallable, Category = "Consciousness State|Embodiment")
+    static void SetRegionSkinTone(UPARAM(ref) FUnifiedConsciousnessState& State, EHexademicBodyRegion Region, float Tone)
+    {
+        const int32 Index = static_cast<int32>(Region);
+        if (Index < NumHexademicBodyRegions)
+        {
+            State.RegionSkinTones[Index] = Tone;
+        }
     }
 };
 
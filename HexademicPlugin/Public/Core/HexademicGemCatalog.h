@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HexademicCore.h" // For FHexademicGem
+
+/** The 16-bit fields of FHexademicGem::PackedGemProperties, in lane order from the low bits. */
+enum class EHexademicGemField : uint8
+{
+    Coherence,
+    EnergeticSignature,
+    Resonance,
+    Count
+};
+
+/**
+ * @brief A filter over a gem catalog: inclusive bounds on packed fields, plus archetypes a gem must all carry.
+ * Bounds are in [0, 1] and quantized the same way FHexademicGem packs its fields, so a gem set to X passes AtLeast(X).
+ */
+struct HEXADEMICPLUGIN_API FHexademicGemQuery
+{
+    FHexademicGemQuery& AtLeast(EHexademicGemField Field, float Value);
+    FHexademicGemQuery& AtMost(EHexademicGemField Field, float Value);
+    FHexademicGemQuery& WithArchetype(uint32 ArchetypeID);
+
+    uint64 MinWord = 0;          // Lower bound of every field, packed like PackedGemProperties
+    uint64 MaxWord = MAX_uint64; // Upper bound of every field
+    TArray<uint32, TInlineAllocator<4>> ArchetypeIDs;
+};
+
+/**
+ * @brief Searchable index of synthesized gems that never unpacks them.
+ *
+ * Each gem is a row. Its PackedGemProperties word is kept in one contiguous column, and every archetype
+ * has a posting bitset of the rows that carry it. A query walks the rows 64 at a time: the postings of
+ * the required archetypes are ANDed into a candidate mask first, blocks with no candidates are skipped,
+ * and the rest are compared against the bounds one packed word per row, all four 16-bit lanes in a
+ * single SWAR comparison. Rows are never renumbered; removed rows are cleared from a live mask.
+ */
+class HEXADEMICPLUGIN_API FHexademicGemCatalog
+{
+public:
+    /** Adds Gem and returns its row. */
+    int32 Add(const FHexademicGem& Gem);
+
+    /** Replaces the fields and archetypes of a live row. */
+    void Update(int32 Row, const FHexademicGem& Gem);
+
+    void Remove(int32 Row);
+    void Empty();
+
+    /** Live gems. */
+    int32 Num() const { return NumLive; }
+
+    bool IsLive(int32 Row) const { return PackedWords.IsValidIndex(Row) && (LiveMask[Row >> 6] & (1ull << (Row & 63))) != 0; }
+
+    /** Appends the rows matching Query to OutRows, in row order. */
+    void Filter(const FHexademicGemQuery& Query, TArray<int32>& OutRows) const;
+
+    int32 Count(const FHexademicGemQuery& Query) const;
+
+    /** The K rows matching Query with the highest Field, highest first; ties go to the earlier row. */
+    void TopK(const FHexademicGemQuery& Query, EHexademicGemField Field, int32 K, TArray<int32>& OutRows) const;
+
+    /** Packed value of Field in Row, 0-65535. */
+    uint16 GetField(int32 Row, EHexademicGemField Field) const { return GetLane(PackedWords[Row], Field); }
+
+    static uint16 GetLane(uint64 Word, EHexademicGemField Field) { return static_cast<uint16>(Word >> (16 * static_cast<int32>(Field))); }
+    static uint16 Quantize(float Value) { return static_cast<uint16>(FMath::Clamp(Value, 0.0f, 1.0f) * 65535.0f); }
+
+private:
+    /** Calls OnMatches(BlockIndex, Mask) for every 64-row block with at least one match. */
+    template <typename FuncType>
+    void ForEachMatchBlock(const FHexademicGemQuery& Query, FuncType&& OnMatches) const;
+
+    void SetArchetypes(int32 Row, const TArray<uint32>& ArchetypeIDs);
+    void ClearArchetypes(int32 Row);
+
+    TArray<uint64> PackedWords;                        // PackedGemProperties by row
+    TArray<uint64> LiveMask;                           // One bit per row
+    TMap<uint32, TArray<uint64>> ArchetypePostings;    // One bit per row carrying the archetype
+    TArray<TArray<uint32, TInlineAllocator<4>>> RowArchetypes; // To clear postings on Update and Remove
+    int32 NumLive = 0;
+};
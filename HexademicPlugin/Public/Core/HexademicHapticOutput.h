@@ -0,0 +1,170 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/CriticalSection.h"
+#include "Core/HexademicBodyRegions.h"
+#include <atomic>
+
+class FArchive;
+class FEvent;
+class FRunnableThread;
+
+/** One actuation request for a body region, as handed to a haptic device. */
+struct FHexademicHapticPulse
+{
+    EHexademicBodyRegion Region = EHexademicBodyRegion::Unknown;
+    float Intensity = 0.0f;
+    float Duration = 0.0f;
+    double EnqueueSeconds = 0.0; // FPlatformTime::Seconds() of the oldest packet merged into this pulse
+
+    /** Folds another pulse for the same region in: the stronger intensity, covering both time spans. */
+    void Merge(const FHexademicHapticPulse& Other)
+    {
+        const double End = FMath::Max(EnqueueSeconds + Duration, Other.EnqueueSeconds + Other.Duration);
+        EnqueueSeconds = FMath::Min(EnqueueSeconds, Other.EnqueueSeconds);
+        Duration = static_cast<float>(End - EnqueueSeconds);
+        Intensity = FMath::Max(Intensity, Other.Intensity);
+    }
+};
+
+/** A pulse per region plus a bit per region that has one; the unit the game thread hands to the dispatcher. */
+struct FHexademicHapticFrame
+{
+    TBodyRegionArray<FHexademicHapticPulse> Pulses;
+    uint32 RegionMask = 0;
+
+    static_assert(NumHexademicBodyRegions <= 32, "RegionMask holds one bit per body region");
+
+    bool IsEmpty() const { return RegionMask == 0; }
+    bool Contains(EHexademicBodyRegion Region) const { return (RegionMask & (1u << static_cast<uint32>(Region))) != 0; }
+
+    void Add(const FHexademicHapticPulse& Pulse)
+    {
+        if (Contains(Pulse.Region))
+        {
+            Pulses[Pulse.Region].Merge(Pulse);
+        }
+        else
+        {
+            Pulses[Pulse.Region] = Pulse;
+            RegionMask |= 1u << static_cast<uint32>(Pulse.Region);
+        }
+    }
+
+    void Remove(EHexademicBodyRegion Region) { RegionMask &= ~(1u << static_cast<uint32>(Region)); }
+    void Reset() { RegionMask = 0; }
+};
+
+/**
+ * @brief A haptic output device: a suit SDK, a BLE bridge, or the loopback below.
+ *
+ * Every call is made from the dispatcher thread, never the game thread, so implementations may block on I/O.
+ * Each body region is one channel; the dispatcher never sends a channel more often than GetMinChannelInterval.
+ */
+class HEXADEMICPLUGIN_API IHexademicHapticDevice
+{
+public:
+    virtual ~IHexademicHapticDevice() = default;
+
+    virtual const TCHAR* GetDeviceName() const = 0;
+    virtual bool Open() = 0;
+    virtual void Close() = 0;
+
+    /** Actuates a batch of pulses, at most one per region. */
+    virtual void SendPulses(TConstArrayView<FHexademicHapticPulse> Pulses) = 0;
+
+    /** Shortest time between two pulses on one channel, in seconds. */
+    virtual double GetMinChannelInterval() const { return 1.0 / 60.0; }
+};
+
+/**
+ * @brief Device that actuates nothing: it timestamps what it receives, keeps the most recent pulses
+ * for inspection and, given a file path, appends each one as a CSV line (time, region, intensity,
+ * duration, latency in ms). Used until real suits are attached, by tests, and for latency measurement.
+ */
+class HEXADEMICPLUGIN_API FHexademicLoopbackHapticDevice : public IHexademicHapticDevice
+{
+public:
+    /** LogFilePath may be empty for an in-memory device; relative paths resolve under Saved/Hexademic/Haptics. */
+    explicit FHexademicLoopbackHapticDevice(const FString& LogFilePath = FString(), double SimulatedLatencySeconds = 0.0);
+    virtual ~FHexademicLoopbackHapticDevice() override;
+
+    virtual const TCHAR* GetDeviceName() const override { return TEXT("Loopback"); }
+    virtual bool Open() override;
+    virtual void Close() override;
+    virtual void SendPulses(TConstArrayView<FHexademicHapticPulse> Pulses) override;
+
+    struct FDeliveredPulse
+    {
+        FHexademicHapticPulse Pulse;
+        double DeliveredSeconds = 0.0;
+    };
+
+    /** Copies out the most recent deliveries, oldest first. Safe from any thread. */
+    void GetRecentDeliveries(TArray<FDeliveredPulse>& OutDeliveries) const;
+    int64 GetNumDelivered() const { return NumDelivered.load(std::memory_order_relaxed); }
+
+    static constexpr int32 MaxRecentDeliveries = 256;
+
+private:
+    FString LogFilePath;
+    double SimulatedLatencySeconds = 0.0;
+    TUniquePtr<FArchive> LogWriter; // Dispatcher thread only
+
+    mutable FCriticalSection RecentLock;
+    TArray<FDeliveredPulse> RecentDeliveries; // Ring of MaxRecentDeliveries, written at NextRecentIndex
+    int32 NextRecentIndex = 0;
+    std::atomic<int64> NumDelivered{0};
+};
+
+/**
+ * @brief Sends coalesced haptic frames to a device from a dedicated thread.
+ *
+ * The game thread submits at most one frame per tick, already merged per region. Submitting folds that
+ * frame into the single frame waiting for the worker, under a lock held for a few dozen stores, and wakes
+ * it; nothing ever queues up, so when the device is slow pulses merge instead of backing up. The worker
+ * holds pulses for channels still inside their rate limit, and drops any pulse older than MaxPulseAgeSeconds
+ * rather than play it late, so a pulse is either felt within that bound or not at all. Delivery latency,
+ * from the first packet merged into a pulse to the device returning, goes to the "Haptics.DispatchLatencyUs"
+ * histogram.
+ */
+class HEXADEMICPLUGIN_API FHexademicHapticDispatcher : public FRunnable
+{
+public:
+    FHexademicHapticDispatcher(const TSharedRef<IHexademicHapticDevice, ESPMode::ThreadSafe>& InDevice, double InMaxPulseAgeSeconds);
+    virtual ~FHexademicHapticDispatcher() override;
+
+    /** Game thread. Never blocks on the device. */
+    void Submit(const FHexademicHapticFrame& Frame);
+
+    const TSharedRef<IHexademicHapticDevice, ESPMode::ThreadSafe>& GetDevice() const { return Device; }
+
+    /** Any thread. Applies to pulses held from now on, including ones already waiting. */
+    void SetMaxPulseAge(double Seconds) { MaxPulseAgeSeconds.store(Seconds, std::memory_order_relaxed); }
+
+    // FRunnable
+    virtual bool Init() override;
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+    virtual void Exit() override;
+
+private:
+    /** Sends every held pulse whose channel is free; returns the seconds until the next held channel frees up. */
+    double SendReadyPulses(double NowSeconds);
+
+    TSharedRef<IHexademicHapticDevice, ESPMode::ThreadSafe> Device;
+    std::atomic<double> MaxPulseAgeSeconds;
+
+    FCriticalSection SubmitLock;
+    FHexademicHapticFrame Submitted; // Guarded by SubmitLock
+
+    // Dispatcher thread only
+    FHexademicHapticFrame Held;
+    TBodyRegionArray<double> ChannelReadyAtSeconds;
+    TArray<FHexademicHapticPulse, TInlineAllocator<NumHexademicBodyRegions>> Batch;
+
+    FEvent* WakeEvent = nullptr;
+    FRunnableThread* Thread = nullptr;
+    std::atomic<bool> bStopping{false};
+};
@@ -0,0 +1,342 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Fixed-capacity, delta-compressed history of multi-channel samples.
+ *
+ * Storage is a ring of segments allocated once. Each segment holds one full keyframe followed by
+ * up to SegmentLength - 1 frames stored as int16 deltas from that keyframe, quantized per channel.
+ * Appending is O(1). When the ring is full, the oldest segment is overwritten. A frame whose delta
+ * does not fit in int16 closes the segment early and becomes the next keyframe, so every stored
+ * value decodes to within half a quantization step. Integer channels use step 1 and are lossless.
+ */
+
+namespace HexademicHistory
+{
+    /** Delta encoding per value type: quantized for floating point, exact for integer lattice coordinates. */
+    inline bool EncodeDelta(float Value, float Key, float Step, int16& OutDelta)
+    {
+        const int32 Quantized = FMath::RoundToInt((Value - Key) / Step);
+        OutDelta = static_cast<int16>(Quantized);
+        return Quantized >= MIN_int16 && Quantized <= MAX_int16;
+    }
+    inline float DecodeDelta(float Key, int16 Delta, float Step) { return Key + Delta * Step; }
+
+    inline bool EncodeDelta(uint64 Value, uint64 Key, float /*Step*/, int16& OutDelta)
+    {
+        const int64 Difference = static_cast<int64>(Value - Key); // Two's complement wraps correctly
+        OutDelta = static_cast<int16>(Difference);
+        return Difference >= MIN_int16 && Difference <= MAX_int16;
+    }
+    inline uint64 DecodeDelta(uint64 Key, int16 Delta, float /*Step*/) { return Key + static_cast<uint64>(static_cast<int64>(Delta)); }
+}
+
+/** How QueryDownsampled reduces a channel's frames within a bucket. */
+enum class EHexademicHistoryDownsampling : uint8
+{
+    Mean,   // Continuous values
+    Last    // Enums and other discrete codes, where a mean would name a value nobody held
+};
+
+/** Per-channel summary over a range of frames. */
+template<int32 NumChannels>
+struct THexademicHistoryStats
+{
+    int32 NumFrames = 0;
+    double Min[NumChannels];
+    double Max[NumChannels];
+    double Mean[NumChannels];
+
+    THexademicHistoryStats()
+    {
+        for (int32 c = 0; c < NumChannels; c++) { Min[c] = Max[c] = Mean[c] = 0.0; }
+    }
+};
+
+template<typename ValueType, int32 NumChannels>
+class THexademicHistoryStore
+{
+public:
+    struct FFrame
+    {
+        double TimeSeconds = 0.0;
+        ValueType Values[NumChannels] = {};
+    };
+
+    using FStats = THexademicHistoryStats<NumChannels>;
+
+    /** Allocates nothing until Configure (or the first Add, which uses DefaultSegmentLength x DefaultNumSegments). */
+    THexademicHistoryStore() = default;
+
+    /**
+     * @param InSegmentLength Frames per keyframe (keyframe interval).
+     * @param InNumSegments Segments kept; capacity is roughly SegmentLength * NumSegments frames.
+     * @param InQuantizationSteps One step per channel, ignored for integer channels. Defaults to 1/1024.
+     */
+    THexademicHistoryStore(int32 InSegmentLength, int32 InNumSegments, const float* InQuantizationSteps = nullptr)
+    {
+        Configure(InSegmentLength, InNumSegments, InQuantizationSteps);
+    }
+
+    static constexpr int32 DefaultSegmentLength = 32;
+    static constexpr int32 DefaultNumSegments = 64;
+
+    /** Sets how Channel is reduced by QueryDownsampled; every channel is averaged unless told otherwise. */
+    void SetChannelDownsampling(int32 Channel, EHexademicHistoryDownsampling Mode)
+    {
+        check(Channel >= 0 && Channel < NumChannels);
+        ChannelDownsampling[Channel] = Mode;
+    }
+
+    /** Reallocates storage and drops all frames. */
+    void Configure(int32 InSegmentLength, int32 InNumSegments, const float* InQuantizationSteps = nullptr)
+    {
+        SegmentLength = FMath::Max(InSegmentLength, 1);
+        NumSegments = FMath::Max(InNumSegments, 2); // The open segment plus at least one closed one
+        for (int32 c = 0; c < NumChannels; c++)
+        {
+            QuantizationSteps[c] = InQuantizationSteps ? FMath::Max(InQuantizationSteps[c], KINDA_SMALL_NUMBER) : 1.0f / 1024.0f;
+        }
+
+        Keyframes.SetNumZeroed(NumSegments * NumChannels);
+        Deltas.SetNumZeroed(NumSegments * SegmentLength * NumChannels);
+        FrameTimes.SetNumZeroed(NumSegments * SegmentLength);
+        SegmentFrameCounts.SetNumZeroed(NumSegments);
+        Reset();
+    }
+
+    void Reset()
+    {
+        FMemory::Memzero(SegmentFrameCounts.GetData(), SegmentFrameCounts.Num() * sizeof(int32));
+        OldestSegment = 0;
+        NewestSegment = INDEX_NONE;
+        NumFrames = 0;
+    }
+
+    /** Appends one frame; Values holds NumChannels entries. Timestamps are expected to be non-decreasing. */
+    void Add(double TimeSeconds, const ValueType* Values)
+    {
+        if (NumSegments == 0)
+        {
+            Configure(DefaultSegmentLength, DefaultNumSegments);
+        }
+
+        int16 Encoded[NumChannels];
+        bool bNeedsKeyframe = NewestSegment == INDEX_NONE || SegmentFrameCounts[NewestSegment] >= SegmentLength;
+        if (!bNeedsKeyframe)
+        {
+            const ValueType* Key = &Keyframes[NewestSegment * NumChannels];
+            for (int32 c = 0; c < NumChannels && !bNeedsKeyframe; c++)
+            {
+                bNeedsKeyframe = !HexademicHistory::EncodeDelta(Values[c], Key[c], QuantizationSteps[c], Encoded[c]);
+            }
+        }
+
+        if (bNeedsKeyframe)
+        {
+            OpenSegment();
+            FMemory::Memcpy(&Keyframes[NewestSegment * NumChannels], Values, NumChannels * sizeof(ValueType));
+            FMemory::Memzero(Encoded, sizeof(Encoded));
+        }
+
+        const int32 Slot = NewestSegment * SegmentLength + SegmentFrameCounts[NewestSegment];
+        FMemory::Memcpy(&Deltas[Slot * NumChannels], Encoded, sizeof(Encoded));
+        FrameTimes[Slot] = TimeSeconds;
+        SegmentFrameCounts[NewestSegment]++;
+        NumFrames++;
+    }
+
+    int32 Num() const { return NumFrames; }
+    bool IsEmpty() const { return NumFrames == 0; }
+
+    /** Frames that fit when no segment closes early. */
+    int32 GetCapacity() const { return (NumSegments - 1) * SegmentLength; }
+
+    /** Bytes held by the store, for budgeting per-agent history. */
+    SIZE_T GetAllocatedSize() const
+    {
+        return Keyframes.GetAllocatedSize() + Deltas.GetAllocatedSize() + FrameTimes.GetAllocatedSize() + SegmentFrameCounts.GetAllocatedSize();
+    }
+
+    /** Decodes frame Index, where 0 is the oldest and Num() - 1 the newest. */
+    bool GetFrame(int32 Index, FFrame& OutFrame) const
+    {
+        if (Index < 0 || Index >= NumFrames) return false;
+
+        for (int32 i = 0, Segment = OldestSegment; i < NumSegments; i++, Segment = (Segment + 1) % NumSegments)
+        {
+            const int32 Count = SegmentFrameCounts[Segment];
+            if (Index < Count)
+            {
+                DecodeFrame(Segment, Index, OutFrame);
+                return true;
+            }
+            Index -= Count;
+        }
+        return false;
+    }
+
+    bool GetLatest(FFrame& OutFrame) const { return GetFrame(NumFrames - 1, OutFrame); }
+
+    /**
+     * Calls Visitor(const FFrame&) for every frame with StartTime <= TimeSeconds <= EndTime, oldest first.
+     * Segments entirely outside the range are skipped without decoding.
+     */
+    template<typename VisitorType>
+    void ForEachInRange(double StartTime, double EndTime, VisitorType&& Visitor) const
+    {
+        FFrame Frame;
+        for (int32 i = 0, Segment = OldestSegment; i < NumSegments; i++, Segment = (Segment + 1) % NumSegments)
+        {
+            const int32 Count = SegmentFrameCounts[Segment];
+            if (Count == 0) continue;
+
+            const int32 FirstSlot = Segment * SegmentLength;
+            if (FrameTimes[FirstSlot + Count - 1] < StartTime) continue;
+            if (FrameTimes[FirstSlot] > EndTime) break;
+
+            for (int32 FrameIndex = 0; FrameIndex < Count; FrameIndex++)
+            {
+                const double Time = FrameTimes[FirstSlot + FrameIndex];
+                if (Time < StartTime) continue;
+                if (Time > EndTime) return;
+                DecodeFrame(Segment, FrameIndex, Frame);
+                Visitor(static_cast<const FFrame&>(Frame));
+            }
+        }
+    }
+
+    /** Frames in [StartTime, EndTime]. */
+    void QueryRange(double StartTime, double EndTime, TArray<FFrame>& OutFrames) const
+    {
+        OutFrames.Reset();
+        ForEachInRange(StartTime, EndTime, [&OutFrames](const FFrame& Frame) { OutFrames.Add(Frame); });
+    }
+
+    /**
+     * Splits [StartTime, EndTime] into NumBuckets equal time slices and returns the mean of each non-empty one,
+     * timestamped at the bucket's mean time. Integer channels are averaged and truncated; channels set to
+     * EHexademicHistoryDownsampling::Last take the bucket's newest value instead.
+     */
+    void QueryDownsampled(double StartTime, double EndTime, int32 NumBuckets, TArray<FFrame>& OutFrames) const
+    {
+        OutFrames.Reset();
+        if (NumBuckets <= 0 || EndTime < StartTime) return;
+
+        TArray<double> Sums;
+        Sums.SetNumZeroed(NumBuckets * (NumChannels + 1));
+        TArray<int32> Counts;
+        Counts.SetNumZeroed(NumBuckets);
+        TArray<ValueType> LastValues;
+        LastValues.SetNumZeroed(NumBuckets * NumChannels);
+
+        const double BucketWidth = FMath::Max((EndTime - StartTime) / NumBuckets, UE_DOUBLE_SMALL_NUMBER);
+        ForEachInRange(StartTime, EndTime, [&](const FFrame& Frame)
+        {
+            const int32 Bucket = FMath::Min(static_cast<int32>((Frame.TimeSeconds - StartTime) / BucketWidth), NumBuckets - 1);
+            double* Sum = &Sums[Bucket * (NumChannels + 1)];
+            Sum[0] += Frame.TimeSeconds;
+            for (int32 c = 0; c < NumChannels; c++) { Sum[c + 1] += static_cast<double>(Frame.Values[c]); }
+            FMemory::Memcpy(&LastValues[Bucket * NumChannels], Frame.Values, NumChannels * sizeof(ValueType)); // Frames arrive oldest first
+            Counts[Bucket]++;
+        });
+
+        for (int32 Bucket = 0; Bucket < NumBuckets; Bucket++)
+        {
+            if (Counts[Bucket] == 0) continue;
+            const double* Sum = &Sums[Bucket * (NumChannels + 1)];
+            FFrame& Out = OutFrames.AddDefaulted_GetRef();
+            Out.TimeSeconds = Sum[0] / Counts[Bucket];
+            for (int32 c = 0; c < NumChannels; c++)
+            {
+                Out.Values[c] = ChannelDownsampling[c] == EHexademicHistoryDownsampling::Last
+                    ? LastValues[Bucket * NumChannels + c]
+                    : static_cast<ValueType>(Sum[c + 1] / Counts[Bucket]);
+            }
+        }
+    }
+
+    /** Min, max and mean per channel over [StartTime, EndTime]. */
+    FStats ComputeStats(double StartTime, double EndTime) const
+    {
+        FStats Stats;
+        for (int32 c = 0; c < NumChannels; c++)
+        {
+            Stats.Min[c] = TNumericLimits<double>::Max();
+            Stats.Max[c] = TNumericLimits<double>::Lowest();
+        }
+        ForEachInRange(StartTime, EndTime, [&Stats](const FFrame& Frame)
+        {
+            for (int32 c = 0; c < NumChannels; c++)
+            {
+                const double Value = static_cast<double>(Frame.Values[c]);
+                Stats.Min[c] = FMath::Min(Stats.Min[c], Value);
+                Stats.Max[c] = FMath::Max(Stats.Max[c], Value);
+                Stats.Mean[c] += Value;
+            }
+            Stats.NumFrames++;
+        });
+        for (int32 c = 0; c < NumChannels; c++)
+        {
+            if (Stats.NumFrames > 0) { Stats.Mean[c] /= Stats.NumFrames; }
+            else { Stats.Min[c] = Stats.Max[c] = 0.0; }
+        }
+        return Stats;
+    }
+
+    /** Oldest and newest stored timestamps; false if empty. */
+    bool GetTimeSpan(double& OutOldest, double& OutNewest) const
+    {
+        if (NumFrames == 0) return false;
+        OutOldest = FrameTimes[OldestSegment * SegmentLength];
+        OutNewest = FrameTimes[NewestSegment * SegmentLength + SegmentFrameCounts[NewestSegment] - 1];
+        return true;
+    }
+
+private:
+    void OpenSegment()
+    {
+        if (NewestSegment == INDEX_NONE)
+        {
+            NewestSegment = OldestSegment;
+        }
+        else
+        {
+            NewestSegment = (NewestSegment + 1) % NumSegments;
+            if (NewestSegment == OldestSegment)
+            {
+                // Ring is full: the oldest segment is recycled
+                NumFrames -= SegmentFrameCounts[OldestSegment];
+                OldestSegment = (OldestSegment + 1) % NumSegments;
+            }
+        }
+        SegmentFrameCounts[NewestSegment] = 0;
+    }
+
+    void DecodeFrame(int32 Segment, int32 FrameIndex, FFrame& OutFrame) const
+    {
+        const int32 Slot = Segment * SegmentLength + FrameIndex;
+        const ValueType* Key = &Keyframes[Segment * NumChannels];
+        const int16* Delta = &Deltas[Slot * NumChannels];
+        OutFrame.TimeSeconds = FrameTimes[Slot];
+        for (int32 c = 0; c < NumChannels; c++)
+        {
+            OutFrame.Values[c] = HexademicHistory::DecodeDelta(Key[c], Delta[c], QuantizationSteps[c]);
+        }
+    }
+
+    int32 SegmentLength = 0;
+    int32 NumSegments = 0;
+    float QuantizationSteps[NumChannels] = {};
+    EHexademicHistoryDownsampling ChannelDownsampling[NumChannels] = {};
+
+    TArray<ValueType> Keyframes;       // NumSegments x NumChannels
+    TArray<int16> Deltas;              // NumSegments x SegmentLength x NumChannels
+    TArray<double> FrameTimes;         // NumSegments x SegmentLength
+    TArray<int32> SegmentFrameCounts;  // NumSegments
+
+    int32 OldestSegment = 0;
+    int32 NewestSegment = INDEX_NONE;
+    int32 NumFrames = 0;
+};
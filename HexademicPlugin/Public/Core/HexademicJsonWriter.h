@@ -0,0 +1,207 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Class.h"
+#include "Containers/Queue.h"
+#include <atomic>
+
+/**
+ * @brief Writes a file from a sequence of byte chunks, on the thread pool and in order.
+ *
+ * The game thread fills a buffer, hands it over with Submit and receives an empty one back; the bytes are
+ * written on a pool thread while the game thread carries on. Buffers are recycled between the two sides,
+ * and at most MaxChunksInFlight are ever outstanding, so a file of any size is written with a fixed amount
+ * of memory: once that many chunks are waiting on the disk, Submit waits for one to be written.
+ * Owned and fed by one thread. Chunks go to a uniquely named temp file beside FilePath, which the last chunk
+ * moves into place: readers never see a partial file, and streams racing on one path each land whole.
+ */
+class HEXADEMICPLUGIN_API FHexademicJsonFileStream
+{
+public:
+    static constexpr int32 ChunkBytes = 64 * 1024;
+    static constexpr int32 MaxChunksInFlight = 4;
+
+    /** Nothing is opened until the first chunk is written; FilePath is replaced once the last one is. */
+    explicit FHexademicJsonFileStream(const FString& FilePath);
+
+    /** Closes the stream if Close was not called. */
+    ~FHexademicJsonFileStream();
+
+    /** Queues Buffer's bytes for writing and replaces it with an empty recycled buffer. */
+    void Submit(TArray<uint8>& Buffer);
+
+    /** Queues Buffer's bytes, if any, as the last chunk. The stream takes no more chunks afterwards. */
+    void Close(TArray<uint8>& Buffer);
+
+    /** Blocks until every chunk submitted so far is on disk. For shutdown paths that must not lose the file. */
+    void Flush();
+
+private:
+    struct FChunk
+    {
+        TArray<uint8> Bytes;
+        bool bLast = false;
+    };
+
+    /** Shared with the pool tasks, which may outlive the stream object. */
+    struct FState
+    {
+        FString FilePath;
+        FString TempPath;                                   // Written in place of FilePath until the last chunk
+        TUniquePtr<FArchive> File;                          // Pool threads only
+        TQueue<FChunk, EQueueMode::Spsc> Pending;           // Game thread to pool
+        TQueue<TArray<uint8>, EQueueMode::Spsc> Recycled;   // Pool to game thread
+        std::atomic<int32> NumInFlight{0};
+        std::atomic<bool> bDraining{false};
+        bool bOpenFailed = false;                           // Pool threads only
+        FEvent* ChunkWritten = nullptr;
+
+        ~FState();
+        void Drain();
+    };
+
+    void Enqueue(TArray<uint8>& Buffer, bool bLast);
+
+    TSharedRef<FState, ESPMode::ThreadSafe> State;
+    bool bClosed = false;
+};
+
+/**
+ * @brief Flat description of how a struct is written as a JSON object, built once per struct.
+ *
+ * Each field carries its key already quoted and escaped, its offset and a kind tag, so writing a known
+ * struct is one pass over a small array with no property lookups or name conversion. ForStruct derives
+ * a schema from reflection and caches it; hand-written schemas pick and rename fields of their own.
+ */
+class HEXADEMICPLUGIN_API FHexademicJsonSchema
+{
+public:
+    enum class EFieldKind : uint8
+    {
+        Bool,
+        Int32,
+        Int64,
+        Float,
+        Double,
+        String,
+        DateTime,
+        Struct,     // Written with the nested struct's own schema
+        Reflected   // Anything else: containers, enums, names, text, objects
+    };
+
+    struct FField
+    {
+        int32 KeyStart = 0;     // Range of KeyText holding "Key":
+        int32 KeyLen = 0;
+        int32 Offset = 0;
+        EFieldKind Kind = EFieldKind::Reflected;
+        const FProperty* Property = nullptr;        // For Reflected
+        const UScriptStruct* Struct = nullptr;      // For Struct
+    };
+
+    /** The schema of every reflected property of Struct, built on first use. Safe from any thread. */
+    static const FHexademicJsonSchema& ForStruct(const UScriptStruct* Struct);
+
+    /** Adds a field of a type the schema knows how to write, ValueType being one of the EFieldKind scalar types. */
+    template <typename ValueType>
+    FHexademicJsonSchema& Add(const ANSICHAR* Key, int32 Offset)
+    {
+        AddField(Key, Offset, KindOf(static_cast<const ValueType*>(nullptr)), nullptr, nullptr);
+        return *this;
+    }
+
+    TConstArrayView<FField> GetFields() const { return Fields; }
+    const uint8* GetKey(const FField& Field) const { return KeyText.GetData() + Field.KeyStart; }
+
+private:
+    void AddField(FAnsiStringView Key, int32 Offset, EFieldKind Kind, const FProperty* Property, const UScriptStruct* Struct);
+
+    static EFieldKind KindOf(const bool*) { return EFieldKind::Bool; }
+    static EFieldKind KindOf(const int32*) { return EFieldKind::Int32; }
+    static EFieldKind KindOf(const int64*) { return EFieldKind::Int64; }
+    static EFieldKind KindOf(const float*) { return EFieldKind::Float; }
+    static EFieldKind KindOf(const double*) { return EFieldKind::Double; }
+    static EFieldKind KindOf(const FString*) { return EFieldKind::String; }
+    static EFieldKind KindOf(const FDateTime*) { return EFieldKind::DateTime; }
+
+    TArray<FField> Fields;
+    TArray<uint8> KeyText;
+};
+
+/**
+ * @brief Streaming UTF-8 JSON emitter.
+ *
+ * Values go straight into a byte buffer as they are written; there is no intermediate FJsonObject tree and
+ * no FString for the whole document. Once the buffer has grown to its working size, writing allocates
+ * nothing. Given a FHexademicJsonFileStream, the writer hands the buffer over each time it passes
+ * ChunkBytes, so documents of any length are written with constant extra memory.
+ * Output is compact (no whitespace); non-finite numbers are written as null.
+ */
+class HEXADEMICPLUGIN_API FHexademicJsonWriter
+{
+public:
+    /** Appends to Buffer, which the caller keeps and reuses. */
+    explicit FHexademicJsonWriter(TArray<uint8>& InBuffer);
+
+    /** Writes through Buffer into Stream. Call Close when done; nothing is written to Stream before then if the document is small. */
+    FHexademicJsonWriter(TArray<uint8>& InBuffer, FHexademicJsonFileStream& InStream);
+
+    void BeginObject();
+    void BeginObject(FAnsiStringView Key) { WriteKey(Key); BeginObject(); }
+    void EndObject();
+    void BeginArray();
+    void BeginArray(FAnsiStringView Key) { WriteKey(Key); BeginArray(); }
+    void EndArray();
+
+    void WriteKey(FAnsiStringView Key);
+    void WriteKey(FStringView Key);
+
+    void WriteNull();
+    void WriteValue(bool Value);
+    void WriteValue(int32 Value) { WriteValue(static_cast<int64>(Value)); }
+    void WriteValue(int64 Value);
+    void WriteValue(uint64 Value);
+    void WriteValue(float Value);
+    void WriteValue(double Value);
+    void WriteValue(FStringView Value);
+    void WriteValue(const FString& Value) { WriteValue(FStringView(Value)); }
+    void WriteValue(const FDateTime& Value); // ISO 8601, as FDateTime::ToIso8601
+
+    template <typename ValueType>
+    void Write(FAnsiStringView Key, const ValueType& Value) { WriteKey(Key); WriteValue(Value); }
+
+    /** Writes Data as an object using Schema. */
+    void WriteObject(const FHexademicJsonSchema& Schema, const void* Data);
+
+    /** Writes Data as an object with the reflected schema of Struct. */
+    void WriteStruct(const UScriptStruct* Struct, const void* Data) { WriteObject(FHexademicJsonSchema::ForStruct(Struct), Data); }
+
+    template <typename StructType>
+    void WriteStruct(const StructType& Value) { WriteStruct(StructType::StaticStruct(), &Value); }
+
+    /** Writes one reflected value: the fallback for fields a schema does not flatten. Static arrays become JSON arrays. */
+    void WriteProperty(const FProperty* Property, const void* ValuePtr);
+
+    /** Ends the document: with a stream, queues what is left as the last chunk. */
+    void Close();
+
+private:
+    void BeforeValue();
+    void WriteRaw(const void* Data, int32 Num) { Buffer->Append(static_cast<const uint8*>(Data), Num); }
+    void WriteChar(ANSICHAR Char) { Buffer->Add(static_cast<uint8>(Char)); }
+    void WriteEscaped(FStringView Text);
+    void WriteEscaped(FAnsiStringView Text);
+    void WriteKeyBytes(const uint8* QuotedKey, int32 Num);
+    void WriteNameValue(FName Name, bool bStripEnumPrefix);
+    void WritePropertyValue(const FProperty* Property, const void* ValuePtr);
+    void WriteMapKey(const FProperty* KeyProperty, const void* KeyPtr, int32 Index);
+    void MaybeSubmit();
+
+    static constexpr int32 MaxDepth = 64;
+
+    TArray<uint8>* Buffer;
+    FHexademicJsonFileStream* Stream = nullptr;
+    uint64 HasElements = 0; // Bit per nesting depth: whether the next element there needs a comma
+    int32 Depth = 0;
+    bool bAfterKey = false;
+};
@@ -0,0 +1,197 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "HAL/CriticalSection.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include <atomic>
+#include "Core/HexademicMetrics.generated.h"
+
+// Stat group shared by every Hexademic stage scope ("stat Hexademic" in the console, or the CPU track in Insights)
+DECLARE_STATS_GROUP(TEXT("Hexademic"), STATGROUP_Hexademic, STATCAT_Advanced);
+
+/** The kind of value a registered metric holds. */
+UENUM(BlueprintType)
+enum class EHexademicMetricKind : uint8
+{
+    Counter     UMETA(DisplayName = "Counter"),   // Integer tally (memories stored, ledger bytes written, live sigils)
+    Gauge       UMETA(DisplayName = "Gauge"),     // Last-written value (registered consciousnesses, global sigils)
+    Histogram   UMETA(DisplayName = "Histogram")  // Distribution of samples (stage timings in microseconds)
+};
+
+/**
+ * @brief A point-in-time copy of one metric, safe to hand to Blueprint or the console.
+ * Only built when someone asks for it; the hot path never touches this struct.
+ */
+USTRUCT(BlueprintType)
+struct HEXADEMICPLUGIN_API FHexademicMetricSnapshot
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Metrics")
+    FName Name;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Metrics")
+    EHexademicMetricKind Kind = EHexademicMetricKind::Counter;
+
+    /** Counter total, or number of samples recorded into a histogram. */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Metrics")
+    int64 Count = 0;
+
+    /** Gauge value, or histogram mean. */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Metrics")
+    double Value = 0.0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Metrics")
+    double Min = 0.0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Metrics")
+    double Max = 0.0;
+
+    /** Histogram percentiles, estimated from the power-of-two buckets. */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Metrics")
+    double P50 = 0.0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Metrics")
+    double P95 = 0.0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Metrics")
+    double P99 = 0.0;
+};
+
+/** Stable index of a registered metric. Resolve once (usually into a function-local static), then use freely. */
+struct FHexademicMetricHandle
+{
+    int32 Index = INDEX_NONE;
+
+    FORCEINLINE bool IsValid() const { return Index != INDEX_NONE; }
+};
+
+/**
+ * @brief Process-wide, in-memory metrics registry for the consciousness stack.
+ * Registration takes a lock and is expected once per call site. Updates through a handle
+ * are lock-free atomics and never allocate, so they are safe from any thread and on the hot path.
+ */
+class HEXADEMICPLUGIN_API FHexademicMetricsRegistry
+{
+public:
+    static constexpr int32 MaxMetrics = 256;
+    static constexpr int32 NumHistogramBuckets = 32; // Bucket N holds samples in [2^(N-1), 2^N)
+
+    static FHexademicMetricsRegistry& Get();
+
+    /** Registers (or finds) a metric by name. Re-registering an existing name with another kind returns an invalid handle. */
+    FHexademicMetricHandle RegisterCounter(FName Name) { return Register(Name, EHexademicMetricKind::Counter); }
+    FHexademicMetricHandle RegisterGauge(FName Name) { return Register(Name, EHexademicMetricKind::Gauge); }
+    FHexademicMetricHandle RegisterHistogram(FName Name) { return Register(Name, EHexademicMetricKind::Histogram); }
+    FHexademicMetricHandle FindMetric(FName Name) const;
+
+    // === HOT PATH ===
+    void AddCounter(FHexademicMetricHandle Handle, int64 Delta = 1);
+    void SetGauge(FHexademicMetricHandle Handle, double Value);
+    void RecordSample(FHexademicMetricHandle Handle, double Value);
+
+    // === QUERIES ===
+    bool GetSnapshot(FName Name, FHexademicMetricSnapshot& OutSnapshot) const;
+    bool GetSnapshot(FHexademicMetricHandle Handle, FHexademicMetricSnapshot& OutSnapshot) const;
+    void GetAllSnapshots(TArray<FHexademicMetricSnapshot>& OutSnapshots) const;
+
+    /** Clears all values but keeps registrations (and therefore cached handles) valid. */
+    void ResetValues();
+
+    /** Writes every metric to the log. Used by the hexademic.Metrics.Dump console command. */
+    void DumpToLog() const;
+
+private:
+    FHexademicMetricsRegistry() = default;
+
+    FHexademicMetricHandle Register(FName Name, EHexademicMetricKind Kind);
+
+    // Fixed-point scale for histogram sums/min/max so they stay in plain int64 atomics
+    static constexpr double FixedPointScale = 1000.0;
+
+    struct FMetricSlot
+    {
+        FName Name;
+        EHexademicMetricKind Kind = EHexademicMetricKind::Counter;
+        std::atomic<int64> Count{0};
+        std::atomic<double> Gauge{0.0};
+        std::atomic<int64> FixedSum{0};
+        std::atomic<int64> FixedMin{MAX_int64};
+        std::atomic<int64> FixedMax{MIN_int64};
+        std::atomic<int64> Buckets[NumHistogramBuckets];
+    };
+
+    void ResetSlot(FMetricSlot& Slot);
+    void FillSnapshot(const FMetricSlot& Slot, FHexademicMetricSnapshot& OutSnapshot) const;
+
+    FMetricSlot Slots[MaxMetrics];
+    std::atomic<int32> NumSlots{0};
+    TMap<FName, int32> NameToIndex;
+    mutable FCriticalSection RegistrationLock;
+};
+
+/** Records the lifetime of a scope, in microseconds, into a histogram metric. */
+struct FHexademicScopedStageTimer
+{
+    explicit FHexademicScopedStageTimer(FHexademicMetricHandle InHandle)
+        : Handle(InHandle), StartCycles(FPlatformTime::Cycles64()) {}
+
+    ~FHexademicScopedStageTimer()
+    {
+        const double Microseconds = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0;
+        FHexademicMetricsRegistry::Get().RecordSample(Handle, Microseconds);
+    }
+
+private:
+    FHexademicMetricHandle Handle;
+    uint64 StartCycles;
+};
+
+/**
+ * Instruments a consciousness stage: stat cycle counter, Insights CPU scope and a timing histogram
+ * under the given metric name. The metric handle is resolved once per call site.
+ */
+#define HEXADEMIC_SCOPED_STAGE(StatId, MetricName) \
+    SCOPE_CYCLE_COUNTER(StatId); \
+    TRACE_CPUPROFILER_EVENT_SCOPE_STR(MetricName); \
+    static const FHexademicMetricHandle PREPROCESSOR_JOIN(HexStageHandle_, __LINE__) = FHexademicMetricsRegistry::Get().RegisterHistogram(TEXT(MetricName)); \
+    FHexademicScopedStageTimer PREPROCESSOR_JOIN(HexStageTimer_, __LINE__)(PREPROCESSOR_JOIN(HexStageHandle_, __LINE__))
+
+#define HEXADEMIC_COUNTER_ADD(MetricName, Delta) \
+    do { \
+        static const FHexademicMetricHandle HexCounterHandle = FHexademicMetricsRegistry::Get().RegisterCounter(TEXT(MetricName)); \
+        FHexademicMetricsRegistry::Get().AddCounter(HexCounterHandle, (Delta)); \
+    } while (0)
+
+#define HEXADEMIC_GAUGE_SET(MetricName, Value) \
+    do { \
+        static const FHexademicMetricHandle HexGaugeHandle = FHexademicMetricsRegistry::Get().RegisterGauge(TEXT(MetricName)); \
+        FHexademicMetricsRegistry::Get().SetGauge(HexGaugeHandle, (Value)); \
+    } while (0)
+
+/**
+ * @brief Blueprint access to the Hexademic metrics registry.
+ */
+UCLASS()
+class HEXADEMICPLUGIN_API UHexademicMetricsLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Reads a single metric by name (e.g. "Orchestrator.ConsciousnessUpdate", "Memory.Stored").
+     * @return True if the metric is registered.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Hexademic|Metrics")
+    static bool GetMetricSnapshot(FName MetricName, FHexademicMetricSnapshot& OutSnapshot);
+
+    /** @brief Reads every registered metric. */
+    UFUNCTION(BlueprintCallable, Category = "Hexademic|Metrics")
+    static TArray<FHexademicMetricSnapshot> GetAllMetricSnapshots();
+
+    /** @brief Clears all metric values; registrations are kept. */
+    UFUNCTION(BlueprintCallable, Category = "Hexademic|Metrics")
+    static void ResetMetrics();
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FUnifiedConsciousnessState;
+
+/**
+ * @brief Fixed-point helpers for replicating consciousness state.
+ *
+ * A value is clamped to [Min, Max] and sent as an unsigned integer of NumBits bits, so a field costs
+ * exactly its budget on the wire and both ends agree on every step. Non-finite values are sent as Min.
+ */
+namespace HexademicNet
+{
+    FORCEINLINE uint32 Quantize(float Value, float Min, float Max, int32 NumBits)
+    {
+        const uint32 Steps = (1u << NumBits) - 1;
+        const float Alpha = (Value - Min) / (Max - Min);
+        return FMath::IsFinite(Alpha) ? static_cast<uint32>(FMath::RoundToInt(FMath::Clamp(Alpha, 0.0f, 1.0f) * Steps)) : 0u;
+    }
+
+    FORCEINLINE float Dequantize(uint32 Quantized, float Min, float Max, int32 NumBits)
+    {
+        const uint32 Steps = (1u << NumBits) - 1;
+        return Min + (Max - Min) * (static_cast<float>(FMath::Min(Quantized, Steps)) / Steps);
+    }
+
+    /** Writes or reads Value in NumBits bits, depending on the direction of Ar. */
+    FORCEINLINE void SerializeQuantized(FArchive& Ar, float& Value, float Min, float Max, int32 NumBits)
+    {
+        uint32 Quantized = Ar.IsSaving() ? Quantize(Value, Min, Max, NumBits) : 0u;
+        Ar.SerializeBits(&Quantized, NumBits);
+        if (Ar.IsLoading())
+        {
+            Value = Dequantize(Quantized, Min, Max, NumBits);
+        }
+    }
+
+    /**
+     * Bytes per agent per second of consciousness replication, measured by serializing simulated agents
+     * through the same paths the net driver uses. Backs the hexademic.Net.BandwidthTest console command.
+     */
+    struct FBandwidthReport
+    {
+        double ReflectedBytesPerAgentSecond = 0.0; // Every reflected property at full precision
+        double SnapshotBytesPerAgentSecond = 0.0;  // NetSerialize: all fields, quantized
+        double DeltaBytesPerAgentSecond = 0.0;     // NetDeltaSerialize: changed groups only
+        int32 NumMismatches = 0;                   // Round trips that decoded to a different quantized state
+    };
+
+    HEXADEMICPLUGIN_API FBandwidthReport MeasureConsciousnessBandwidth(int32 NumAgents, float Seconds, float UpdateHz);
+
+    /**
+     * Copies into Target only what FUnifiedConsciousnessState replication sends: the quantized scalars and the
+     * text group. Sigil nodes, gems and cognitive threads beyond the replicated few are left alone, so a
+     * replication proxy can be refreshed without copying the whole state.
+     */
+    HEXADEMICPLUGIN_API void CopyReplicatedState(const FUnifiedConsciousnessState& Source, FUnifiedConsciousnessState& Target);
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/Archive.h"
+#include "HexademicCore.h" // For FAetherTouchPacket
+
+/**
+ * Record/replay stream for consciousness sessions.
+ *
+ * Stream layout (little-endian, FArchive):
+ *   Header : uint32 Magic ('HXRC'), uint32 Version
+ *   Events : uint8 Type, uint16 SourceIndex, then a type-specific payload (see FHexademicRecordedEvent)
+ *
+ * A source is the owning actor of whichever component received the input; it is declared once
+ * (DeclareSource) and referenced by index afterwards so per-event overhead stays a few bytes.
+ */
+
+/** The kind of entry in a recorded session stream. */
+enum class EHexademicRecordedEventType : uint8
+{
+    DeclareSource,          // Text = source (actor) name
+    FrameBegin,             // DeltaTime, TimeSeconds, Seed: one consciousness tick and the seed of its random stream
+    EnvironmentalStartle,   // Values[0] = intensity, Vector = location
+    EmotionalStimulus,      // Values[0..2] = valence, arousal, intensity
+    Perception,             // Values[0] = strength, Values[1..3] = valence, arousal, intensity it produced, Vector = location, Text = sense name
+    HapticPacket,           // Full bridge pipeline (body + mind): Values[0..1] = intensity, duration, Vector = location, Text = region
+    HapticFeedback,         // Body-only visual response, same payload as HapticPacket
+    PhenomFile,             // Text = raw .phenom JSON (the listener deletes the file once read)
+    StateDigest             // Values[0..7] = FHexademicStateDigest, written at the end of each frame
+};
+
+/** The handful of values the replayer diffs against after each frame. */
+struct FHexademicStateDigest
+{
+    float Valence = 0.0f;
+    float Arousal = 0.0f;
+    float Intensity = 0.0f;
+    float SystemCoherence = 0.0f;
+    float CognitiveLoad = 0.0f;
+    float CortisolLevel = 0.0f;
+    float DopamineLevel = 0.0f;
+    float CreativeState = 0.0f;
+
+    static constexpr int32 NumValues = 8;
+
+    float* Data() { return &Valence; }
+    const float* Data() const { return &Valence; }
+};
+
+/** One decoded entry of a session stream. Only the fields relevant to Type are serialized. */
+struct FHexademicRecordedEvent
+{
+    EHexademicRecordedEventType Type = EHexademicRecordedEventType::FrameBegin;
+    uint16 SourceIndex = 0;
+
+    float DeltaTime = 0.0f;
+    double TimeSeconds = 0.0;
+    int32 Seed = 0;
+    float Values[FHexademicStateDigest::NumValues] = {};
+    FVector Vector = FVector::ZeroVector;
+    FString Text;
+
+    friend HEXADEMICPLUGIN_API FArchive& operator<<(FArchive& Ar, FHexademicRecordedEvent& Event);
+};
+
+/**
+ * @brief Captures every external input into the consciousness stack, plus the random seed of each tick,
+ * into a compact binary stream that FHexademicSessionReplayer can drive headlessly.
+ * Game thread only. When not recording, every Record call is a single branch.
+ */
+class HEXADEMICPLUGIN_API FHexademicSessionRecorder
+{
+public:
+    static constexpr uint32 StreamMagic = 0x43525848; // 'HXRC'
+    static constexpr uint32 StreamVersion = 2;
+
+    static FHexademicSessionRecorder& Get();
+
+    /** Opens Filename for writing. Relative paths resolve under Saved/Hexademic/Recordings. */
+    bool StartRecording(const FString& Filename);
+    void StopRecording();
+    bool IsRecording() const { return Writer.IsValid() && SuppressDepth == 0; }
+
+    /**
+     * @brief Marks the start of a consciousness tick for Source.
+     * @param Seed Current seed of Source's own random stream; replay restores it so the tick's draws repeat exactly.
+     */
+    void BeginFrame(const UObject* Source, float DeltaTime, double TimeSeconds, int32 Seed);
+
+    void RecordEnvironmentalStartle(const UObject* Source, float Intensity, const FVector& Location);
+    void RecordEmotionalStimulus(const UObject* Source, float Valence, float Arousal, float Intensity);
+    /** A sensed stimulus and the emotional stimulus it produced, which is not recorded separately. */
+    void RecordPerception(const UObject* Source, float Strength, const FVector& Location, FName SenseName, float Valence, float Arousal, float Intensity);
+    void RecordHapticPacket(const UObject* Source, const FAetherTouchPacket& Packet);
+    void RecordHapticFeedback(const UObject* Source, const FAetherTouchPacket& Packet);
+    void RecordPhenomFile(const UObject* Source, const FString& JsonString);
+    void RecordStateDigest(const UObject* Source, const FHexademicStateDigest& Digest);
+
+    /**
+     * Suppresses recording for its lifetime. Used around inputs that fan out into other recorded entry points
+     * (so they are captured once, at the outermost call) and by the replayer while it drives components.
+     */
+    struct FSuppressScope
+    {
+        FSuppressScope() { ++FHexademicSessionRecorder::Get().SuppressDepth; }
+        ~FSuppressScope() { --FHexademicSessionRecorder::Get().SuppressDepth; }
+    };
+
+    /** Resolves a recording name to its on-disk path. */
+    static FString ResolveRecordingPath(const FString& Filename);
+
+private:
+    FHexademicSessionRecorder() = default;
+
+    uint16 ResolveSource(const UObject* Source);
+    void WriteEvent(FHexademicRecordedEvent& Event);
+
+    TUniquePtr<FArchive> Writer;
+    FString RecordingPath;
+    TMap<FString, uint16> SourceIndices;
+    int32 SuppressDepth = 0;
+    int64 EventsWritten = 0;
+};
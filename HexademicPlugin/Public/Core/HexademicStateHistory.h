@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/HexademicHistoryStore.h"
+#include "HexademicCore.h" // For FUnifiedConsciousnessState
+#include "Core/HexademicStateHistory.generated.h"
+
+/** The scalar channels of FUnifiedConsciousnessState kept in an orchestrator's state history. */
+UENUM(BlueprintType)
+enum class EHexademicStateChannel : uint8
+{
+    Valence,
+    Arousal,
+    Intensity,
+    HeartRate,
+    BreathingRate,
+    Cortisol,
+    Dopamine,
+    Serotonin,
+    Adrenaline,
+    Oxytocin,
+    Melatonin,
+    CognitiveLoad,
+    AttentionFocus,
+    CreativeState,
+    SystemCoherence,
+    SelfAwareness,
+    EnvironmentalAwareness,
+    TemporalAwareness,
+    Hunger,
+    Thirst,
+    Fatigue,
+
+    Count UMETA(Hidden)
+};
+
+/** Per-channel summary of a window of state history, for Blueprint. */
+USTRUCT(BlueprintType)
+struct HEXADEMICPLUGIN_API FHexademicChannelStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State History")
+    int32 NumFrames = 0;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State History")
+    float Min = 0.0f;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State History")
+    float Max = 0.0f;
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State History")
+    float Mean = 0.0f;
+};
+
+constexpr int32 HexademicStateChannelCount = static_cast<int32>(EHexademicStateChannel::Count);
+
+/** Consciousness state history: one float per channel per step, delta-quantized between 1 Hz keyframes by default. */
+using FHexademicStateHistory = THexademicHistoryStore<float, HexademicStateChannelCount>;
+
+namespace HexademicStateHistory
+{
+    /** Writes HexademicStateChannelCount values from State, in EHexademicStateChannel order. */
+    HEXADEMICPLUGIN_API void ExtractChannels(const FUnifiedConsciousnessState& State, float* OutValues);
+
+    /** Quantization step per channel: 1/1024 for normalized levels, coarser for rates in BPM. */
+    HEXADEMICPLUGIN_API const float* GetQuantizationSteps();
+
+    /** Sizes History to hold HistorySeconds of steps at UpdateRateHz, with one keyframe per second. */
+    HEXADEMICPLUGIN_API void Configure(FHexademicStateHistory& History, float HistorySeconds, float UpdateRateHz);
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Inverted index from tag tokens to rows, with a prefix trie over the tokens.
+ *
+ * Text is split into tokens when a row is added: runs of letters and digits, broken again where a lower-case
+ * letter is followed by an upper-case one ("Scene_LeftHand" gives scene, left, hand), and compared without
+ * case. Every token is a node of the trie and owns a posting list of its rows, kept sorted, so an exact
+ * lookup is one walk down the trie, a prefix lookup visits only the subtree under the prefix, and AND / OR
+ * over several tags merge the postings without touching rows that match none of them.
+ * Adding rows in ascending order, as the bulk path does, only ever appends to the postings.
+ */
+class HEXADEMICPLUGIN_API FHexademicTagIndex
+{
+public:
+    /** Adds the tokens of Text to Row. Can be called several times for a row, once per tagged field. */
+    void AddRow(int32 Row, FStringView Text);
+
+    /** Drops every token of Row. */
+    void RemoveRow(int32 Row);
+
+    /** Reserves room for rows 0 to NumRows - 1 ahead of a bulk load. */
+    void Reserve(int32 NumRows) { RowTokens.Reserve(NumRows); }
+
+    void Empty();
+
+    /** Rows carrying every token of Tag. */
+    void FindExact(FStringView Tag, TArray<int32>& OutRows) const;
+
+    /** Rows with a token starting with Prefix (a single token; compared without case). */
+    void FindPrefix(FStringView Prefix, TArray<int32>& OutRows) const;
+
+    /** Rows carrying every token of every tag (bMatchAll), or every token of at least one tag. */
+    void FindTags(TConstArrayView<FString> Tags, bool bMatchAll, TArray<int32>& OutRows) const;
+
+    /** Rows with at least one token, all of which appear in Text: token-wise, the rows whose tags Text contains. */
+    void FindContainedIn(FStringView Text, TArray<int32>& OutRows) const;
+
+    /** Calls Visit(FStringView Token) for each token of Text, in order and case as written. */
+    template <typename FuncType>
+    static void ForEachToken(FStringView Text, FuncType&& Visit)
+    {
+        int32 Start = INDEX_NONE;
+        for (int32 i = 0; i <= Text.Len(); i++)
+        {
+            const bool bTokenChar = i < Text.Len() && FChar::IsAlnum(Text[i]);
+            const bool bCaseBreak = bTokenChar && Start != INDEX_NONE && FChar::IsUpper(Text[i]) && FChar::IsLower(Text[i - 1]);
+            if (Start != INDEX_NONE && (!bTokenChar || bCaseBreak))
+            {
+                Visit(Text.Mid(Start, i - Start));
+                Start = INDEX_NONE;
+            }
+            if (bTokenChar && Start == INDEX_NONE)
+            {
+                Start = i;
+            }
+        }
+    }
+
+private:
+    struct FTrieNode
+    {
+        TArray<TPair<TCHAR, int32>, TInlineAllocator<4>> Children; // Lower-case character, node index
+        TArray<int32> Rows; // Sorted; non-empty only on nodes ending a token
+    };
+
+    /** Node reached by Key, or INDEX_NONE. */
+    int32 FindNode(FStringView Key) const;
+    int32 FindOrAddNode(FStringView Key);
+
+    /** Appends the distinct token nodes of Text; false, appending nothing, if any token is not indexed. */
+    bool ResolveTokens(FStringView Text, TArray<int32, TInlineAllocator<8>>& OutNodes) const;
+
+    /** OutRows gets the rows in every listed posting. */
+    void Intersect(TConstArrayView<int32> NodeIndices, TArray<int32>& OutRows) const;
+
+    /** OutRows gets the rows in any listed posting, sorted and distinct. */
+    void Union(TConstArrayView<int32> NodeIndices, TArray<int32>& OutRows) const;
+
+    TArray<FTrieNode> Nodes = { FTrieNode() }; // Node 0 is the root
+    TArray<TArray<int32, TInlineAllocator<4>>> RowTokens; // Token nodes by row, to remove a row's postings
+};
@@ -0,0 +1,196 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Misc/DateTime.h"
+
+/**
+ * Typed tuning tables compiled from DefaultConsciousness.ini.
+ *
+ * Each ini section maps to one flat struct. The service parses the file into a complete, immutable
+ * FHexademicTuningTable and publishes it by swapping a single shared reference, so a reader always
+ * sees one consistent version. Components cache the values they use when OnTuningChanged fires
+ * instead of reading parameters individually.
+ */
+
+/** [ConsciousnessSettings] */
+struct FHexademicConsciousnessTuning
+{
+    FName DefaultConsciousnessLOD = TEXT("Reduced");
+    int32 MaxConsciousEntities = 100;
+    float EmotionalDecayRate = 0.1f;
+    int32 MemoryThreadLimit = 1000;
+};
+
+/** [EmotionalSettings] */
+struct FHexademicEmotionalTuning
+{
+    float EmotionalContagionRadius = 500.0f;
+    float EmotionalIntensityMultiplier = 1.0f;
+    float CrossConsciousnessBleedthrough = 0.3f;
+    float EcosystemUpdateFrequency = 5.0f;
+    float ValenceResonanceFactor = 0.5f;
+    float ArousalResonanceFactor = 0.3f;
+    float IntensityResonanceFactor = 0.2f;
+};
+
+/** [BodySettings] */
+struct FHexademicBodyTuning
+{
+    float HormoneDecayRate = 0.05f;
+    float StartleThreshold = 0.5f;
+    float ReflexEmotionalImpactScale = 0.2f;
+};
+
+/** [PersonalitySettings] */
+struct FHexademicPersonalityTuning
+{
+    float TraitDecayRate = 0.01f;
+};
+
+/** [FractalSettings] */
+struct FHexademicFractalTuning
+{
+    float FrameBudgetMs = 2.0f;          // Hard ceiling on fractal processing per frame, summed over all agents
+    float TargetUtilization = 0.85f;     // Share of the budget the governor steers measured cost towards
+    float ImportanceCutoffGain = 0.5f;   // How fast the importance cutoff reacts to over- or under-spending
+};
+
+/** One published version of every tuning section. Never mutated after publication. */
+struct FHexademicTuningTable
+{
+    uint32 Version = 0;
+    FDateTime PublishedAt;
+
+    FHexademicConsciousnessTuning Consciousness;
+    FHexademicEmotionalTuning Emotional;
+    FHexademicBodyTuning Body;
+    FHexademicPersonalityTuning Personality;
+    FHexademicFractalTuning Fractal;
+};
+
+using FHexademicTuningTableRef = TSharedRef<const FHexademicTuningTable, ESPMode::ThreadSafe>;
+
+/** A single parameter change, from the file or from a live override. */
+struct FHexademicTuningAuditEntry
+{
+    FDateTime Timestamp;
+    uint32 Version = 0;
+    FString Parameter;   // "Section.Key"
+    FString OldValue;
+    FString NewValue;
+    FString Origin;      // "File", "Override: <reason>", "Override cleared"
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnHexademicTuningChanged, const FHexademicTuningTable& /*NewTable*/);
+
+/**
+ * @brief Loads DefaultConsciousness.ini into FHexademicTuningTable, watches it for changes and applies live overrides.
+ * Publication happens on the game thread; GetTable() may be called from any thread. If the service is first
+ * reached off the game thread, it serves the built-in defaults until the game thread has read the file.
+ */
+class HEXADEMICPLUGIN_API FHexademicTuningService
+{
+public:
+    static FHexademicTuningService& Get();
+
+    /** The current table. Hold the reference for as long as the values must stay consistent. */
+    FHexademicTuningTableRef GetTable() const;
+
+    /** Re-reads the ini and publishes a new version if anything (file or override) changed. */
+    bool Reload();
+
+    /**
+     * @brief Pins a parameter to a value until cleared, regardless of the file. Recorded in the audit log.
+     * @param Parameter "Section.Key", e.g. "EmotionalSettings.EmotionalContagionRadius".
+     */
+    bool SetOverride(const FString& Parameter, const FString& Value, const FString& Reason);
+    void ClearOverrides();
+
+    TArray<FHexademicTuningAuditEntry> GetAuditLog() const;
+    void DumpToLog() const;
+
+    /** Absolute path of the watched ini. */
+    const FString& GetSourcePath() const { return SourcePath; }
+
+    /** Broadcast on the game thread after each publication. */
+    FOnHexademicTuningChanged OnTuningChanged;
+
+private:
+    FHexademicTuningService();
+    ~FHexademicTuningService();
+
+    enum class EParameterType : uint8 { Float, Int, Name };
+
+    struct FParameterDesc
+    {
+        const TCHAR* Section;
+        const TCHAR* Key;
+        EParameterType Type;
+        SIZE_T Offset; // Into FHexademicTuningTable
+    };
+
+    static const TArray<FParameterDesc>& GetParameters();
+    static FString ReadValue(const FHexademicTuningTable& Table, const FParameterDesc& Desc);
+    static bool WriteValue(FHexademicTuningTable& Table, const FParameterDesc& Desc, const FString& Value);
+    static const FParameterDesc* FindParameter(const FString& Parameter);
+
+    bool PollSourceFile(float DeltaTime);
+    void Publish(FHexademicTuningTable&& NewTable, TArray<FHexademicTuningAuditEntry>&& Changes);
+
+    FString SourcePath;
+    FDateTime SourceTimestamp;
+    TMap<FString, FString> Overrides; // "Section.Key" -> value
+    TMap<FString, FString> OverrideReasons;
+
+    FHexademicTuningTableRef CurrentTable;
+    TArray<FHexademicTuningAuditEntry> AuditLog;
+    mutable FRWLock TableLock;
+
+    FTSTicker::FDelegateHandle PollHandle;
+
+    static constexpr float PollIntervalSeconds = 1.0f;
+    static constexpr int32 MaxAuditEntries = 1024;
+};
+
+/**
+ * @brief Keeps a component's tuned properties in step with the published tuning table.
+ *
+ * Bind applies the current table and re-applies each new version until Unbind. Inside the apply callback,
+ * Apply() writes a tuned value only to a property that started play at its native class default, so a value
+ * set on an instance or in a Blueprint subclass keeps overriding the table.
+ */
+class HEXADEMICPLUGIN_API FHexademicTuningBinding
+{
+public:
+    using FApplyFunction = TFunction<void(const FHexademicTuningTable& /*Table*/, FHexademicTuningBinding& /*Binding*/)>;
+
+    FHexademicTuningBinding() = default;
+    FHexademicTuningBinding(const FHexademicTuningBinding&) = delete;
+    FHexademicTuningBinding& operator=(const FHexademicTuningBinding&) = delete;
+    ~FHexademicTuningBinding() { Unbind(); }
+
+    void Bind(UObject* InOwner, FApplyFunction&& InApply);
+    void Unbind();
+
+    /** Sets Value, a property of the bound owner, to TunedValue unless the owner overrides its default. */
+    template<typename T>
+    void Apply(T& Value, const T& TunedValue)
+    {
+        const SIZE_T Offset = reinterpret_cast<const uint8*>(&Value) - reinterpret_cast<const uint8*>(Owner);
+        if (!IsOverridden(Offset, [&Value, Offset, this]() { return Value != *reinterpret_cast<const T*>(reinterpret_cast<const uint8*>(NativeDefaults) + Offset); }))
+        {
+            Value = TunedValue;
+        }
+    }
+
+private:
+    /** Whether the property at Offset differed from its native default when first applied; remembered per binding. */
+    bool IsOverridden(SIZE_T Offset, TFunctionRef<bool()> DiffersFromDefault);
+
+    const UObject* Owner = nullptr; // Callbacks stop with the owner, through AddWeakLambda
+    const UObject* NativeDefaults = nullptr;
+    FApplyFunction ApplyFunction;
+    FDelegateHandle Handle;
+    TMap<SIZE_T, bool> OverriddenByOffset;
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief A fixed set of exponentially decayed sums, one per channel, each updated in O(1) per event.
+ *
+ * A channel stores its sum as of its last event together with that event's time, and decay is applied
+ * lazily when the channel is next written or read, so idle channels cost nothing. Each channel also keeps
+ * a decayed event count, which gives the decayed mean of the event values alongside the sum.
+ */
+class HEXADEMICPLUGIN_API FHexademicDecayedAccumulators
+{
+public:
+    /**
+     * @brief Sets up one empty channel per half-life.
+     * @param HalfLivesSeconds Seconds for a channel's sum to halve; <= 0 keeps only the events of the latest instant.
+     */
+    void Configure(TConstArrayView<float> HalfLivesSeconds);
+
+    /** Empties every channel, keeping the half-lives. */
+    void Reset();
+
+    void Add(int32 Channel, float Value, double NowSeconds);
+
+    float GetSum(int32 Channel, double NowSeconds) const;
+    float GetMean(int32 Channel, double NowSeconds) const;
+    float GetLastValue(int32 Channel) const { return Channels.IsValidIndex(Channel) ? Channels[Channel].LastValue : 0.0f; }
+    double GetLastEventTime(int32 Channel) const { return Channels.IsValidIndex(Channel) ? Channels[Channel].LastTime : 0.0; }
+
+    /** The channel with the largest decayed sum, or INDEX_NONE while every channel is empty. */
+    int32 GetDominantChannel(double NowSeconds) const;
+
+    int32 Num() const { return Channels.Num(); }
+
+private:
+    struct FChannel
+    {
+        double DecayRate = 0.0;  // ln(2) / half-life; 0 for latest-instant-only channels
+        float Sum = 0.0f;
+        float Count = 0.0f;
+        float LastValue = 0.0f;
+        double LastTime = 0.0;
+    };
+
+    static float DecayFactor(const FChannel& Channel, double NowSeconds);
+
+    TArray<FChannel, TInlineAllocator<8>> Channels;
+};
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Decides which temporal fractal layers are due on a given update.
+ *
+ * Every layer has its own period, and a phase offset within it derived from a per-agent seed, so the
+ * slow layers of many agents spread their work over frames instead of landing on the same one. The
+ * earliest due time across all layers is cached, so an update on which nothing is due costs one
+ * comparison and the cost of an update is proportional to the layers that run.
+ */
+class HEXADEMICPLUGIN_API FHexademicTemporalLayerScheduler
+{
+public:
+    struct FDueLayer
+    {
+        int32 LayerIndex = INDEX_NONE;
+        float ElapsedSeconds = 0.0f; // Time since this layer last ran, i.e. its integration step
+    };
+    using FDueLayers = TArray<FDueLayer, TInlineAllocator<8>>;
+
+    /**
+     * @brief Sets up one slot per layer. Every layer runs on the first collect after this.
+     * @param UpdateFrequencies Hz per layer; <= 0 runs the layer on every update.
+     * @param StaggerSeed Per-agent seed for the phase offsets of slow layers.
+     * @param NowSeconds The caller's clock.
+     */
+    void Configure(TConstArrayView<float> UpdateFrequencies, uint32 StaggerSeed, double NowSeconds);
+
+    void Reset();
+
+    /**
+     * @brief Appends the layers due at NowSeconds to OutDue, in layer order. Nothing is scheduled until each
+     * collected layer is passed to CommitLayer, so a layer the caller drops is not silently marked as run.
+     * @return True if any layer is due.
+     */
+    bool CollectDueLayers(double NowSeconds, FDueLayers& OutDue) const;
+
+    /**
+     * @brief Schedules a collected layer's next run.
+     * @param bRan False if the caller skipped the layer: it waits for its next slot, and the run after that
+     * integrates over the whole time since it last actually ran.
+     */
+    void CommitLayer(int32 LayerIndex, double NowSeconds, bool bRan);
+
+    int32 Num() const { return Slots.Num(); }
+    double GetNextDueTime() const { return EarliestDueTime; }
+    float GetPeriod(int32 LayerIndex) const { return Slots.IsValidIndex(LayerIndex) ? static_cast<float>(Slots[LayerIndex].Period) : 0.0f; }
+
+private:
+    struct FLayerSlot
+    {
+        double Period = 0.0;
+        double Phase = 0.0;
+        double NextDueTime = 0.0;
+        double LastRunTime = 0.0;
+        bool bHasRun = false;
+    };
+
+    TArray<FLayerSlot, TInlineAllocator<8>> Slots;
+    double EarliestDueTime = TNumericLimits<double>::Max();
+};
@@ -0,0 +1,172 @@
+// MythkeeperCodex6Component.h - Resonance and mythic pattern services for the Hexademic⁶ lattice
+// Keeps what fractal consciousness needs to know about resonance and myth as running summaries,
+// so every query and every event costs the same however long the agent has been alive.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Fractal/UFractalConsciousnessManagerComponent.h" // For the service interfaces and 6D lattice types
+#include "Fractal/HexademicDecayedAccumulators.h"
+#include "MythkeeperCodex6Component.generated.h"
+
+// FMythicPatternDefinition: An ordered run of archetype activations that together tell a story.
+// Archetype IDs follow EEmotionalArchetype, counting from 0x1 (Joy) to 0x7 (Curiosity).
+USTRUCT(BlueprintType)
+struct HEXADEMICPLUGIN_API FMythicPatternDefinition
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mythic Pattern")
+    FName PatternName;
+
+    // Archetypes in the order they must activate; other activations in between are skipped over
+    UPROPERTY(EditAnywhere, Category = "Mythic Pattern")
+    TArray<uint32> ArchetypeSequence;
+
+    // The whole sequence must complete within this long of its first activation
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mythic Pattern", meta = (ClampMin = "0.1"))
+    float MaxSpanSeconds = 120.0f;
+
+    // Narrative composed on completion; {Order} and {Occurrences} are filled in
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mythic Pattern")
+    FString NarrativeTemplate;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMythicEmergence, const FString&, NarrativeThread);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnArchetypeActivation, uint32, ArchetypeID, float, ActivationLevel);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTranscendentExperience, const FHexademic6DCoordinate&, TranscendencePoint);
+
+/**
+ * @brief Concrete IHexademic6ResonanceService and IHexademic6MythicService.
+ *
+ * Resonance is held as one exponentially decayed sum per lattice order, updated in O(1) per resonance
+ * event; slower orders have longer half-lives. Archetype activations decay the same way, per archetype.
+ *
+ * Mythic patterns are found by a streaming matcher over the sequence of archetype activations: each
+ * activation advances the partial matches waiting for it and may start new ones, and matches older than
+ * their pattern's span are dropped. The work per event is bounded by MaxPartialMatches, never by history.
+ * A completed pattern is summarized once, narrative included, and narrative queries read those summaries.
+ */
+UCLASS(ClassGroup=(HexademicFractal), meta=(BlueprintSpawnableComponent))
+class HEXADEMICPLUGIN_API UMythkeeperCodex6Component : public UActorComponent, public IHexademic6ResonanceService, public IHexademic6MythicService
+{
+    GENERATED_BODY()
+
+public:
+    UMythkeeperCodex6Component();
+
+protected:
+    virtual void BeginPlay() override;
+
+public:
+    // === RESONANCE CONFIGURATION ===
+    // Half-life of accumulated resonance per ECognitiveLatticeOrder, in seconds
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mythkeeper|Resonance")
+    TArray<float> OrderHalfLivesSeconds;
+
+    // Lattice distance over which the resonance between two coordinates halves
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mythkeeper|Resonance", meta = (ClampMin = "1.0"))
+    float ResonanceDistanceScale = 8192.0f;
+
+    // Accumulated Order Infinite resonance at which a transcendent experience is announced
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mythkeeper|Resonance", meta = (ClampMin = "0.0"))
+    float TranscendenceThreshold = 3.0f;
+
+    // === ARCHETYPE CONFIGURATION ===
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mythkeeper|Archetypes", meta = (ClampMin = "0.1"))
+    float ArchetypeHalfLifeSeconds = 10.0f;
+
+    // Decayed activation, scaled by coherence, above which an archetype counts as active
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mythkeeper|Archetypes", meta = (ClampMin = "0.0"))
+    float ActiveArchetypeThreshold = 0.3f;
+
+    // === PATTERN MATCHING ===
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mythkeeper|Patterns")
+    TArray<FMythicPatternDefinition> PatternDefinitions;
+
+    // Upper bound on partial matches in flight, and so on the matching work per activation
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mythkeeper|Patterns", meta = (ClampMin = "1"))
+    int32 MaxPartialMatches = 64;
+
+    // Completed patterns kept for GetEmergentNarrativeThreads; the oldest are dropped beyond this
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mythkeeper|Patterns", meta = (ClampMin = "1"))
+    int32 MaxPendingSummaries = 32;
+
+    // === EVENTS ===
+    UPROPERTY(BlueprintAssignable, Category = "Mythkeeper|Events")
+    FOnMythicEmergence OnMythicEmergence;
+
+    UPROPERTY()
+    FOnArchetypeActivation OnArchetypeActivation;
+
+    UPROPERTY(BlueprintAssignable, Category = "Mythkeeper|Events")
+    FOnTranscendentExperience OnTranscendentExperience;
+
+    // === IHexademic6ResonanceService ===
+    virtual float CalculateResonanceStrength_Implementation(const FHexademic6DCoordinate& A, const FHexademic6DCoordinate& B) const override;
+    virtual void TriggerResonancePattern_Implementation(const FHexademic6DCoordinate& Center, ECognitiveLatticeOrder Order, float Intensity) override;
+    virtual ECognitiveLatticeOrder IdentifyDominantOrder_Implementation(const TArray<FHexademic6DCoordinate>& Coordinates) const override;
+
+    // === IHexademic6MythicService ===
+    virtual void ProcessEmergentMythicPattern_Implementation(const TArray<FHexademicMemoryNode>& AssociatedMemories, float Coherence) override;
+    virtual FString GenerateNarrativeThread_Implementation(const TArray<FHexademicMemoryNode>& CoreMemories, ECognitiveLatticeOrder Order) const override;
+    virtual void ActivateArchetype_Implementation(uint32 ArchetypeID, float ActivationLevel) override;
+
+    // === QUERIES FOR FRACTAL CONSCIOUSNESS ===
+    /** Records a resonance and archetype activation at Coordinate, the archetype read from its emotional axes. */
+    void ActivateMythicPattern(const FHexademic6DCoordinate& Coordinate, float Intensity);
+
+    /** Archetypes whose decayed activation, scaled by Coherence, is above ActiveArchetypeThreshold. */
+    TArray<uint32> GetActiveArchetypalPatterns(const FHexademic6DCoordinate& Coordinate, float Coherence) const;
+
+    /** Narratives of the patterns completed since the last call whose strength reaches Threshold. */
+    TArray<FString> GetEmergentNarrativeThreads(float Threshold);
+
+    UFUNCTION(BlueprintPure, Category = "Mythkeeper|Resonance")
+    float GetOrderResonance(ECognitiveLatticeOrder Order) const;
+
+    UFUNCTION(BlueprintPure, Category = "Mythkeeper|Resonance")
+    ECognitiveLatticeOrder GetDominantOrder() const;
+
+    UFUNCTION(BlueprintPure, Category = "Mythkeeper|Patterns")
+    int32 GetPartialMatchCount() const { return PartialMatches.Num(); }
+
+    /** The latest completion of each pattern definition, by definition index; Occurrences is 0 for patterns not yet seen. */
+    const TArray<FHexademicMythicPatternSummary>& GetPatternSummaries() const { return PatternSummaries; }
+
+    /** The archetype ID (0x1 Joy ... 0x7 Curiosity) FHexademicArchetypeClassifier assigns to an emotional state. */
+    static uint32 ClassifyArchetype(float Valence, float Arousal, float Intensity);
+
+private:
+    struct FArchetypeTrace
+    {
+        float Activation = 0.0f;
+        double LastTime = 0.0;
+    };
+
+    struct FPartialMatch
+    {
+        int32 PatternIndex = INDEX_NONE;
+        int32 NextStep = 0;
+        double StartTime = 0.0;
+        float ActivationSum = 0.0f;
+    };
+
+    double GetNowSeconds() const;
+    void RebuildPatternIndex();
+    void RecordArchetypeActivation(uint32 ArchetypeID, float Activation, double NowSeconds);
+    void AdvancePatternMatches(uint32 ArchetypeID, float Activation, double NowSeconds);
+    void CompletePattern(const FPartialMatch& Match, double NowSeconds);
+    float GetArchetypeActivation(uint32 ArchetypeID, double NowSeconds) const;
+
+    FHexademicDecayedAccumulators OrderResonance; // One channel per ECognitiveLatticeOrder
+    TMap<uint32, FArchetypeTrace> ArchetypeTraces;
+    TMultiMap<uint32, int32> PatternsByFirstArchetype; // Which definitions a given activation can start
+    TArray<FPartialMatch> PartialMatches;
+    TArray<FHexademicMythicPatternSummary> PatternSummaries;
+    TArray<FHexademicMythicPatternSummary> PendingSummaries; // Completed since the last GetEmergentNarrativeThreads
+    uint32 LastMatchedArchetype = 0; // A run of one archetype is one symbol to the matcher
+    float CurrentCoherence = 1.0f;
+    bool bTranscendent = false;
+};
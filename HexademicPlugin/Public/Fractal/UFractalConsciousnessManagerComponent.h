@@ -6,6 +6,8 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "HexademicCore.h" // Includes FEmotionalState, FUnifiedConsciousnessState, etc.
+#include "Core/HexademicHistoryStore.h" // For the consciousness trajectory
+#include "Fractal/HexademicTemporalLayerScheduler.h"
 #include "UObject/NoExportTypes.h" // For FGuid, FDateTime
 
 //=============================================================================
@@ -183,6 +185,113 @@ public:
     virtual void ActivateArchetype_Implementation(uint32 ArchetypeID, float ActivationLevel) = 0;
 };
 
+// FHexademicMythicPatternSummary: One completed mythic pattern, summarized when it completes so that
+// narrative generation reads the summary instead of replaying the events behind it.
+USTRUCT(BlueprintType)
+struct HEXADEMICPLUGIN_API FHexademicMythicPatternSummary
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Hexademic⁶ Mythic")
+    FName PatternName;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Hexademic⁶ Mythic")
+    ECognitiveLatticeOrder DominantOrder = ECognitiveLatticeOrder::Order12; // Most resonant order when the pattern completed
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Hexademic⁶ Mythic")
+    float Strength = 0.0f; // Mean activation of the matched events, weighted by coherence
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Hexademic⁶ Mythic")
+    float SpanSeconds = 0.0f; // From the first matched event to the last
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Hexademic⁶ Mythic")
+    int32 Occurrences = 0; // Completions of this pattern so far, this one included
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Hexademic⁶ Mythic")
+    double CompletedAtSeconds = 0.0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Hexademic⁶ Mythic")
+    FString Narrative; // Composed once, at completion
+};
+
+
+// FHexademicLatticeNodeHandle: Compact reference to a slot in an FHexademicLatticeNodePool.
+// The generation makes handles to recycled slots detectably stale.
+struct FHexademicLatticeNodeHandle
+{
+    int32 Index = INDEX_NONE;
+    uint32 Generation = 0;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+    void Reset() { Index = INDEX_NONE; Generation = 0; }
+    bool operator==(const FHexademicLatticeNodeHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+    friend uint32 GetTypeHash(const FHexademicLatticeNodeHandle& Handle) { return HashCombine(GetTypeHash(Handle.Index), GetTypeHash(Handle.Generation)); }
+};
+
+// FHexademicLatticeNodePool: Fixed-capacity store for the memory nodes fractal layers write into the lattice.
+// Successive near-identical states are folded into the node already written (merge-on-write) instead of minting
+// a new one. When the pool is full, the least recently written slot is recycled. A slot's NodeID is fixed for the
+// pool's lifetime, so recycling it updates the same lattice node rather than adding one.
+class HEXADEMICPLUGIN_API FHexademicLatticeNodePool
+{
+public:
+    // How close a new state has to be to the node it would replace to be merged into it
+    struct FMergeTolerance
+    {
+        uint64 MaxCoordinateDelta = 256; // Per axis, out of the 16-bit range
+        float MaxEmotionDelta = 0.02f;   // Valence, arousal and intensity
+        float MaxCoherenceDelta = 0.02f;
+    };
+
+    void SetCapacity(int32 InCapacity);
+    int32 GetCapacity() const { return Capacity; }
+
+    /**
+     * @brief Writes Candidate, merging it into Previous when the two are within tolerance.
+     * @param Previous The node this writer last wrote, if any.
+     * @param bOutMerged True if Candidate was folded into Previous. Its values changed all the same, so the
+     *                   lattice copy still needs updating; only no new node was spent.
+     * @return The written node. Its NodeID is assigned by the pool.
+     */
+    FHexademicLatticeNodeHandle Write(FHexademicLatticeNodeHandle Previous, const FHexademicMemoryNode& Candidate, bool& bOutMerged);
+
+    /** The node behind Handle, or null if the slot has been recycled or released since. */
+    const FHexademicMemoryNode* Get(FHexademicLatticeNodeHandle Handle) const;
+    void Release(FHexademicLatticeNodeHandle Handle);
+    void Reset();
+
+    int32 Num() const { return NumLive; }
+    float GetOccupancy() const { return Capacity > 0 ? static_cast<float>(NumLive) / Capacity : 0.0f; }
+    /** Fraction of all writes since the last Reset that were merged into an existing node. */
+    float GetMergeRate() const { return NumWrites > 0 ? static_cast<float>(static_cast<double>(NumMerges) / NumWrites) : 0.0f; }
+    int64 GetNumWrites() const { return NumWrites; }
+    int64 GetNumMerges() const { return NumMerges; }
+
+    FMergeTolerance MergeTolerance;
+
+private:
+    struct FSlot
+    {
+        FHexademicMemoryNode Node;
+        uint32 Generation = 0;
+        uint32 MergeCount = 0;
+        uint64 LastWriteSerial = 0;
+        bool bLive = false;
+    };
+
+    bool IsWithinTolerance(const FHexademicMemoryNode& Existing, const FHexademicMemoryNode& Candidate) const;
+    int32 AllocateSlot();
+
+    TArray<FSlot> Slots;
+    TArray<int32> FreeSlots;
+    FGuid PoolGuid; // NodeIDs are PoolGuid with the slot index folded into D
+    int32 Capacity = 64;
+    int32 NumLive = 0;
+    uint64 WriteSerial = 0;
+    int64 NumWrites = 0;
+    int64 NumMerges = 0;
+};
+
 
 // FFractalEmpathicField: Represents an empathic field within the fractal structure
 USTRUCT(BlueprintType)
@@ -274,6 +383,12 @@ struct HEXADEMICPLUGIN_API FFractalProcessingManager
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Processing Manager")
     float CurrentProcessingLoad = 0.0f; // Current load as a percentage of budget
 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Processing Manager")
+    float AgentImportance = 1.0f; // This agent's claim on the world's fractal frame budget relative to others (hero > crowd)
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Processing Manager")
+    TMap<int32, float> ScaleImportanceWeights; // Per temporal scale; scales below 0.1 are not processed
+
     void AdjustProcessingLoad(float DeltaTime, const FUnifiedConsciousnessState& State, IHexademic6CognitiveLatticeService* LatticeService);
     bool CanProcess(float Cost) const { return !bAdaptiveScaling || (AvailableComputeBudget - CurrentProcessingLoad >= Cost); }
 };
@@ -297,6 +412,7 @@ class UReflexResponseComponent;
 // NEW: Hexademic⁶ specific components
 class UHexademic6ComputeComponent; // Assumed component that implements IHexademic6CognitiveLatticeService
 class UMythkeeperCodex6Component;   // Assumed component that implements IHexademic6MythicService & IHexademic6ResonanceService
+class UFractalComputeGovernorSubsystem;
 
 
 //=============================================================================
@@ -329,15 +445,20 @@ struct HEXADEMICPLUGIN_API FTemporalFractalLayer
     FHexademic6DCoordinate LayerCenterCoordinate;
 
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Hexademic⁶ Lattice")
-    TArray<FGuid> ActiveMemoryNodes; // Memory nodes active at this temporal scale
+    TSet<FGuid> ActiveMemoryNodes; // Memory nodes active at this temporal scale, since the set last rolled over
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hexademic⁶ Lattice", meta = (ClampMin = "1"))
+    int32 MaxActiveMemoryNodes = 256; // ActiveMemoryNodes starts over once it reaches this size
 
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Hexademic⁶ Lattice")
     float LatticeResonanceStrength = 0.0f; // Resonance with the 6D lattice at this scale
 
+    FHexademicLatticeNodeHandle LatticeStateNode; // The pooled node this layer last wrote its state to
+
     // Lattice interaction methods (implemented in .cpp of FractalConsciousnessManagerComponent usually)
     // Defined as BlueprintCallable in manager, or as part of manager's update loop if private
     // void UpdateLatticeMapping(const FUnifiedConsciousnessState& State);
-    // void PropagateToLattice(IHexademic6CognitiveLatticeService& LatticeService);
+    // void PropagateToLattice(IHexademic6CognitiveLatticeService& LatticeService, FHexademicLatticeNodePool& NodePool);
     // void IntegrateFromLattice(const TArray<FHexademicMemoryNode>& RelevantMemories);
 };
 
@@ -377,6 +498,46 @@ struct HEXADEMICPLUGIN_API FRecursiveEmbodimentZone
     // void TriggerMythicActivation(IHexademic6MythicService& MythicService, float Intensity);
 };
 
+// FFlatEmbodimentZoneTree: An FRecursiveEmbodimentZone hierarchy baked breadth-first into flat per-field arrays.
+// Parents come before their children and siblings are contiguous, so a forward pass is a top-down sweep and a
+// reverse pass a bottom-up one, with no recursion or per-level allocations. Built from the authored tree and
+// rebuilt only when that changes; the runtime results live here, not in the authored zones.
+struct HEXADEMICPLUGIN_API FFlatEmbodimentZoneTree
+{
+    void Build(const FRecursiveEmbodimentZone& Root, int32 InMaxDepth);
+    void Reset();
+
+    /** Hash of the authored tree down to MaxDepth: its shape and the fields the flat tree copies. */
+    static uint32 ComputeSourceHash(const FRecursiveEmbodimentZone& Root, int32 MaxDepth);
+
+    int32 Num() const { return Parent.Num(); }
+    int32 NumLevels() const { return FMath::Max(LevelStart.Num() - 1, 0); }
+    int32 FindZone(const FString& Name) const;
+    TConstArrayView<uint32> GetResonantArchetypes(int32 ZoneIndex) const { return TConstArrayView<uint32>(Archetypes.GetData() + ArchetypeStart[ZoneIndex], ArchetypeCount[ZoneIndex]); }
+
+    // === TOPOLOGY ===
+    TArray<int32> Parent;        // INDEX_NONE for the root
+    TArray<int32> FirstChild;
+    TArray<int32> NumChildren;
+    TArray<int32> LevelStart;    // Zones at depth D are [LevelStart[D], LevelStart[D + 1])
+
+    // === AUTHORED FIELDS ===
+    TArray<FString> ZoneName;
+    TArray<FHexademic6DCoordinate> LatticePosition;
+    TArray<float> SensitivityAmplification;
+
+    // === RUNTIME FIELDS ===
+    TArray<float> EffectiveSensitivity; // Product of SensitivityAmplification from the root down (top-down sweep)
+    TArray<float> MythicDepth;
+    TArray<float> SubtreeMythicDepth;   // Deepest MythicDepth in the zone's subtree (bottom-up sweep)
+    TArray<int32> ArchetypeStart;       // Each zone's ResonantArchetypes are Archetypes[ArchetypeStart, ArchetypeStart + ArchetypeCount)
+    TArray<int32> ArchetypeCount;
+    TArray<uint32> Archetypes;
+
+    int32 MaxDepth = INDEX_NONE;
+    uint32 SourceHash = 0;
+};
+
 // Memory Constellation Fractals Enhanced with 6D Lattice Navigation
 USTRUCT(BlueprintType)
 struct HEXADEMICPLUGIN_API FFractalMemoryConstellation
@@ -438,6 +599,9 @@ protected:
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
+    /** Resource allocation, lattice sync and mythic emergence. TickComponent calls this; headless session replay calls it directly. */
+    void AdvanceFractalTime(float DeltaTime);
+
     // === CORE COMPONENT REFERENCES ===
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Core References")
     TObjectPtr<UEmotionCognitionComponent> EmotionMind;
@@ -522,6 +686,14 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fractal Config")
     int32 MaxTemporalScales = 5;
 
+    // A layer runs at most this many times per unit of its TimeScale (and never faster than its UpdateFrequency)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fractal Config", meta = (ClampMin = "0.1"))
+    float LayerUpdatesPerTimeScale = 10.0f;
+
+    // Lattice memory nodes the temporal layers can hold at once; the least recently written is recycled beyond this
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fractal Config", meta = (ClampMin = "1"))
+    int32 LatticeNodePoolCapacity = 64;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fractal Config")
     int32 MaxSpatialRecursionDepth = 3;
 
@@ -579,6 +751,32 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Hexademic⁶ Integration")
     void TriggerFractalTranscendence(const FHexademic6DCoordinate& TriggerPoint);
 
+    /**
+     * @brief The path through 6D lattice space over the most recent WindowSeconds, oldest first.
+     * @param MaxPoints If > 0, the path is averaged down to at most this many points.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Hexademic⁶ Integration")
+    TArray<FHexademic6DCoordinate> GetConsciousnessTrajectory(float WindowSeconds, int32 MaxPoints = 0) const;
+
+    /** @brief Fraction of the lattice node pool in use. */
+    UFUNCTION(BlueprintPure, Category = "Hexademic⁶ Integration")
+    float GetLatticeNodePoolOccupancy() const { return LatticeNodePool.GetOccupancy(); }
+
+    /** @brief Fraction of layer state writes folded into an existing lattice node rather than creating one. */
+    UFUNCTION(BlueprintPure, Category = "Hexademic⁶ Integration")
+    float GetLatticeNodeMergeRate() const { return LatticeNodePool.GetMergeRate(); }
+
+    /** @brief Rebuilds the flattened embodiment zone tree on the next update. Call after editing RootEmbodimentZone at runtime. */
+    UFUNCTION(BlueprintCallable, Category = "Spatial Fractal")
+    void NotifyEmbodimentZonesChanged() { bEmbodimentZonesDirty = true; }
+
+    /**
+     * @brief Mythic depth of the named embodiment zone from the last update.
+     * @param bIncludeSubZones If true, the deepest value anywhere in the zone's subtree.
+     */
+    UFUNCTION(BlueprintPure, Category = "Spatial Fractal")
+    float GetEmbodimentZoneMythicDepth(const FString& ZoneName, bool bIncludeSubZones = false) const;
+
 private:
     // === INTERNAL FRACTAL & LATTICE INTEGRATION FUNCTIONS ===
     void InitializeFractalLayers(); // Helper to set up initial fractal layers
@@ -590,8 +788,15 @@ private:
     void EvolveConsciousnessInLatticeSpace(float DeltaTime);
 
     // Enhanced fractal processing with lattice awareness
-    void UpdateFractalTemporalLayerWithLattice(int32 ScaleLevel, float DeltaTime, FUnifiedConsciousnessState& CurrentUnifiedState);
-    void UpdateFractalSpatialZoneWithLattice(FRecursiveEmbodimentZone& Zone, int32 CurrentDepth, float DeltaTime); // Pass by ref
+    void AllocateProcessingResources(float DeltaTime);
+    void UpdateDueTemporalLayers(FUnifiedConsciousnessState& CurrentUnifiedState);
+    void ConfigureTemporalLayerScheduler();
+    // Lattice reads and writes for one layer; game thread only, since every layer shares the lattice
+    void ExchangeTemporalLayerWithLattice(int32 ScaleLevel, const FUnifiedConsciousnessState& CurrentUnifiedState);
+    // Folds the layer's cached lattice query back into it; reads nothing but that cache
+    void IntegrateTemporalLayer(int32 ScaleLevel);
+    void UpdateEmbodimentZonesWithLattice(float DeltaTime, bool bQueryLattice);
+    void RebuildEmbodimentZonesIfChanged(float DeltaTime);
     void UpdateFractalMemoryConstellationWithLattice(FFractalMemoryConstellation& Constellation, float DeltaTime, FUnifiedConsciousnessState& CurrentUnifiedState); // Pass by ref
 
     // 6D lattice navigation and optimization
@@ -616,9 +821,29 @@ private:
     float AccumulatedLatticeTime = 0.0f;
     int32 LatticeUpdateCounter = 0;
 
+    // Multi-rate temporal layer updates
+    FHexademicTemporalLayerScheduler TemporalLayerScheduler;
+    FHexademicTemporalLayerScheduler::FDueLayers DueTemporalLayers;
+    static constexpr float DegradedSlowLayerPeriod = 1.0f; // Over budget, due layers this slow or slower are skipped
+    TArray<TArray<FHexademicMemoryNode>> LayerLatticeMemoryCache; // Per layer, the memories from its last lattice query
+    FHexademicLatticeNodePool LatticeNodePool; // Nodes the temporal layers write their states to
+
+    // World-wide fractal frame budget; null outside game worlds or with adaptive scaling off
+    TWeakObjectPtr<UFractalComputeGovernorSubsystem> ComputeGovernor;
+
+    // Flattened RootEmbodimentZone, rebuilt when the authored tree or MaxSpatialRecursionDepth changes
+    FFlatEmbodimentZoneTree FlatEmbodimentZones;
+    bool bEmbodimentZonesDirty = true;
+    float EmbodimentZoneCheckAccumulator = 0.0f;
+    static constexpr float EmbodimentZoneCheckInterval = 1.0f; // Seconds between hashes of the authored tree
+
     // Internal state tracking
-    TMap<ECognitiveLatticeOrder, float> OrderResonanceHistory;
-    TArray<FHexademic6DCoordinate> ConsciousnessTrajectory; // Path through 6D space
+    // Path through 6D space: X, Y, Z, W, U, V and LatticeOrder per update, delta-encoded (lossless) against 1 Hz keyframes
+    using FTrajectoryHistory = THexademicHistoryStore<uint64, 7>;
+    FTrajectoryHistory ConsciousnessTrajectory;
+    double FractalClockSeconds = 0.0; // Accumulated update time; trajectory timestamps and the layer scheduler's clock
+    static constexpr int32 TrajectoryFramesPerKeyframe = 30;
+    static constexpr int32 TrajectoryKeyframes = 241; // ~4 minutes at the orchestrator's 30 Hz
     float LastTranscendenceLevel = 0.0f;
 
     // Event Handlers for MythkeeperCodex6Component delegates
@@ -673,6 +898,14 @@ namespace Hexademic6FractalUtils
      * @return Generated narrative thread
      */
     HEXADEMICPLUGIN_API FString GenerateNarrativeFromFractalPatterns(const TArray<FTemporalFractalLayer>& FractalLayers, const TArray<FHexademicMemoryNode>& LatticeMemories);
+
+    /**
+     * @brief Generates mythic narrative from precomputed pattern summaries, without revisiting layer state
+     * @param Summaries Completed mythic patterns, e.g. from UMythkeeperCodex6Component
+     * @param MaxThreads Strongest summaries to weave in
+     * @return Generated narrative thread, empty if there are no summaries
+     */
+    HEXADEMICPLUGIN_API FString GenerateNarrativeFromPatternSummaries(TConstArrayView<FHexademicMythicPatternSummary> Summaries, int32 MaxThreads = 2);
 }
 
 //=============================================================================
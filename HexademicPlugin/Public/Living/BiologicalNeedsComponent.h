@@ -17,6 +17,9 @@ protected:
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
+    /** Raises hunger, thirst and fatigue at their rates. TickComponent calls this; headless session replay calls it directly. */
+    void AdvanceNeeds(float DeltaTime);
+
     UFUNCTION(BlueprintCallable, Category = "Biological Needs")
     void ConsumeFood(float NutritionValue);
 
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Core/HexademicTuning.h"
 #include "HexademicCore.h" // Includes FHapticMemoryContext, FAetherTouchPacket, FEmotionalState
 #include "EmotionCognitionComponent.generated.h"
 
@@ -34,7 +35,9 @@ class HEXADEMICMIND_API UEmotionCognitionComponent : public UActorComponent {
     GENERATED_BODY()
 public:
     UEmotionCognitionComponent();
+    virtual void PostLoad() override;
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
     /**
      * @brief Registers a new emotional event, modulating the current emotional state.
@@ -76,6 +79,18 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category="Emotion")
     void ModulateEmotionFromHaptic(float Intensity, FString RegionTag);
+    /**
+     * @brief ModulateEmotionFromHaptic for an already resolved region; the per-packet path.
+     */
+    UFUNCTION(BlueprintCallable, Category="Emotion")
+    void ModulateEmotionFromHapticRegion(float Intensity, EHexademicBodyRegion Region);
+    /**
+     * @brief How strongly touch on Region moves the emotional state.
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category="Emotion|Tuning")
+    float GetHapticSensitivity(EHexademicBodyRegion Region) const;
+    UFUNCTION(BlueprintCallable, Category="Emotion|Tuning")
+    void SetHapticSensitivity(EHexademicBodyRegion Region, float Sensitivity);
     /**
      * @brief Stores a haptic-emotional memory, linking a touch event to the emotional state it produced.
      * This captures the current emotional state (Valence, Arousal) after haptic modulation.
@@ -83,6 +98,11 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category="Emotion|Memory")
     void StoreHapticEmotionMemory(const FAetherTouchPacket& Packet);
+    /**
+     * @brief Advances oscillators and memory decay. TickComponent calls this; headless session replay calls it directly.
+     * @param DeltaTime The time elapsed since the last advance.
+     */
+    void AdvanceEmotionalTime(float DeltaTime);
 protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Emotional State")
     float Valence; // Current emotional valence
@@ -114,7 +134,13 @@ protected:
      * @param DeltaTime The time elapsed since the last tick.
      */
     void DecayEmotionalMemory(float DeltaTime);
-    // Sensitivity map for haptic regions, allowing different body parts to have varied emotional impacts
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Emotion|Tuning")
+    // Sensitivity per haptic region, indexed by EHexademicBodyRegion, allowing different body parts to have varied emotional impacts
+    UPROPERTY(EditAnywhere, Category="Emotion|Tuning", meta=(ArraySizeEnum="EHexademicBodyRegion"))
+    float RegionHapticSensitivities[NumHexademicBodyRegions];
+    // The string-keyed sensitivities saved before regions had IDs; PostLoad moves them into RegionHapticSensitivities
+    UPROPERTY()
     TMap<FString, float> HapticSensitivityByRegion;
+
+private:
+    FHexademicTuningBinding TuningBinding;
 };
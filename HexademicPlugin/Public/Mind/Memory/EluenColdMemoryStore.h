@@ -0,0 +1,115 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+
+/**
+ * @brief Cold tier of an agent's memory container: memory text packed into compressed pages in a file.
+ *
+ * Memories evicted from the hot tier are appended, as UTF-8, to an open page. Once the open page reaches
+ * PageBytes it is compressed (Oodle when the engine has it, zlib otherwise) and appended to the agent's file,
+ * and only a small location record per memory stays in RAM. Reading a memory back decompresses its page;
+ * recently used pages are cached decompressed, and Prefetch loads pages on the thread pool ahead of time
+ * so an anticipated recall finds its page already in the cache.
+ * The file lives for the session only and is deleted with the store. Once the dead bytes left by taken or
+ * removed memories outweigh the live ones, the file is rewritten: fully dead pages are dropped, mostly dead
+ * pages are repacked and the rest are copied as they are.
+ * Game thread only, apart from the prefetch tasks, which share nothing with it but FPrefetchState.
+ */
+class HEXADEMICPLUGIN_API FEluenColdMemoryStore
+{
+public:
+    static constexpr int32 PageBytes = 64 * 1024;  // Uncompressed
+    static constexpr int32 MaxCachedPages = 8;
+    static constexpr int64 MinCompactionDeadBytes = 4 * PageBytes; // Uncompressed; small files are not worth rewriting
+
+    explicit FEluenColdMemoryStore(const FString& InFilePath);
+    ~FEluenColdMemoryStore();
+
+    /** Adds or replaces a memory. */
+    void Add(const FString& MemoryID, FStringView MemoryContext);
+
+    /** Reads a memory and removes it from the store, for promotion to the hot tier. */
+    bool Take(const FString& MemoryID, FString& OutMemoryContext);
+
+    bool Remove(const FString& MemoryID);
+    bool Contains(const FString& MemoryID) const { return Locations.Contains(MemoryID); }
+
+    /** Starts loading the pages holding MemoryIDs on the thread pool; unknown and already cached IDs are skipped. */
+    void Prefetch(TConstArrayView<FString> MemoryIDs);
+
+    void Empty();
+
+    int32 Num() const { return Locations.Num(); }
+
+    /** Bytes of the file, sealed pages only, dead space included. */
+    int64 GetFileBytes() const { return FileBytes; }
+
+private:
+    struct FLocation
+    {
+        int32 Page = 0; // Pages.Num() while still in the open page: sealing it needs no fix-up
+        int32 Offset = 0;
+        int32 Length = 0;
+    };
+
+    struct FPage
+    {
+        int64 FileOffset = 0;
+        int32 CompressedSize = 0;
+        int32 RawSize = 0;
+        int32 LiveEntries = 0;
+        int32 LiveBytes = 0; // Uncompressed
+        bool bCompressed = true;
+    };
+
+    struct FLoadedPage
+    {
+        int32 Page = INDEX_NONE;
+        uint32 Generation = 0; // Pages loaded before an Empty are dropped
+        TArray<uint8> Bytes;
+    };
+
+    /** Shared with prefetch tasks, which may finish after the store is gone. */
+    struct FPrefetchState
+    {
+        TQueue<FLoadedPage, EQueueMode::Mpsc> Loaded;
+    };
+
+    void SealOpenPage();
+    void CompressPage(const TArray<uint8>& RawBytes, FPage& Page, TArray<uint8>& OutStoredBytes) const;
+
+    /** Rewrites the file without its dead space once that outweighs the live bytes. */
+    void CompactIfWasteful();
+    void Compact();
+    bool IsOpenPage(int32 Page) const { return Page == Pages.Num(); }
+
+    /** Decompressed bytes of Page: from the cache, a finished prefetch, or the file. Null if unreadable. */
+    const TArray<uint8>* GetPage(int32 Page);
+    void CachePage(int32 Page, TArray<uint8>&& Bytes);
+    void DrainPrefetched();
+    void ReleaseEntry(const FLocation& Location);
+
+    static bool ReadPage(const FString& FilePath, FName Format, const FPage& Page, TArray<uint8>& OutBytes);
+    static bool ReadStoredBytes(FArchive& Reader, const FPage& Page, TArray<uint8>& OutStoredBytes);
+    static bool DecompressPage(FName Format, const FPage& Page, const TArray<uint8>& StoredBytes, TArray<uint8>& OutBytes);
+
+    FString FilePath;
+    FName Format;
+    TUniquePtr<FArchive> Writer; // Opened on the first sealed page
+    int64 FileBytes = 0;
+    int64 SealedLiveBytes = 0; // Uncompressed, over the sealed pages
+    int64 SealedDeadBytes = 0;
+    bool bCanCompact = true;   // Cleared when a rewrite fails, so a bad disk is not retried on every change
+
+    TMap<FString, FLocation> Locations;
+    TArray<FPage> Pages;
+    TArray<uint8> OpenPage;
+    int32 OpenPageLiveEntries = 0;
+    int32 OpenPageLiveBytes = 0;
+
+    TArray<FLoadedPage> CachedPages; // Most recently used last
+    TSet<int32> PagesInFlight;
+    uint32 Generation = 0;
+    TSharedRef<FPrefetchState, ESPMode::ThreadSafe> PrefetchState;
+};
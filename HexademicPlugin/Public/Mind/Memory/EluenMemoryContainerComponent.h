@@ -1,9 +1,19 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Components/ActorComponent.
+#include "Components/ActorComponent.h"
+#include "Containers/List.h"
+#include "Mind/Memory/EluenColdMemoryStore.h"
 #include "Mind/Memory/EluenMemoryContainerComponent.generated.h"
 
+/**
+ * @brief An agent's narrative memory, in two tiers.
+ *
+ * Recently stored or recalled memories stay in RAM, in a hot tier bounded by HotTierBudgetKB. When the budget
+ * is exceeded, the least recently used memories move to a cold tier of compressed pages in a per-agent file
+ * under Saved/Hexademic/MemoryCold, and a recall from the cold tier brings the memory back into the hot tier.
+ * PrefetchMemories loads cold pages on the thread pool ahead of recalls the caller expects to make.
+ */
 UCLASS(ClassGroup=(HexademicMind), meta=(BlueprintSpawnableComponent))
 class HEXADEMICPLUGIN_API UEluenMemoryContainerComponent : public UActorComponent
 {
@@ -14,18 +24,64 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     UFUNCTION(BlueprintCallable, Category = "Memory")
     void StoreMemory(const FString& MemoryID, const FString& MemoryContext);
 
+    /** Reads a memory from either tier; a cold memory moves back into the hot tier. */
     UFUNCTION(BlueprintCallable, Category = "Memory")
     bool RecallMemory(const FString& MemoryID, FString& OutMemoryContext) const;
 
     UFUNCTION(BlueprintCallable, Category = "Memory")
     void ForgetMemory(const FString& MemoryID);
-    
-    // Placeholder for a simple memory storage. In a real system, this would be more complex.
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Memory")
-    TMap<FString, FString> StoredMemories;
+
+    /** Starts loading cold memories that are about to be recalled, so the recall does not wait on the disk. */
+    UFUNCTION(BlueprintCallable, Category = "Memory")
+    void PrefetchMemories(const TArray<FString>& MemoryIDs);
+
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Memory")
+    bool HasMemory(const FString& MemoryID) const;
+
+    /** Memories in both tiers. */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Memory")
+    int32 GetNumMemories() const;
+
+    /** ID of the last memory stored or recalled; empty if there is none. */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Memory")
+    FString GetMostRecentMemoryID() const;
+
+    /** RAM for memory text in the hot tier; beyond it, the least recently used memories go cold. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Memory|Tiers", meta = (ClampMin = "1"))
+    int32 HotTierBudgetKB = 1024;
+
+    /** Without the cold tier every memory stays in RAM, as before tiering. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Memory|Tiers")
+    bool bEnableColdTier = true;
+
+private:
+    using FRecencyList = TDoubleLinkedList<FString>;
+
+    struct FHotMemory
+    {
+        FString Context;
+        FRecencyList::TDoubleLinkedListNode* RecencyNode = nullptr;
+    };
+
+    // Const because a recall only moves memories between tiers; what is remembered stays the same
+    void AddHot(const FString& MemoryID, FString&& MemoryContext) const;
+    bool RemoveHot(const FString& MemoryID) const;
+    void Touch(FHotMemory& Memory) const;
+
+    /** Moves least recently used memories to the cold tier until the hot tier fits its budget. */
+    void SpillToColdTier() const;
+
+    static int64 GetTextBytes(const FString& Text) { return Text.GetAllocatedSize(); }
+
+    // Mutable so RecallMemory can stay const, and a pure node in Blueprint graphs, while it promotes
+    mutable TMap<FString, FHotMemory> HotMemories;
+    mutable FRecencyList HotRecency; // Most recent at the head
+    mutable int64 HotBytes = 0;
+    mutable TUniquePtr<FEluenColdMemoryStore> ColdStore; // Created on the first spill
 };
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "HexademicCore.h" // For FSovereignMemoryFilament
+#include "Core/HexademicTagIndex.h"
 #include "Mind/Memory/SovereignMemoryVaultComponent.generated.h"
 
 UCLASS(ClassGroup=(HexademicMind), meta=(BlueprintSpawnableComponent))
@@ -25,6 +26,41 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Sovereign Memory")
     void BindFilament(const FAffectFilamentTag& Filament);
 
+    /**
+     * @brief Binds many filaments at once, indexing them in a single pass.
+     * @param Filaments The ritualized touches to bind, in order.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Sovereign Memory")
+    void BindFilaments(const TArray<FAffectFilamentTag>& Filaments);
+
+    /**
+     * @brief Replaces a stored filament and re-indexes its tags.
+     * @param Index Position of the filament in StoredFilaments.
+     * @param Filament The new contents.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Sovereign Memory")
+    void UpdateFilament(int32 Index, const FSovereignMemoryFilament& Filament);
+
+    /** @brief Rebuilds the tag indexes from StoredFilaments, e.g. after it was loaded or edited directly. */
+    UFUNCTION(BlueprintCallable, Category = "Sovereign Memory")
+    void RebuildTagIndex();
+
+    /**
+     * @brief Finds filaments by tag. Region, event type and emotional signature are all tags; matching is per word, without case.
+     * @param Tags The tags to look for.
+     * @param bMatchAll True for filaments carrying every tag, false for filaments carrying any of them.
+     * @return Indices into StoredFilaments, ascending.
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Sovereign Memory")
+    TArray<int32> FindFilamentsByTags(const TArray<FString>& Tags, bool bMatchAll = true) const;
+
+    /**
+     * @brief Finds filaments with a tag word starting with Prefix.
+     * @return Indices into StoredFilaments, ascending.
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Sovereign Memory")
+    TArray<int32> FindFilamentsByTagPrefix(const FString& Prefix) const;
+
     /**
      * @brief Blooms a filament based on a narrative scene tag, indicating recall or emphasis.
      * @param NarrativeScene The narrative context or scene tag to search for.
@@ -39,4 +75,11 @@ public:
 protected:
     // Helper to generate a new unique memory ID (could use FGuid for robustness)
     FString GenerateNewMemoryID();
+
+private:
+    FSovereignMemoryFilament MakeFilament(const FAffectFilamentTag& Filament) const;
+    void IndexFilament(int32 Index);
+
+    FHexademicTagIndex RegionIndex; // Region words only: what scene tags bloom on
+    FHexademicTagIndex TagIndex;    // Words of every tagged field
 };
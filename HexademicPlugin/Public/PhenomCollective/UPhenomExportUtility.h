@@ -7,6 +7,7 @@
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "HexademicCore.h" // For FUnifiedConsciousnessState
+#include "Core/HexademicJsonWriter.h"
 #include "PhenomCollective/UPhenomExportUtility.generated.h"
 
 // Forward declaration needed if FUnifiedConsciousnessState is different from the one expected by this utility
@@ -68,6 +69,21 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Phenom Collective|Utility")
     static FString StateToJSON(const FUnifiedConsciousnessState& State);
 
+    /**
+     * Writes State as a JSON object with the StateToJSON keys, straight into Writer.
+     * @param Writer The writer to append to.
+     * @param State The state to write.
+     */
+    static void WriteStateJSON(FHexademicJsonWriter& Writer, const FUnifiedConsciousnessState& State);
+
+    /**
+     * Writes State as JSON to a file on the thread pool; the game thread only serializes it to bytes.
+     * @param State The state to write.
+     * @param FilePath The full path to save the file.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Phenom Collective|Utility")
+    static void SaveStateJSONToFileAsync(const FUnifiedConsciousnessState& State, const FString& FilePath);
+
     /**
      * Converts a JSON string to a FIncomingPhenomState.
      * @param JsonString The JSON string to parse.
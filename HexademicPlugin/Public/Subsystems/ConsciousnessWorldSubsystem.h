@@ -50,6 +50,15 @@ public:
     UFUNCTION(BlueprintPure, Category = "Global Consciousness")
     TArray<UHexademicConsciousnessComponent*> GetAllRegisteredConsciousnessComponents() const { return RegisteredConsciousnessComponents; }
 
+    /**
+     * @brief Classifies the dominant emotional archetype of every registered consciousness in one batched sweep.
+     * Each component's current archetype and ArchetypeHysteresisMargin are carried in, so the result matches
+     * what the component would derive on its own.
+     * @param OutArchetypes One entry per registered component, in GetAllRegisteredConsciousnessComponents() order.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Global Consciousness")
+    void ClassifyRegisteredArchetypes(TArray<EEmotionalArchetype>& OutArchetypes);
+
     // --- Consciousness LOD Management ---
     /**
      * @brief Sets the global consciousness LOD strategy.
@@ -77,6 +86,13 @@ protected:
     // Internal helper to calculate LOD for a single component
     EConsciousnessLOD CalculateLODForComponent(UHexademicConsciousnessComponent* Component) const;
 
+    // Scratch for ClassifyRegisteredArchetypes, laid out for the batch classifier
+    TArray<float> ClassifyValence;
+    TArray<float> ClassifyArousal;
+    TArray<float> ClassifyIntensity;
+    TArray<EEmotionalArchetype> ClassifyPrevious;
+    TArray<float> ClassifyMargin;
+
     // Reference to the player character for distance-based LOD
     UPROPERTY(Transient)
     TObjectPtr<APawn> PlayerPawn;
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Subsystems/EmbodimentSignificanceSubsystem.generated.h"
+
+class UActorComponent;
+
+/** How often an embodiment component updates. */
+UENUM(BlueprintType)
+enum class EEmbodimentUpdateTier : uint8
+{
+    EveryFrame,     // Full rate
+    Interleaved,    // Every Nth frame, staggered across agents
+    Frozen          // No updates; the last pose and expression hold
+};
+
+/**
+ * @brief Per-component update gate, owned by the component and steered by UEmbodimentSignificanceSubsystem.
+ *
+ * The component calls Advance once per tick. On skipped frames time accumulates, and the update that follows
+ * receives all of it, so blends driven with GetBlendAlpha follow the same curve at any update rate; a sparse
+ * agent samples that curve less often instead of lagging behind it. The time an agent spends frozen is handed
+ * to its first update after thawing in the same way.
+ */
+struct HEXADEMICPLUGIN_API FEmbodimentUpdateGate
+{
+    EEmbodimentUpdateTier Tier = EEmbodimentUpdateTier::EveryFrame;
+    int32 FrameInterval = 1;
+    int32 FramePhase = 0;
+    float PendingDeltaSeconds = 0.0f;
+    double FrozenAtSeconds = -1.0; // World time the gate was frozen, or negative while it is not
+
+    /** True when this frame should update; OutDeltaSeconds is then the time since the previous update. */
+    bool Advance(float DeltaTime, float& OutDeltaSeconds);
+
+    bool IsFrozen() const { return Tier == EEmbodimentUpdateTier::Frozen; }
+
+    /** Frame-rate independent blend factor for an exponential approach at BlendSpeed per second. */
+    static float GetBlendAlpha(float BlendSpeed, float DeltaSeconds) { return 1.0f - FMath::Exp(-BlendSpeed * DeltaSeconds); }
+};
+
+/**
+ * @brief Significance manager for the embodiment layer.
+ *
+ * Animation bridges, facial expression and body components register their FEmbodimentUpdateGate here. A few
+ * times a second every registered agent is scored from whether it was recently rendered, its projected screen
+ * size and its owner's EConsciousnessLOD, and its gates are assigned a tier:
+ *  - Frozen when the agent is not being rendered (or, without a local view, when its consciousness is Dormant);
+ *    ticking components stop ticking entirely.
+ *  - EveryFrame when it is on screen at Full LOD and at least FullRateScreenSize.
+ *  - Interleaved otherwise: every 2 frames at Reduced LOD or below FullRateScreenSize, and every MaxFrameInterval
+ *    frames at Minimal or Dormant LOD or below SmallScreenSize. Phases are staggered so agents do not update on the
+ *    same frame.
+ * Only agents nobody can see are frozen, and visible ones are at worst sampled every MaxFrameInterval frames, so
+ * nothing pops on screen: a thawed agent blends onward from the pose it held.
+ */
+UCLASS()
+class HEXADEMICPLUGIN_API UEmbodimentSignificanceSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** The significance manager of WorldContext's world, or null outside a game world. */
+    static UEmbodimentSignificanceSubsystem* GetFor(const UObject* WorldContext);
+
+    /** Puts Gate under significance control. Gate must live inside Component and stay registered until EndPlay. */
+    void RegisterComponent(UActorComponent* Component, FEmbodimentUpdateGate& Gate);
+    void UnregisterComponent(UActorComponent* Component);
+
+    /** Tier currently assigned to Actor's embodiment components. */
+    UFUNCTION(BlueprintPure, Category = "Hexademic|Embodiment Significance")
+    EEmbodimentUpdateTier GetTierForActor(const AActor* Actor) const;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hexademic|Embodiment Significance", meta = (ClampMin = "0.01"))
+    float EvaluationInterval = 0.25f; // Seconds between significance passes
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hexademic|Embodiment Significance", meta = (ClampMin = "0.0"))
+    float RecentlyRenderedTolerance = 0.2f; // Seconds since last render that still counts as on screen
+
+    // Projected screen sizes, as bounding sphere diameter over view height
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hexademic|Embodiment Significance", meta = (ClampMin = "0.0"))
+    float FullRateScreenSize = 0.1f;
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hexademic|Embodiment Significance", meta = (ClampMin = "0.0"))
+    float SmallScreenSize = 0.02f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hexademic|Embodiment Significance", meta = (ClampMin = "2", ClampMax = "8"))
+    int32 MaxFrameInterval = 4;
+
+private:
+    struct FRegisteredGate
+    {
+        TWeakObjectPtr<UActorComponent> Component;
+        FEmbodimentUpdateGate* Gate = nullptr;
+        bool bTickSuspended = false; // We disabled its tick on freezing and owe it a re-enable
+    };
+
+    struct FAgentSignificance
+    {
+        TWeakObjectPtr<AActor> Actor;
+        TArray<FRegisteredGate, TInlineAllocator<4>> Gates;
+        EEmbodimentUpdateTier Tier = EEmbodimentUpdateTier::EveryFrame;
+        int32 FrameInterval = 1;
+        int32 StaggerSlot = 0;
+    };
+
+    void EvaluateAll();
+    void EvaluateAgent(FAgentSignificance& Agent, const FVector& ViewLocation, float ViewTanHalfFOV) const;
+    void ApplyTier(FAgentSignificance& Agent) const;
+
+    TMap<FObjectKey, FAgentSignificance> Agents;
+    float TimeSinceEvaluation = 0.0f;
+    int32 NextStaggerSlot = 0;
+};
@@ -0,0 +1,169 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Core/HexademicMetrics.h"
+#include "Subsystems/FractalComputeGovernorSubsystem.generated.h"
+
+struct FHexademicTuningTable;
+
+/** The fractal subsystems whose per-frame cost the governor meters. */
+UENUM(BlueprintType)
+enum class EFractalComputeStage : uint8
+{
+    TemporalLayers,
+    SpatialZones,
+    LatticeSync,
+    MythicPatterns,
+
+    Count UMETA(Hidden)
+};
+
+/** What a stage may do this frame. */
+UENUM(BlueprintType)
+enum class EFractalComputeDecision : uint8
+{
+    Run,        // Full work
+    Degrade,    // Reduced work: cached lattice results, slow layers skipped
+    Defer       // No work this frame
+};
+
+/**
+ * @brief Keeps the summed cost of fractal processing across every agent in the world under a per-frame ceiling.
+ *
+ * Each stage of each agent asks for admission before it runs and reports its measured time afterwards. Costs are
+ * predicted per agent and stage from an exponential average of recent measurements plus a deviation margin, with
+ * the world-wide average for the stage standing in until an agent has history of its own. A stage nobody has
+ * measured yet is priced at a fixed share of the frame budget rather than as free.
+ *
+ * Admission is by importance: stages whose importance (agent importance x stage weight) is below a cutoff are
+ * degraded or deferred. A feedback controller moves the cutoff each frame so measured spend tracks
+ * FractalSettings.TargetUtilization of the budget. Requests arrive in tick order, so the budget is also reserved
+ * by importance tier: a request may only use what is left after the demand that higher tiers placed last frame,
+ * and have not yet claimed this frame, is set aside. A request that does not fit in that share is never run in
+ * full. Spend beyond FractalSettings.FrameBudgetMs is carried into the next frame as debt. Deferred stages gain
+ * importance each frame they wait, so nothing starves. Every decision is counted under
+ * FractalGovernor.<Stage>.<Decision>.
+ */
+UCLASS()
+class HEXADEMICPLUGIN_API UFractalComputeGovernorSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** The governor of WorldContext's world, or null outside a game world. */
+    static UFractalComputeGovernorSubsystem* GetFor(const UObject* WorldContext);
+
+    /**
+     * @brief Decides whether Agent's Stage may run this frame and reserves its predicted cost.
+     * @param Importance The agent's importance; scaled by the stage's weight.
+     * @param OutReservedMicros What was reserved; pass it back to ReportCost.
+     */
+    EFractalComputeDecision Admit(const UObject* Agent, EFractalComputeStage Stage, float Importance, double& OutReservedMicros);
+
+    /** Replaces the reservation with the measured cost and updates the agent's cost model. */
+    void ReportCost(const UObject* Agent, EFractalComputeStage Stage, EFractalComputeDecision Decision, double ReservedMicros, double MeasuredMicros);
+
+    /** Drops Agent's cost model. Call when the agent stops processing. */
+    void ForgetAgent(const UObject* Agent);
+
+    /** Predicted cost of Agent's Stage in microseconds, degraded or full. */
+    double PredictCostMicros(const UObject* Agent, EFractalComputeStage Stage, bool bDegraded) const;
+
+    /** What Agent's stages measured in total over the last completed frame, in microseconds. */
+    double GetAgentLastFrameMicros(const UObject* Agent) const;
+
+    UFUNCTION(BlueprintPure, Category = "Hexademic|Fractal Governor")
+    float GetFrameBudgetMs() const { return static_cast<float>(FrameBudgetMicros / 1000.0); }
+
+    UFUNCTION(BlueprintPure, Category = "Hexademic|Fractal Governor")
+    float GetLastFrameSpentMs() const { return static_cast<float>(LastFrameSpentMicros / 1000.0); }
+
+    UFUNCTION(BlueprintPure, Category = "Hexademic|Fractal Governor")
+    float GetImportanceCutoff() const { return ImportanceCutoff; }
+
+private:
+    static constexpr int32 NumStages = static_cast<int32>(EFractalComputeStage::Count);
+    static constexpr int32 NumDecisions = 3;
+
+    /** Exponentially averaged cost with a mean absolute deviation, for full and degraded runs separately. */
+    struct FCostModel
+    {
+        double MeanMicros[2] = { 0.0, 0.0 };
+        double DeviationMicros[2] = { 0.0, 0.0 };
+        int32 NumSamples[2] = { 0, 0 };
+
+        void AddSample(bool bDegraded, double Micros);
+        bool Predict(bool bDegraded, double& OutMicros) const;
+    };
+
+    struct FAgentState
+    {
+        FCostModel Stages[NumStages];
+        int32 FramesDeferred[NumStages] = {};
+        double SpentThisFrameMicros = 0.0;
+        double SpentLastFrameMicros = 0.0;
+        uint64 LastActiveFrame = 0;
+    };
+
+    void RollFrameIfNeeded();
+    void ApplyTuning(const FHexademicTuningTable& Table);
+    static float GetStageWeight(EFractalComputeStage Stage);
+    static int32 GetImportanceTier(float EffectiveImportance);
+    /** Budget set aside for tiers above Tier that requested it last frame and have not arrived yet this frame. */
+    double GetReservedAboveTier(int32 Tier) const;
+
+    TMap<FObjectKey, FAgentState> Agents;
+    FCostModel WorldStageModels[NumStages]; // Prior for agents without history
+
+    double FrameBudgetMicros = 2000.0;
+    float TargetUtilization = 0.85f;
+    float ImportanceCutoffGain = 0.5f;
+
+    uint64 CurrentFrame = 0;
+    double SpentThisFrameMicros = 0.0;   // Measured, plus reservations not yet reported, plus carried debt
+    double LastFrameSpentMicros = 0.0;
+    double CarriedDebtMicros = 0.0;      // Overspend of the previous frame, charged to this one
+    float ImportanceCutoff = 0.0f;
+
+    static constexpr int32 NumImportanceTiers = 6;
+    double TierDemandMicros[NumImportanceTiers] = {};          // Full cost requested per tier this frame
+    double ExpectedTierDemandMicros[NumImportanceTiers] = {};  // ...and last frame
+
+    FHexademicMetricHandle DecisionCounters[NumStages][NumDecisions];
+    FHexademicMetricHandle StageCostHistograms[NumStages];
+
+    static constexpr double CostAverageAlpha = 0.2;
+    static constexpr double DeviationMargin = 2.0;      // Predictions are mean + this many mean deviations
+    static constexpr float DegradeBand = 0.5f;          // Below the cutoff but above this share of it: degrade rather than defer
+    static constexpr float DeferralBoost = 0.25f;       // Importance gained per consecutive deferred frame
+    static constexpr float MaxImportanceCutoff = 8.0f;
+    static constexpr double ColdStartBudgetShare = 0.25; // Price of a stage no agent has measured yet
+};
+
+/**
+ * @brief Admits a fractal stage on construction and reports its measured cost on destruction.
+ * Without a governor every stage runs and nothing is measured.
+ */
+class HEXADEMICPLUGIN_API FFractalComputeScope
+{
+public:
+    FFractalComputeScope(UFractalComputeGovernorSubsystem* InGovernor, const UObject* InAgent, EFractalComputeStage InStage, float Importance);
+    ~FFractalComputeScope();
+
+    EFractalComputeDecision GetDecision() const { return Decision; }
+    bool ShouldRun() const { return Decision != EFractalComputeDecision::Defer; }
+    bool IsDegraded() const { return Decision == EFractalComputeDecision::Degrade; }
+
+private:
+    UFractalComputeGovernorSubsystem* Governor;
+    const UObject* Agent;
+    EFractalComputeStage Stage;
+    EFractalComputeDecision Decision = EFractalComputeDecision::Run;
+    double ReservedMicros = 0.0;
+    uint64 StartCycles = 0;
+};
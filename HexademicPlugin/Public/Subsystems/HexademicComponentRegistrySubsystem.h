@@ -0,0 +1,141 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "UObject/ObjectKey.h"
+#include "Subsystems/HexademicComponentRegistrySubsystem.generated.h"
+
+/**
+ * @brief Type-indexed table of one actor's components.
+ *
+ * Built in a single pass over the actor's component set: each component is filed under its own class and
+ * every superclass up to UActorComponent, so Find<T>() is one map lookup and matches what
+ * FindComponentByClass<T>() would return (the first component that IsA T). The owning subsystem marks the
+ * table stale whenever one of the actor's components registers or unregisters, and the next lookup rebuilds
+ * it; NotifyComponentsChanged() rebuilds immediately. Every rebuild broadcasts OnRebuilt so dependents re-bind.
+ */
+class HEXADEMICPLUGIN_API FHexademicComponentRegistry
+{
+public:
+    explicit FHexademicComponentRegistry(AActor* InOwner);
+
+    /** The component of class T (or a subclass) on the owner, or null. */
+    template<typename T>
+    T* Find()
+    {
+        static_assert(TIsDerivedFrom<T, UActorComponent>::Value, "FHexademicComponentRegistry only indexes UActorComponents");
+        // Entries are filed by IsA at build time, so the downcast cannot fail
+        return static_cast<T*>(FindByClass(T::StaticClass()));
+    }
+
+    /**
+     * @brief Fills an unset or dangling reference from the registry. Live references set in the editor or as
+     * sub-objects are kept; a reference to a destroyed component is replaced.
+     * @param Slot The reference to fill; its declared type is the type looked up.
+     * @param SlotName Used in the warning if nothing on the owner matches.
+     * @return True if Slot is set afterwards.
+     */
+    template<typename T>
+    bool Bind(TObjectPtr<T>& Slot, const TCHAR* SlotName)
+    {
+        if (!IsValid(Slot))
+        {
+            Slot = Find<T>();
+            if (!Slot)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("[ComponentRegistry:%s] %s (%s) not found on owner."), *GetNameSafe(Owner.Get()), SlotName, *T::StaticClass()->GetName());
+            }
+            else if (IsAmbiguous(T::StaticClass()))
+            {
+                UE_LOG(LogTemp, Verbose, TEXT("[ComponentRegistry:%s] %s bound to %s; owner has several %s components."), *GetNameSafe(Owner.Get()), SlotName, *Slot->GetName(), *T::StaticClass()->GetName());
+            }
+        }
+        return Slot != nullptr;
+    }
+
+    UActorComponent* FindByClass(const UClass* ComponentClass);
+    bool IsAmbiguous(const UClass* ComponentClass) const { return AmbiguousClasses.Contains(ComponentClass); }
+
+    /**
+     * @brief Re-indexes the owner's components and broadcasts OnRebuilt.
+     * Lookups made from OnRebuilt handlers are served from the table just built and never rebuild again.
+     */
+    void Rebuild();
+    /** Rebuilds on the next lookup. Called when one of the owner's components registers or unregisters. */
+    void MarkStale() { bStale = true; }
+    bool IsStale() const { return bStale; }
+
+    AActor* GetOwner() const { return Owner.Get(); }
+
+    /** Broadcast after every rebuild, so holders of bound references can refresh them. */
+    FSimpleMulticastDelegate OnRebuilt;
+
+private:
+    TWeakObjectPtr<AActor> Owner;
+    TMap<const UClass*, TWeakObjectPtr<UActorComponent>> ComponentsByClass;
+    TSet<const UClass*> AmbiguousClasses;
+    bool bStale = false;
+    bool bBroadcastingRebuild = false;
+};
+
+/**
+ * @brief Owns the FHexademicComponentRegistry of every actor in the world that asks for one.
+ * Registries are created on first use and dropped when their actor is destroyed. Component registration
+ * anywhere in the world marks its owner's registry stale, so lookups never have to check for changes.
+ */
+UCLASS()
+class HEXADEMICPLUGIN_API UHexademicComponentRegistrySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** The registry for Actor, built on first use. */
+    TSharedRef<FHexademicComponentRegistry> GetRegistry(AActor* Actor);
+
+    /** Call after adding or removing components at runtime to rebuild Actor's registry right away. */
+    UFUNCTION(BlueprintCallable, Category = "Hexademic|Components")
+    void NotifyComponentsChanged(AActor* Actor);
+
+    /** The registry for Actor via its world's subsystem, or null for actors outside a world. */
+    static TSharedPtr<FHexademicComponentRegistry> GetRegistryFor(AActor* Actor);
+
+    /** Registry lookup with a FindComponentByClass fallback for actors outside a world. */
+    template<typename T>
+    static T* FindComponent(AActor* Actor)
+    {
+        if (TSharedPtr<FHexademicComponentRegistry> Registry = GetRegistryFor(Actor))
+        {
+            return Registry->Find<T>();
+        }
+        return Actor ? Actor->FindComponentByClass<T>() : nullptr;
+    }
+
+    /** FHexademicComponentRegistry::Bind with a FindComponentByClass fallback for actors outside a world. */
+    template<typename T>
+    static bool BindComponent(AActor* Actor, TObjectPtr<T>& Slot, const TCHAR* SlotName)
+    {
+        if (TSharedPtr<FHexademicComponentRegistry> Registry = GetRegistryFor(Actor))
+        {
+            return Registry->Bind(Slot, SlotName);
+        }
+        if (!IsValid(Slot) && Actor)
+        {
+            Slot = Actor->FindComponentByClass<T>();
+        }
+        return Slot != nullptr;
+    }
+
+private:
+    void HandleActorDestroyed(AActor* Actor);
+    void HandleComponentRegistrationChanged(UActorComponent* Component);
+
+    TMap<FObjectKey, TSharedRef<FHexademicComponentRegistry>> Registries;
+    FDelegateHandle ActorDestroyedHandle;
+    FDelegateHandle ComponentRegisteredHandle;
+    FDelegateHandle ComponentUnregisteredHandle;
+};
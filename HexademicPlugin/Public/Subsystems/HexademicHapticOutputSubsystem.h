@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/HexademicHapticOutput.h"
+#include "Subsystems/HexademicHapticOutputSubsystem.generated.h"
+
+struct FAetherTouchPacket;
+
+/**
+ * @brief Haptic output pipeline of a world.
+ *
+ * Packets from UGlyph_AetherSkin are merged per body region as they arrive, so any number of touches on
+ * one region within a frame become one pulse. Once per tick the merged frame is handed to a
+ * FHexademicHapticDispatcher, which rate-limits each channel and talks to the device on its own thread;
+ * the game thread never waits on device I/O. Until a suit SDK calls SetDevice, pulses go to an in-memory
+ * FHexademicLoopbackHapticDevice. The hexademic.Haptics.Loopback console command swaps in a file-backed
+ * one for latency measurement. A dedicated server has no one to feel pulses, so it runs no dispatcher and
+ * ignores packets.
+ */
+UCLASS()
+class HEXADEMICPLUGIN_API UHexademicHapticOutputSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** Each world owns a dispatcher thread, so editor and preview worlds do without one. */
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override { return WorldType == EWorldType::Game || WorldType == EWorldType::PIE; }
+
+    /** The haptic output of WorldContext's world, or null outside a game world. */
+    static UHexademicHapticOutputSubsystem* GetFor(const UObject* WorldContext);
+
+    /** Merges Packet into this frame's pulse for its region. */
+    void EnqueuePacket(const FAetherTouchPacket& Packet);
+
+    /**
+     * Replaces the output device. The previous device's thread is stopped first, discarding pulses it still held.
+     * Does nothing on a dedicated server.
+     */
+    void SetDevice(const TSharedRef<IHexademicHapticDevice, ESPMode::ThreadSafe>& Device);
+
+    /** The device pulses currently go to. */
+    TSharedPtr<IHexademicHapticDevice, ESPMode::ThreadSafe> GetDevice() const;
+
+    // Pulses not delivered within this long of their first packet are dropped rather than felt late; read on every flush
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hexademic|Haptics", meta = (ClampMin = "0.005"))
+    float MaxPulseAgeSeconds = 0.05f;
+
+private:
+    FHexademicHapticFrame PendingFrame; // Packets merged since the last tick
+    TUniquePtr<FHexademicHapticDispatcher> Dispatcher;
+};
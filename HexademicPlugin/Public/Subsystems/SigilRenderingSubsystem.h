@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Core/SigilProjection.h" // For FSigilProjection
+#include "Visuals/SigilLifetimeTable.h"
 #include "Subsystems/SigilRenderingSubsystem.generated.h"
 
 // Forward Declarations
@@ -35,6 +36,15 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Sigil Rendering")
     void TriggerGlobalSigilDisplay(const FSigilProjection& SigilData);
 
+    /**
+     * @brief Looks up an active global sigil as it stands now, faded by its remaining lifetime.
+     * @param SigilID The ID the sigil was triggered with.
+     * @param OutSigil Receives the sigil if it is still active.
+     * @return True if the sigil is still active.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Sigil Rendering")
+    bool GetGlobalSigil(const FString& SigilID, FSigilProjection& OutSigil) const;
+
     /**
      * @brief Updates global emotional aura effects based on the world's emotional state.
      * @param GlobalEmotion The current aggregated global emotional state.
@@ -53,9 +63,8 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering Tuning")
     float GlobalDisplayUpdateFrequency = 10.0f; // Hz for global visual updates
 
-    // Storage for active global sigils (if they persist)
-    UPROPERTY()
-    TMap<FString, FSigilProjection> ActiveGlobalSigils;
+    // Active global sigils, expired by their expiry times rather than ticked down
+    TSigilLifetimeTable<uint8> ActiveGlobalSigils;
 
     // References to global visual components/actors in the world
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "References")
@@ -67,7 +76,7 @@ protected:
     float AccumulatedGlobalDisplayTime = 0.0f;
 
     // Helper functions for updating specific global visual effects
-    void ProcessGlobalSigils(float DeltaTime);
+    void ProcessGlobalSigils(double NowSeconds);
     void UpdateGlobalAuraEffect(const FEmotionalState& CurrentGlobalEmotion);
     void UpdateGlobalQuantumEffect(const FQuantumAnalogState& CurrentGlobalQuantumState);
 };
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Core/SigilProjection.h" // For FSigilProjection
+#include "Subsystems/SigilVisualPoolSubsystem.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UMaterialInstanceDynamic;
+class UMaterialInterface;
+class UPrimitiveComponent;
+class USceneComponent;
+class UStaticMesh;
+
+/** How a sigil is drawn. A mesh is drawn as an instance; otherwise ComponentClass (decal or particle) is pooled. */
+struct FSigilVisualStyle
+{
+    UClass* ComponentClass = nullptr;
+    UStaticMesh* Mesh = nullptr;
+    UMaterialInterface* Material = nullptr;
+
+    bool IsInstanced() const { return Mesh != nullptr; }
+};
+
+/** A sigil's visual, as handed out by USigilVisualPoolSubsystem. The generation makes handles to released slots detectably stale. */
+struct FSigilVisualHandle
+{
+    int32 SlotIndex = INDEX_NONE;
+    uint32 Generation = 0;
+
+    bool IsValid() const { return SlotIndex != INDEX_NONE; }
+    bool operator==(const FSigilVisualHandle& Other) const { return SlotIndex == Other.SlotIndex && Generation == Other.Generation; }
+};
+
+/** One visual in use: an instance of a batch, or a pooled component with the material instance it keeps. */
+USTRUCT()
+struct FSigilVisualSlot
+{
+    GENERATED_BODY()
+
+    int32 BatchIndex = INDEX_NONE;
+    int32 InstanceIndex = INDEX_NONE;
+    int32 ComponentPoolIndex = INDEX_NONE;
+
+    UPROPERTY()
+    TObjectPtr<UPrimitiveComponent> Component;
+    UPROPERTY()
+    TObjectPtr<UMaterialInstanceDynamic> Material;
+    UPROPERTY()
+    TWeakObjectPtr<USceneComponent> AttachParent;
+
+    FTransform RelativeTransform; // To AttachParent, fixed when the sigil is projected
+    uint32 Generation = 0;        // Bumped on release; survives the slot being reset
+    bool bInUse = false;
+};
+
+/** Instanced static meshes drawing every sigil of one mesh and material. */
+USTRUCT()
+struct FSigilInstanceBatch
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TObjectPtr<UInstancedStaticMeshComponent> Instances;
+
+    TObjectKey<UStaticMesh> Mesh;
+    TObjectKey<UMaterialInterface> Material;
+    TArray<int32> FreeInstances; // Hidden, ready for reuse
+    bool bRenderStateDirty = false;
+};
+
+/** Idle decal or particle components of one class and material. */
+USTRUCT()
+struct FSigilComponentPool
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<TObjectPtr<UPrimitiveComponent>> FreeComponents;
+    UPROPERTY()
+    TArray<TObjectPtr<UMaterialInstanceDynamic>> FreeMaterials; // Parallel to FreeComponents
+
+    TObjectKey<UClass> ComponentClass;
+    TObjectKey<UMaterialInterface> Material;
+};
+
+/**
+ * @brief Per-world pool of sigil visuals.
+ *
+ * Sigils with a mesh are drawn as instances of one UInstancedStaticMeshComponent per mesh and material; color
+ * and intensity go to per-instance custom data (PerInstanceCustomData 0-3 for SigilColor, 4 for SigilIntensity)
+ * rather than into a material instance per sigil. A released instance is hidden at zero scale and its index
+ * reused, so indices never shift, and each batch's render state is refreshed once per frame however many of
+ * its instances changed. Decal and particle sigils recycle their components, along with the dynamic material
+ * instance each one keeps, instead of creating and destroying them. Pooled objects belong to one transient
+ * actor owned by the pool and are attached to a sigil's owner while in use.
+ */
+UCLASS()
+class HEXADEMICPLUGIN_API USigilVisualPoolSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** The sigil visual pool of WorldContext's world, or null outside a game world. */
+    static USigilVisualPoolSubsystem* GetFor(const UObject* WorldContext);
+
+    /** Shows Sigil in Style, placed relative to AttachParent as of now. Invalid if Style draws nothing. */
+    FSigilVisualHandle AcquireVisual(const FSigilVisualStyle& Style, USceneComponent* AttachParent, const FSigilProjection& Sigil);
+
+    /** Applies Sigil's color, intensity and scale, and follows AttachParent. */
+    void UpdateVisual(FSigilVisualHandle Handle, const FSigilProjection& Sigil);
+
+    /** Applies color, intensity and scale as given, for callers that fade a sigil without touching its projection. */
+    void UpdateVisual(FSigilVisualHandle Handle, const FLinearColor& Color, float Intensity, float Scale);
+
+    /** Hides the visual and returns it to the pool. */
+    void ReleaseVisual(FSigilVisualHandle Handle);
+
+    static constexpr int32 NumInstanceCustomData = 5; // SigilColor RGBA, SigilIntensity
+
+private:
+    AActor* GetOrCreatePoolActor();
+    int32 FindOrAddBatch(UStaticMesh* Mesh, UMaterialInterface* Material);
+    int32 FindOrAddComponentPool(UClass* ComponentClass, UMaterialInterface* Material);
+    void AcquireInstance(FSigilVisualSlot& Slot, UStaticMesh* Mesh, UMaterialInterface* Material);
+    bool AcquireComponent(FSigilVisualSlot& Slot, const FSigilVisualStyle& Style, const FSigilProjection& Sigil);
+    /** The slot behind Handle, or null if it has been released since. */
+    FSigilVisualSlot* FindSlot(FSigilVisualHandle Handle);
+    /** Resets the slot for its next user and invalidates every handle to it. */
+    void FreeSlot(int32 SlotIndex);
+
+    UPROPERTY()
+    TObjectPtr<AActor> PoolActor;
+
+    UPROPERTY()
+    TArray<FSigilVisualSlot> Slots;
+    TArray<int32> FreeSlots;
+
+    UPROPERTY()
+    TArray<FSigilInstanceBatch> Batches;
+
+    UPROPERTY()
+    TArray<FSigilComponentPool> ComponentPools;
+};
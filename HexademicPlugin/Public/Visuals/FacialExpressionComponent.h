@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Subsystems/EmbodimentSignificanceSubsystem.h" // For FEmbodimentUpdateGate
 #include "Visuals/FacialExpressionComponent.generated.h"
 
 UCLASS(ClassGroup=(HexademicVisuals), meta=(BlueprintSpawnableComponent))
@@ -15,6 +16,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
@@ -42,4 +44,7 @@ protected:
     // Speed of expression changes
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Facial Tuning")
     float ExpressionBlendSpeed = 5.0f;
+
+    // Update rate assigned by UEmbodimentSignificanceSubsystem
+    FEmbodimentUpdateGate SignificanceGate;
 };
@@ -0,0 +1,234 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/SigilProjection.h" // For FSigilProjection
+
+/** Refers to one sigil in a TSigilLifetimeTable. Stale once the sigil is gone, even if its slot is reused. */
+struct FSigilHandle
+{
+    int32 SlotIndex = INDEX_NONE;
+    uint32 Generation = 0;
+
+    bool IsValid() const { return SlotIndex != INDEX_NONE; }
+    bool operator==(const FSigilHandle& Other) const { return SlotIndex == Other.SlotIndex && Generation == Other.Generation; }
+};
+
+/**
+ * @brief Active sigils with their lifetimes, for systems that keep many of them.
+ *
+ * Sigils live in a dense array, addressed through generational handles, so iteration is contiguous and a
+ * handle to an expired sigil can never reach the one that later takes its slot. Expiry times sit in a
+ * min-heap: expiring costs O(expired * log n) and nothing at all while no sigil is due, however many are
+ * alive. Lifetime and fade are never decremented; Evaluate computes them from the spawn and expiry times
+ * when they are read. The stored FSigilProjection keeps the values it was projected with.
+ *
+ * Entries replaced or removed early leave stale heap entries behind; they are skipped when they surface,
+ * and the heap is rebuilt once they outnumber the live ones.
+ */
+template <typename PayloadType>
+class TSigilLifetimeTable
+{
+public:
+    /** Intensity and scale ramp down linearly over a sigil's last FadeSeconds. */
+    static constexpr float FadeSeconds = 5.0f;
+
+    struct FEntry
+    {
+        FSigilProjection Sigil; // As projected; RemainingLifetime is the initial lifetime
+        PayloadType Payload = PayloadType();
+        double SpawnSeconds = 0.0;
+        double ExpirySeconds = 0.0;
+        int32 SlotIndex = INDEX_NONE;
+    };
+
+    int32 Num() const { return Entries.Num(); }
+
+    /** Adds Sigil, or replaces the sigil with the same SigilID and restarts its lifetime. Payload is kept on replace. */
+    FSigilHandle Project(const FSigilProjection& Sigil, double NowSeconds, bool* bOutReplaced = nullptr)
+    {
+        FSigilHandle Handle = Find(Sigil.SigilID);
+        if (bOutReplaced) *bOutReplaced = Handle.IsValid();
+        if (!Handle.IsValid())
+        {
+            Handle = AllocateSlot();
+            FEntry& Added = Entries.AddDefaulted_GetRef();
+            Added.SlotIndex = Handle.SlotIndex;
+            Slots[Handle.SlotIndex].DenseIndex = Entries.Num() - 1;
+            IdToHandle.Add(Sigil.SigilID, Handle);
+        }
+
+        FEntry& Entry = Entries[Slots[Handle.SlotIndex].DenseIndex];
+        Entry.Sigil = Sigil;
+        Entry.SpawnSeconds = NowSeconds;
+        Entry.ExpirySeconds = NowSeconds + FMath::Max(Sigil.RemainingLifetime, 0.0f);
+        Expiries.HeapPush(FExpiry{Entry.ExpirySeconds, Handle}, FExpiryOrder());
+        CompactExpiriesIfStale();
+        return Handle;
+    }
+
+    FSigilHandle Find(const FString& SigilID) const
+    {
+        const FSigilHandle* Handle = IdToHandle.Find(SigilID);
+        return Handle ? *Handle : FSigilHandle();
+    }
+
+    FEntry* Get(FSigilHandle Handle)
+    {
+        return IsAlive(Handle) ? &Entries[Slots[Handle.SlotIndex].DenseIndex] : nullptr;
+    }
+    const FEntry* Get(FSigilHandle Handle) const
+    {
+        return IsAlive(Handle) ? &Entries[Slots[Handle.SlotIndex].DenseIndex] : nullptr;
+    }
+
+    bool IsAlive(FSigilHandle Handle) const
+    {
+        return Slots.IsValidIndex(Handle.SlotIndex) && Slots[Handle.SlotIndex].Generation == Handle.Generation
+            && Slots[Handle.SlotIndex].DenseIndex != INDEX_NONE;
+    }
+
+    /** Removes a sigil before its time. Returns false for stale handles. */
+    bool Remove(FSigilHandle Handle, FEntry* OutRemoved = nullptr)
+    {
+        if (!IsAlive(Handle)) return false;
+        RemoveAlive(Handle, OutRemoved);
+        CompactExpiriesIfStale();
+        return true;
+    }
+
+    /** Removes every sigil whose lifetime is over at NowSeconds, calling OnExpired(const FEntry&) for each first. */
+    template <typename FuncType>
+    int32 ExpireUntil(double NowSeconds, FuncType&& OnExpired)
+    {
+        int32 NumExpired = 0;
+        while (Expiries.Num() > 0 && Expiries.HeapTop().ExpirySeconds <= NowSeconds)
+        {
+            const FExpiry Due = Expiries.HeapTop();
+            Expiries.HeapPopDiscard(FExpiryOrder());
+
+            // Skip entries left behind by Remove or by a replacing Project
+            const FEntry* Entry = Get(Due.Handle);
+            if (!Entry || Entry->ExpirySeconds != Due.ExpirySeconds) continue;
+
+            FEntry Expired;
+            RemoveAlive(Due.Handle, &Expired);
+            OnExpired(static_cast<const FEntry&>(Expired));
+            NumExpired++;
+        }
+        return NumExpired;
+    }
+
+    /** Removes everything, calling OnRemoved(const FEntry&) for each. */
+    template <typename FuncType>
+    void Empty(FuncType&& OnRemoved)
+    {
+        for (const FEntry& Entry : Entries)
+        {
+            OnRemoved(Entry);
+
+            // Slots are kept, with new generations, so no handle given out so far can match a later sigil
+            FSlot& Slot = Slots[Entry.SlotIndex];
+            Slot.DenseIndex = INDEX_NONE;
+            Slot.Generation++;
+            FreeSlots.Add(Entry.SlotIndex);
+        }
+        Entries.Reset();
+        Expiries.Reset();
+        IdToHandle.Reset();
+    }
+
+    /** Live entries, densely packed; order changes as sigils are removed. */
+    TArrayView<FEntry> GetEntries() { return Entries; }
+    TConstArrayView<FEntry> GetEntries() const { return Entries; }
+
+    /** Fraction of full intensity and scale an entry shows at NowSeconds. */
+    static float GetFade(const FEntry& Entry, double NowSeconds)
+    {
+        return FMath::Clamp(static_cast<float>(Entry.ExpirySeconds - NowSeconds) / FadeSeconds, 0.0f, 1.0f);
+    }
+
+    static bool IsFading(const FEntry& Entry, double NowSeconds)
+    {
+        return Entry.ExpirySeconds - NowSeconds < FadeSeconds;
+    }
+
+    /** The sigil as it stands at NowSeconds: remaining lifetime, intensity and scale derived from its timestamps. */
+    static FSigilProjection Evaluate(const FEntry& Entry, double NowSeconds)
+    {
+        FSigilProjection Sigil = Entry.Sigil;
+        const float Fade = GetFade(Entry, NowSeconds);
+        Sigil.RemainingLifetime = static_cast<float>(Entry.ExpirySeconds - NowSeconds);
+        Sigil.Intensity *= Fade;
+        Sigil.Scale *= Fade;
+        return Sigil;
+    }
+
+private:
+    struct FSlot
+    {
+        int32 DenseIndex = INDEX_NONE;
+        uint32 Generation = 0;
+    };
+
+    struct FExpiry
+    {
+        double ExpirySeconds = 0.0;
+        FSigilHandle Handle;
+    };
+
+    struct FExpiryOrder
+    {
+        bool operator()(const FExpiry& A, const FExpiry& B) const { return A.ExpirySeconds < B.ExpirySeconds; }
+    };
+
+    FSigilHandle AllocateSlot()
+    {
+        const int32 SlotIndex = FreeSlots.Num() > 0 ? FreeSlots.Pop() : Slots.AddDefaulted();
+        FSigilHandle Handle;
+        Handle.SlotIndex = SlotIndex;
+        Handle.Generation = Slots[SlotIndex].Generation;
+        return Handle;
+    }
+
+    void RemoveAlive(FSigilHandle Handle, FEntry* OutRemoved)
+    {
+        FSlot& Slot = Slots[Handle.SlotIndex];
+        const int32 DenseIndex = Slot.DenseIndex;
+        IdToHandle.Remove(Entries[DenseIndex].Sigil.SigilID);
+        if (OutRemoved)
+        {
+            *OutRemoved = MoveTemp(Entries[DenseIndex]);
+        }
+
+        Entries.RemoveAtSwap(DenseIndex);
+        if (Entries.IsValidIndex(DenseIndex))
+        {
+            Slots[Entries[DenseIndex].SlotIndex].DenseIndex = DenseIndex; // The last entry moved into the gap
+        }
+
+        Slot.DenseIndex = INDEX_NONE;
+        Slot.Generation++;
+        FreeSlots.Add(Handle.SlotIndex);
+    }
+
+    void CompactExpiriesIfStale()
+    {
+        if (Expiries.Num() <= 2 * Entries.Num() + 16) return;
+
+        Expiries.Reset();
+        for (const FEntry& Entry : Entries)
+        {
+            FSigilHandle Handle;
+            Handle.SlotIndex = Entry.SlotIndex;
+            Handle.Generation = Slots[Entry.SlotIndex].Generation;
+            Expiries.Add(FExpiry{Entry.ExpirySeconds, Handle});
+        }
+        Expiries.Heapify(FExpiryOrder());
+    }
+
+    TArray<FEntry> Entries;
+    TArray<FSlot> Slots;
+    TArray<int32> FreeSlots;
+    TArray<FExpiry> Expiries; // Min-heap on ExpirySeconds
+    TMap<FString, FSigilHandle> IdToHandle;
+};